@@ -0,0 +1,6 @@
+#include "example.cpp"
+
+int main(int argc, char** argv)
+{
+    return run_example(argc, argv) ? 0 : 1;
+}
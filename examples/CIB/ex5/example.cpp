@@ -0,0 +1,291 @@
+// Filename main.cpp
+// Created on 26 Jul 2016 by Amneet Bhalla
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <vector>
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/MobilityFunctions.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+
+// Compute the velocities of markers target_begin, ..., target_end-1 by direct
+// summation of the Rotne-Prager-Yamakawa tensor over all pairs of markers.
+void
+apply_rpy_mobility_directly(const double mu,
+                            const double hrad,
+                            const double* X,
+                            const double* F,
+                            const int N,
+                            const double f_periodic_corr,
+                            const int target_begin,
+                            const int target_end,
+                            double* U)
+{
+    const double mu_tt = 1.0 / (6.0 * M_PI * mu * hrad);
+    double net_force[NDIM] = { 0.0 };
+    for (int n = 0; n < N; ++n)
+    {
+        for (int d = 0; d < NDIM; ++d) net_force[d] += F[n * NDIM + d];
+    }
+    for (int t = target_begin; t < target_end; ++t)
+    {
+        double* const u = &U[(t - target_begin) * NDIM];
+        for (int d = 0; d < NDIM; ++d) u[d] = mu_tt * F[t * NDIM + d] - f_periodic_corr * net_force[d];
+        for (int n = 0; n < N; ++n)
+        {
+            if (n == t) continue;
+            double r_vec[NDIM], r_sq = 0.0, r_dot_f = 0.0;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                r_vec[d] = X[t * NDIM + d] - X[n * NDIM + d];
+                r_sq += r_vec[d] * r_vec[d];
+                r_dot_f += r_vec[d] * F[n * NDIM + d];
+            }
+            if (r_sq == 0.0)
+            {
+                for (int d = 0; d < NDIM; ++d) u[d] += mu_tt * F[n * NDIM + d];
+                continue;
+            }
+            const double r = std::sqrt(r_sq);
+            double c_iso, c_dyad;
+            if (r <= 2.0 * hrad)
+            {
+                c_iso = mu_tt * (1.0 - 9.0 * r / (32.0 * hrad));
+                c_dyad = mu_tt * 3.0 * r / (32.0 * hrad);
+            }
+            else
+            {
+                const double a_r = hrad / r;
+                c_iso = mu_tt * (0.75 * a_r + 0.5 * a_r * a_r * a_r);
+                c_dyad = mu_tt * (0.75 * a_r - 1.5 * a_r * a_r * a_r);
+            }
+            for (int d = 0; d < NDIM; ++d) u[d] += c_iso * F[n * NDIM + d] + c_dyad * r_dot_f * r_vec[d] / r_sq;
+        }
+    }
+    return;
+} // apply_rpy_mobility_directly
+
+/*******************************************************************************
+ * For each number of markers, this benchmark generates a random suspension of *
+ * markers and forces and times the matrix-free application of the RPY         *
+ * mobility for several opening angles.  For up to NUM_DENSE_MAX markers, the  *
+ * velocities are compared to the product of the dense mobility matrix, formed *
+ * as is done by DirectMobilitySolver, with the forces.  For larger problems,  *
+ * they are compared to a direct summation of the RPY tensor, computed         *
+ * independently of MobilityFunctions, at a sample of the markers.             *
+ *                                                                             *
+ * process computes the velocity of only the markers that it owns.             *
+ * process computes the velocity of only the markers that it owns.            *
+ *******************************************************************************/
+bool
+run_example(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool errors_within_tolerance = true;
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "RPY.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Read the benchmark parameters.
+        const double mu = input_db->getDouble("MU");
+        const double dx = input_db->getDouble("DX");
+        const string kernel = input_db->getString("KERNEL");
+        const double hrad = input_db->getDouble("HYDRODYNAMIC_RADIUS");
+        const double volume_fraction = input_db->getDouble("VOLUME_FRACTION");
+        const Array<int> num_markers = input_db->getIntegerArray("NUM_MARKERS");
+        const Array<double> opening_angles = input_db->getDoubleArray("OPENING_ANGLES");
+        const double error_tol = input_db->getDouble("ERROR_TOL");
+        const int num_error_samples = input_db->getInteger("NUM_ERROR_SAMPLES");
+        const int num_dense_max = input_db->getInteger("NUM_DENSE_MAX");
+        const int num_repetitions = input_db->getInteger("NUM_REPETITIONS");
+        const int seed = input_db->getIntegerWithDefault("SEED", 0);
+        const double f_periodic_corr = input_db->getDoubleWithDefault("F_PERIODIC_CORRECTION", 0.0);
+
+        const int rank = SAMRAI_MPI::getRank();
+        const int nodes = SAMRAI_MPI::getNodes();
+
+        // The hydrodynamic radius associated with the kernel is recovered from
+        // the self-mobility of a single marker.
+        double self_mobility[NDIM * NDIM];
+        const double X_origin[NDIM] = { 0.0 };
+        MobilityFunctions::constructRPYMobilityMatrix(kernel.c_str(), mu, dx, X_origin, 1, 0.0, self_mobility);
+        const double hrad_kernel = 1.0 / (6.0 * M_PI * mu * self_mobility[0]);
+
+        pout << "     N   theta  time per apply (s)  relative error  reference\n";
+        for (int k = 0; k < num_markers.size(); ++k)
+        {
+            const int N = num_markers[k];
+
+            // Generate the same random suspension on every process.  The edge
+            // length of the cube is chosen so that the markers, treated as
+            // spheres of the hydrodynamic radius, fill the requested volume
+            // fraction.
+#if (NDIM == 2)
+            const double L = std::sqrt(N * M_PI * hrad * hrad / volume_fraction);
+#endif
+#if (NDIM == 3)
+            const double L = std::pow(N * 4.0 / 3.0 * M_PI * hrad * hrad * hrad / volume_fraction, 1.0 / 3.0);
+#endif
+            std::srand(seed);
+            std::vector<double> X(N * NDIM), F(N * NDIM);
+            for (int i = 0; i < N * NDIM; ++i)
+            {
+                X[i] = L * static_cast<double>(std::rand()) / static_cast<double>(RAND_MAX);
+                F[i] = static_cast<double>(std::rand()) / static_cast<double>(RAND_MAX) - 0.5;
+            }
+
+            // Split the markers into contiguous blocks, one per process.
+            const int target_begin = static_cast<int>((static_cast<long>(N) * rank) / nodes);
+            const int target_end = static_cast<int>((static_cast<long>(N) * (rank + 1)) / nodes);
+            const int num_local = target_end - target_begin;
+            std::vector<double> U(std::max(num_local, 1) * NDIM);
+
+            // Form and apply the dense mobility matrix, as is done by
+            // DirectMobilitySolver, on a single process.  When it is formed,
+            // the dense product is used as the reference solution at all of the
+            // local markers.
+            const bool use_dense_reference = N <= num_dense_max;
+            std::vector<double> U_dense;
+            if (use_dense_reference)
+            {
+                double dense_time = 0.0;
+                U_dense.resize(N * NDIM, 0.0);
+                if (rank == 0)
+                {
+                    const double start_time = MPI_Wtime();
+                    std::vector<double> mobility_mat(static_cast<size_t>(N * NDIM) * (N * NDIM));
+                    MobilityFunctions::constructRPYMobilityMatrix(
+                        kernel.c_str(), mu, dx, &X[0], N, f_periodic_corr, &mobility_mat[0]);
+                    for (int col = 0; col < N * NDIM; ++col)
+                    {
+                        for (int row = 0; row < N * NDIM; ++row)
+                        {
+                            U_dense[row] += mobility_mat[static_cast<size_t>(col) * (N * NDIM) + row] * F[col];
+                        }
+                    }
+                    dense_time = MPI_Wtime() - start_time;
+                }
+                dense_time = SAMRAI_MPI::maxReduction(dense_time);
+                int length = N * NDIM;
+                SAMRAI_MPI::bcast(&U_dense[0], length, 0);
+                pout << std::setw(7) << N << "  dense  " << std::setw(18) << dense_time << "\n";
+            }
+
+            // Otherwise, compute reference velocities at a sample of the local
+            // markers by direct summation of the RPY tensor, independently of
+            // MobilityFunctions.
+            const int num_samples = use_dense_reference ? num_local : std::min(num_local, num_error_samples);
+            std::vector<double> U_exact(std::max(num_samples, 1) * NDIM);
+            if (use_dense_reference)
+            {
+                std::copy(U_dense.begin() + target_begin * NDIM,
+                          U_dense.begin() + (target_begin + num_samples) * NDIM,
+                          U_exact.begin());
+            }
+            else
+            {
+                apply_rpy_mobility_directly(mu,
+                                            hrad_kernel,
+                                            &X[0],
+                                            &F[0],
+                                            N,
+                                            f_periodic_corr,
+                                            target_begin,
+                                            target_begin + num_samples,
+                                            &U_exact[0]);
+            }
+            double U_exact_sq_norm = 0.0;
+            for (int i = 0; i < num_samples * NDIM; ++i) U_exact_sq_norm += U_exact[i] * U_exact[i];
+            U_exact_sq_norm = SAMRAI_MPI::sumReduction(U_exact_sq_norm);
+
+            for (int j = 0; j < opening_angles.size(); ++j)
+            {
+                SAMRAI_MPI::barrier();
+                const double start_time = MPI_Wtime();
+                for (int r = 0; r < num_repetitions; ++r)
+                {
+                    MobilityFunctions::applyRPYMobility(kernel.c_str(),
+                                                        mu,
+                                                        dx,
+                                                        &X[0],
+                                                        &F[0],
+                                                        N,
+                                                        f_periodic_corr,
+                                                        opening_angles[j],
+                                                        target_begin,
+                                                        target_end,
+                                                        &U[0]);
+                }
+                const double time_per_apply =
+                    SAMRAI_MPI::maxReduction((MPI_Wtime() - start_time) / static_cast<double>(num_repetitions));
+
+                double error_sq_norm = 0.0;
+                for (int i = 0; i < num_samples * NDIM; ++i)
+                {
+                    error_sq_norm += (U[i] - U_exact[i]) * (U[i] - U_exact[i]);
+                }
+                error_sq_norm = SAMRAI_MPI::sumReduction(error_sq_norm);
+                const double rel_error = std::sqrt(error_sq_norm / U_exact_sq_norm);
+                errors_within_tolerance = errors_within_tolerance && rel_error <= error_tol;
+                pout << std::setw(7) << N << "  " << std::setw(5) << opening_angles[j] << "  " << std::setw(18)
+                     << time_per_apply << "  " << std::setw(14) << rel_error << "  "
+                     << (use_dense_reference ? "dense" : "direct") << "\n";
+            }
+        }
+        pout << (errors_within_tolerance ? "PASSED" : "FAILED")
+             << ": relative errors of the hierarchical approximation are "
+             << (errors_within_tolerance ? "within" : "not within") << " ERROR_TOL = " << error_tol << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return errors_within_tolerance;
+} // run_example
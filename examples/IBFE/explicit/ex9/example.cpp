@@ -0,0 +1,478 @@
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/numeric_vector.h>
+#include <libmesh/quadrature.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/libmesh_utilities.h>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Elasticity model data.
+namespace ModelData
+{
+// Coordinate mapping function.
+static double stretch = 1.0;
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = stretch * s(0) + 0.5;
+    X(1) = s(1) / stretch + 0.5;
+#if (NDIM == 3)
+    X(2) = s(2) + 0.5;
+#endif
+    return;
+} // coordinate_mapping_function
+
+// Stress tensor function.
+//
+// NOTE: The stress function is evaluated concurrently when more than one
+// assembly thread is used, so it reads, but never modifies, the model
+// parameters.
+static double c1_s = 0.05;
+static double p0_s = 0.0;
+static double beta_s = 0.0;
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*X*/,
+                    const libMesh::Point& /*s*/,
+                    Elem* const /*elem*/,
+                    const vector<const vector<double>*>& /*var_data*/,
+                    const vector<const vector<VectorValue<double> >*>& /*grad_var_data*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    PP = 2.0 * c1_s * FF + 2.0 * (-p0_s + beta_s * log(FF.det())) * tensor_inverse_transpose(FF, NDIM);
+    return;
+} // PK1_stress_function
+
+// Batched stress tensor function.
+//
+// This evaluates the same neo-Hookean model as PK1_stress_function for all of
+// the quadrature points of an element at once.  The data are stored in
+// structure-of-arrays form, so that each loop over the quadrature points
+// accesses contiguous data and may be vectorized by the compiler.
+void
+PK1_stress_batch_function(double* const PP,
+                          const double* const FF,
+                          const double* const /*x*/,
+                          const double* const /*X*/,
+                          const unsigned int n_qp,
+                          Elem* const /*elem*/,
+                          const vector<vector<const vector<double>*> >& /*var_data*/,
+                          const vector<vector<const vector<VectorValue<double> >*> >& /*grad_var_data*/,
+                          double /*time*/,
+                          void* /*ctx*/)
+{
+#if (NDIM == 2)
+    const double* const F00 = FF + 0 * n_qp;
+    const double* const F01 = FF + 1 * n_qp;
+    const double* const F10 = FF + 2 * n_qp;
+    const double* const F11 = FF + 3 * n_qp;
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        const double J = F00[qp] * F11[qp] - F01[qp] * F10[qp];
+        const double a = 2.0 * (-p0_s + beta_s * log(J)) / J;
+        PP[0 * n_qp + qp] = 2.0 * c1_s * F00[qp] + a * F11[qp];
+        PP[1 * n_qp + qp] = 2.0 * c1_s * F01[qp] - a * F10[qp];
+        PP[2 * n_qp + qp] = 2.0 * c1_s * F10[qp] - a * F01[qp];
+        PP[3 * n_qp + qp] = 2.0 * c1_s * F11[qp] + a * F00[qp];
+    }
+#endif
+#if (NDIM == 3)
+    const double* const F00 = FF + 0 * n_qp;
+    const double* const F01 = FF + 1 * n_qp;
+    const double* const F02 = FF + 2 * n_qp;
+    const double* const F10 = FF + 3 * n_qp;
+    const double* const F11 = FF + 4 * n_qp;
+    const double* const F12 = FF + 5 * n_qp;
+    const double* const F20 = FF + 6 * n_qp;
+    const double* const F21 = FF + 7 * n_qp;
+    const double* const F22 = FF + 8 * n_qp;
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        // The inverse transpose of FF is the cofactor matrix divided by J.
+        const double C00 = F11[qp] * F22[qp] - F12[qp] * F21[qp];
+        const double C01 = F12[qp] * F20[qp] - F10[qp] * F22[qp];
+        const double C02 = F10[qp] * F21[qp] - F11[qp] * F20[qp];
+        const double C10 = F02[qp] * F21[qp] - F01[qp] * F22[qp];
+        const double C11 = F00[qp] * F22[qp] - F02[qp] * F20[qp];
+        const double C12 = F01[qp] * F20[qp] - F00[qp] * F21[qp];
+        const double C20 = F01[qp] * F12[qp] - F02[qp] * F11[qp];
+        const double C21 = F02[qp] * F10[qp] - F00[qp] * F12[qp];
+        const double C22 = F00[qp] * F11[qp] - F01[qp] * F10[qp];
+        const double J = F00[qp] * C00 + F01[qp] * C01 + F02[qp] * C02;
+        const double a = 2.0 * (-p0_s + beta_s * log(J)) / J;
+        PP[0 * n_qp + qp] = 2.0 * c1_s * F00[qp] + a * C00;
+        PP[1 * n_qp + qp] = 2.0 * c1_s * F01[qp] + a * C01;
+        PP[2 * n_qp + qp] = 2.0 * c1_s * F02[qp] + a * C02;
+        PP[3 * n_qp + qp] = 2.0 * c1_s * F10[qp] + a * C10;
+        PP[4 * n_qp + qp] = 2.0 * c1_s * F11[qp] + a * C11;
+        PP[5 * n_qp + qp] = 2.0 * c1_s * F12[qp] + a * C12;
+        PP[6 * n_qp + qp] = 2.0 * c1_s * F20[qp] + a * C20;
+        PP[7 * n_qp + qp] = 2.0 * c1_s * F21[qp] + a * C21;
+        PP[8 * n_qp + qp] = 2.0 * c1_s * F22[qp] + a * C22;
+    }
+#endif
+    return;
+} // PK1_stress_batch_function
+
+// Body force function.
+static double g_s = 0.0;
+void
+lag_body_force_function(VectorValue<double>& F,
+                        const TensorValue<double>& /*FF*/,
+                        const libMesh::Point& /*X*/,
+                        const libMesh::Point& /*s*/,
+                        Elem* const /*elem*/,
+                        const vector<const vector<double>*>& /*var_data*/,
+                        const vector<const vector<VectorValue<double> >*>& /*grad_var_data*/,
+                        double /*time*/,
+                        void* /*ctx*/)
+{
+    F.zero();
+    F(NDIM - 1) = -g_s;
+    return;
+} // lag_body_force_function
+}
+using namespace ModelData;
+
+/*******************************************************************************
+ * This benchmark times the computation of the interior elastic force density  *
+ * by IBFEMethod using 1, 2, ..., MAX_ASSEMBLY_THREADS OpenMP threads, and     *
+ * checks that the computed forces do not depend on the number of threads.     *
+ * It also compares pointwise and batched evaluation of the PK1 stress.        *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+
+bool run_example(int argc, char** argv)
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool forces_match = true;
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create a simple FE mesh.
+        Mesh mesh(init.comm(), NDIM);
+        const double dx = input_db->getDouble("DX");
+        const double ds = input_db->getDouble("MFAC") * dx;
+        const string elem_type = input_db->getString("ELEM_TYPE");
+        const double W = input_db->getDouble("W");
+        const int num_elems = static_cast<int>(ceil(W / ds));
+#if (NDIM == 2)
+        MeshTools::Generation::build_square(mesh,
+                                            num_elems,
+                                            num_elems,
+                                            -0.5 * W,
+                                            0.5 * W,
+                                            -0.5 * W,
+                                            0.5 * W,
+                                            Utility::string_to_enum<ElemType>(elem_type));
+#endif
+#if (NDIM == 3)
+        MeshTools::Generation::build_cube(mesh,
+                                          num_elems,
+                                          num_elems,
+                                          num_elems,
+                                          -0.5 * W,
+                                          0.5 * W,
+                                          -0.5 * W,
+                                          0.5 * W,
+                                          -0.5 * W,
+                                          0.5 * W,
+                                          Utility::string_to_enum<ElemType>(elem_type));
+#endif
+
+        stretch = input_db->getDoubleWithDefault("STRETCH", 1.0);
+        c1_s = input_db->getDouble("C1_S");
+        p0_s = input_db->getDouble("P0_S");
+        beta_s = input_db->getDouble("BETA_S");
+        g_s = input_db->getDoubleWithDefault("G_S", 0.0);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver.
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        const libMesh::Order PK1_quad_order =
+            Utility::string_to_enum<libMesh::Order>(input_db->getStringWithDefault("PK1_QUAD_ORDER", "THIRD"));
+        const string PK1_stress_fcn_type = input_db->getStringWithDefault("PK1_STRESS_FCN_TYPE", "BATCHED");
+        if (PK1_stress_fcn_type == "BATCHED")
+        {
+            IBFEMethod::PK1StressBatchFcnData PK1_stress_data(PK1_stress_batch_function);
+            PK1_stress_data.quad_order = PK1_quad_order;
+            ib_method_ops->registerPK1StressFunction(PK1_stress_data);
+        }
+        else if (PK1_stress_fcn_type == "SCALAR")
+        {
+            IBFEMethod::PK1StressFcnData PK1_stress_data(PK1_stress_function);
+            PK1_stress_data.quad_order = PK1_quad_order;
+            ib_method_ops->registerPK1StressFunction(PK1_stress_data);
+        }
+        else
+        {
+            TBOX_ERROR("unknown PK1_STRESS_FCN_TYPE: " << PK1_stress_fcn_type << "\n");
+        }
+        ib_method_ops->registerLagBodyForceFunction(lag_body_force_function);
+        ib_method_ops->initializeFEEquationSystems();
+        EquationSystems* equation_systems = ib_method_ops->getFEDataManager()->getEquationSystems();
+
+        // Initialize hierarchy configuration and data on all patches.
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Setup the Lagrangian data for a single time step.
+        const double current_time = time_integrator->getIntegratorTime();
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        const double half_time = current_time + 0.5 * dt;
+        ib_method_ops->preprocessIntegrateData(current_time, current_time + dt, /*num_cycles*/ 1);
+        NumericVector<double>& F_vec =
+            *equation_systems->get_system(IBFEMethod::FORCE_SYSTEM_NAME).current_local_solution;
+
+        const int num_repetitions = input_db->getIntegerWithDefault("NUM_REPETITIONS", 10);
+
+        // Compare the cost of evaluating the stress one quadrature point at a
+        // time with the cost of evaluating it for all of the quadrature points
+        // of an element at once.
+        {
+            UniquePtr<QBase> qrule = QBase::build(QGAUSS, NDIM, PK1_quad_order);
+            qrule->init(Utility::string_to_enum<ElemType>(elem_type));
+            const unsigned int n_qp = qrule->n_points();
+            const unsigned int n_elem = std::max(mesh.n_active_local_elem(), static_cast<dof_id_type>(1));
+            vector<double> FF_qp(n_elem * NDIM * NDIM * n_qp), PP_qp(n_elem * NDIM * NDIM * n_qp);
+            vector<double> x_qp(NDIM * n_qp, 0.0), X_qp(NDIM * n_qp, 0.0);
+            vector<TensorValue<double> > FF(n_elem * n_qp), PP(n_elem * n_qp);
+            for (unsigned int e = 0; e < n_elem; ++e)
+            {
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    TensorValue<double>& FF_e_qp = FF[e * n_qp + qp];
+                    for (unsigned int i = 0; i < NDIM; ++i)
+                    {
+                        for (unsigned int j = 0; j < NDIM; ++j)
+                        {
+                            const double theta = static_cast<double>((e * n_qp + qp) * NDIM * NDIM + i * NDIM + j);
+                            FF_e_qp(i, j) = (i == j ? 1.0 : 0.0) + 0.01 * sin(theta);
+                            FF_qp[e * NDIM * NDIM * n_qp + (i * NDIM + j) * n_qp + qp] = FF_e_qp(i, j);
+                        }
+                    }
+                }
+            }
+            const vector<const vector<double>*> var_data;
+            const vector<const vector<VectorValue<double> >*> grad_var_data;
+            const vector<vector<const vector<double>*> > var_data_qp(n_qp);
+            const vector<vector<const vector<VectorValue<double> >*> > grad_var_data_qp(n_qp);
+            const libMesh::Point x, X;
+
+            double start_time = MPI_Wtime();
+            for (int k = 0; k < num_repetitions; ++k)
+            {
+                for (unsigned int l = 0; l < n_elem * n_qp; ++l)
+                {
+                    PK1_stress_function(PP[l], FF[l], x, X, NULL, var_data, grad_var_data, half_time, NULL);
+                }
+            }
+            const double scalar_time = MPI_Wtime() - start_time;
+            start_time = MPI_Wtime();
+            for (int k = 0; k < num_repetitions; ++k)
+            {
+                for (unsigned int e = 0; e < n_elem; ++e)
+                {
+                    PK1_stress_batch_function(&PP_qp[e * NDIM * NDIM * n_qp],
+                                              &FF_qp[e * NDIM * NDIM * n_qp],
+                                              &x_qp[0],
+                                              &X_qp[0],
+                                              n_qp,
+                                              NULL,
+                                              var_data_qp,
+                                              grad_var_data_qp,
+                                              half_time,
+                                              NULL);
+                }
+            }
+            const double batch_time = MPI_Wtime() - start_time;
+            double max_diff = 0.0;
+            for (unsigned int e = 0; e < n_elem; ++e)
+            {
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    for (unsigned int i = 0; i < NDIM; ++i)
+                    {
+                        for (unsigned int j = 0; j < NDIM; ++j)
+                        {
+                            max_diff =
+                                std::max(max_diff,
+                                         std::abs(PP[e * n_qp + qp](i, j) -
+                                                  PP_qp[e * NDIM * NDIM * n_qp + (i * NDIM + j) * n_qp + qp]));
+                        }
+                    }
+                }
+            }
+            pout << "PK1 stress evaluation (" << n_elem << " elements, " << n_qp
+                 << " quadrature points per element):\n";
+            pout << "  scalar time (s): " << scalar_time << "\n";
+            pout << "  batched time (s): " << batch_time << "\n";
+            pout << "  speedup: " << scalar_time / batch_time << "\n";
+            pout << "  max |PP_scalar - PP_batched|: " << max_diff << "\n";
+        }
+
+        // Time the force computation using increasing numbers of threads.
+#if defined(_OPENMP)
+        const int max_num_threads = input_db->getIntegerWithDefault("MAX_ASSEMBLY_THREADS", omp_get_max_threads());
+#else
+        const int max_num_threads = 1;
+#endif
+        pout << "PK1 stress function type: " << PK1_stress_fcn_type << "\n";
+        pout << "number of local elements: " << mesh.n_active_local_elem() << "\n";
+        pout << "threads  time per call (s)  speedup  max |F - F_serial|\n";
+        libMesh::UniquePtr<NumericVector<double> > F_serial_vec;
+        double serial_time = 0.0;
+        for (int num_threads = 1; num_threads <= max_num_threads; ++num_threads)
+        {
+            ib_method_ops->setNumAssemblyThreads(num_threads);
+            ib_method_ops->computeLagrangianForce(half_time);
+            SAMRAI_MPI::barrier();
+            const double start_time = MPI_Wtime();
+            for (int k = 0; k < num_repetitions; ++k)
+            {
+                ib_method_ops->computeLagrangianForce(half_time);
+            }
+            SAMRAI_MPI::barrier();
+            const double time_per_call =
+                SAMRAI_MPI::maxReduction((MPI_Wtime() - start_time) / static_cast<double>(num_repetitions));
+            double max_diff = 0.0;
+            if (num_threads == 1)
+            {
+                F_serial_vec = F_vec.clone();
+                serial_time = time_per_call;
+            }
+            else
+            {
+                libMesh::UniquePtr<NumericVector<double> > diff_vec = F_vec.clone();
+                diff_vec->add(-1.0, *F_serial_vec);
+                max_diff = diff_vec->linfty_norm();
+            }
+            forces_match = forces_match && max_diff == 0.0;
+            pout << std::setw(7) << num_threads << "  " << std::setw(18) << time_per_call << "  " << std::setw(7)
+                 << serial_time / time_per_call << "  " << max_diff << "\n";
+        }
+        ib_method_ops->postprocessIntegrateData(current_time, current_time + dt, /*num_cycles*/ 1);
+        if (!forces_match)
+        {
+            pout << "WARNING: the computed forces depend on the number of assembly threads\n";
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    return forces_match;
+} // run_example
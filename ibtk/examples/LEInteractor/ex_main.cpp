@@ -0,0 +1,8 @@
+#include "example.cpp"
+
+int main(int argc, char** argv)
+{
+    run_example(argc, argv);
+    return 0;
+}
+
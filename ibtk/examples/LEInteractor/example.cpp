@@ -0,0 +1,416 @@
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/TimerManager.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LEInteractor.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+namespace
+{
+// Spread the Lagrangian data on every patch of the level num_reps times and
+// return the average wall-clock time per repetition.
+double
+time_spread(const std::string& kernel_fcn,
+            const int q_idx,
+            Pointer<PatchLevel<NDIM> > level,
+            const std::vector<std::vector<double> >& Q_data,
+            const std::vector<std::vector<double> >& X_data,
+            const int num_reps)
+{
+    double elapsed_time = 0.0;
+    for (int rep = 0; rep < num_reps; ++rep)
+    {
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+            q_data->fillAll(0.0);
+            const double start_time = MPI_Wtime();
+            LEInteractor::spread(q_data,
+                                 Q_data[local_patch_num],
+                                 NDIM,
+                                 X_data[local_patch_num],
+                                 NDIM,
+                                 patch,
+                                 patch->getBox(),
+                                 kernel_fcn);
+            elapsed_time += MPI_Wtime() - start_time;
+        }
+    }
+    return elapsed_time / static_cast<double>(num_reps);
+} // time_spread
+
+// Interpolate the Eulerian data to the Lagrangian points on every patch of the
+// level num_reps times and return the average wall-clock time per repetition.
+double
+time_interp(const std::string& kernel_fcn,
+            const int q_idx,
+            Pointer<PatchLevel<NDIM> > level,
+            std::vector<std::vector<double> >& Q_data,
+            const std::vector<std::vector<double> >& X_data,
+            const int num_reps)
+{
+    double elapsed_time = 0.0;
+    for (int rep = 0; rep < num_reps; ++rep)
+    {
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+            const double start_time = MPI_Wtime();
+            LEInteractor::interpolate(Q_data[local_patch_num],
+                                      NDIM,
+                                      X_data[local_patch_num],
+                                      NDIM,
+                                      q_data,
+                                      patch,
+                                      patch->getBox(),
+                                      kernel_fcn);
+            elapsed_time += MPI_Wtime() - start_time;
+        }
+    }
+    return elapsed_time / static_cast<double>(num_reps);
+} // time_interp
+
+// Compute the maximum pointwise difference between two patch data indices.
+double
+max_difference(const int q_idx, const int r_idx, Pointer<PatchLevel<NDIM> > level)
+{
+    double max_diff = 0.0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+        Pointer<CellData<NDIM, double> > r_data = patch->getPatchData(r_idx);
+        const ArrayData<NDIM, double>& q_array = q_data->getArrayData();
+        const ArrayData<NDIM, double>& r_array = r_data->getArrayData();
+        const int n = q_array.getDepth() * q_array.getBox().size();
+        const double* const q = q_array.getPointer();
+        const double* const r = r_array.getPointer();
+        for (int i = 0; i < n; ++i) max_diff = std::max(max_diff, std::abs(q[i] - r[i]));
+    }
+    return SAMRAI_MPI::maxReduction(max_diff);
+} // max_difference
+
+// Compute the maximum norm of a patch data index.
+double
+max_norm(const int r_idx, Pointer<PatchLevel<NDIM> > level)
+{
+    double max_val = 0.0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > r_data = patch->getPatchData(r_idx);
+        const ArrayData<NDIM, double>& r_array = r_data->getArrayData();
+        const int n = r_array.getDepth() * r_array.getBox().size();
+        const double* const r = r_array.getPointer();
+        for (int i = 0; i < n; ++i) max_val = std::max(max_val, std::abs(r[i]));
+    }
+    return SAMRAI_MPI::maxReduction(max_val);
+} // max_norm
+}
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_example(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "le_interactor.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> main_db = app_initializer->getComponentDatabase("Main");
+        const double points_per_cell = main_db->getDoubleWithDefault("points_per_cell", 1.0);
+        const int num_reps = main_db->getIntegerWithDefault("num_reps", 5);
+        LEInteractor::setFromDatabase(app_initializer->getComponentDatabase("LEInteractor"));
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.  The
+        // ghost cell width is large enough for every kernel function.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > q_var = new CellVariable<NDIM, double>("q", NDIM);
+        Pointer<CellVariable<NDIM, double> > r_var = new CellVariable<NDIM, double>("r", NDIM);
+        const IntVector<NDIM> ghosts = LEInteractor::getMinimumGhostWidth("IB_4_W8");
+        const int q_idx = var_db->registerVariableAndContext(q_var, ctx, ghosts);
+        const int r_idx = var_db->registerVariableAndContext(r_var, ctx, ghosts);
+
+        // Initialize a single-level patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(q_idx, 0.0);
+        level->allocatePatchData(r_idx, 0.0);
+
+        // Generate randomly distributed Lagrangian points on each patch.
+        std::vector<std::vector<double> > Q_data, X_data;
+        int num_local_points = 0;
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const x_upper = pgeom->getXUpper();
+            const int num_points = static_cast<int>(points_per_cell * patch->getBox().size());
+            std::srand(SAMRAI_MPI::getRank() + 1000 * local_patch_num);
+            Q_data.push_back(std::vector<double>(NDIM * num_points));
+            X_data.push_back(std::vector<double>(NDIM * num_points));
+            for (int k = 0; k < num_points; ++k)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const double r = static_cast<double>(std::rand()) / static_cast<double>(RAND_MAX);
+                    X_data.back()[NDIM * k + d] =
+                        std::min(x_lower[d] + r * (x_upper[d] - x_lower[d]), x_upper[d] * (1.0 - 1.0e-12));
+                    Q_data.back()[NDIM * k + d] = 2.0 * static_cast<double>(std::rand()) / RAND_MAX - 1.0;
+                }
+            }
+            num_local_points += num_points;
+        }
+        pout << "number of Lagrangian points = " << SAMRAI_MPI::sumReduction(num_local_points) << "\n";
+        LEInteractor::printClassData(pout);
+
+        // Time each kernel function using each spreading mode.
+        static const int NUM_KERNELS = 14;
+        static const char* const kernel_fcns[NUM_KERNELS] = { "PIECEWISE_CONSTANT",
+                                                              "DISCONTINUOUS_LINEAR",
+                                                              "PIECEWISE_LINEAR",
+                                                              "PIECEWISE_CUBIC",
+                                                              "IB_3",
+                                                              "IB_4",
+                                                              "IB_4_W8",
+                                                              "IB_5",
+                                                              "IB_6",
+                                                              "BSPLINE_3",
+                                                              "BSPLINE_4",
+                                                              "BSPLINE_5",
+                                                              "BSPLINE_6",
+                                                              "USER_DEFINED" };
+        static const int NUM_MODES = 3;
+        static const SpreadingMode spread_modes[NUM_MODES] = { SERIAL_SPREADING,
+                                                               COLORED_SPREADING,
+                                                               REPLICATED_SPREADING };
+        const SpreadingMode default_spread_mode = LEInteractor::getSpreadingMode();
+        bool results_agree = true;
+        for (int k = 0; k < NUM_KERNELS; ++k)
+        {
+            const std::string kernel_fcn = kernel_fcns[k];
+            LEInteractor::setSpreadingMode(SERIAL_SPREADING);
+            const double serial_time = time_spread(kernel_fcn, r_idx, level, Q_data, X_data, num_reps);
+            pout << kernel_fcn << " (stencil size " << LEInteractor::getStencilSize(kernel_fcn) << "):\n";
+            for (int m = 0; m < NUM_MODES; ++m)
+            {
+                LEInteractor::setSpreadingMode(spread_modes[m]);
+                const double spread_time = time_spread(kernel_fcn, q_idx, level, Q_data, X_data, num_reps);
+                const double max_diff = max_difference(q_idx, r_idx, level);
+                pout << "  " << enum_to_string<SpreadingMode>(spread_modes[m])
+                     << ": time = " << SAMRAI_MPI::maxReduction(spread_time)
+                     << " s, speedup = " << serial_time / spread_time << ", |q - q_serial|_oo = " << max_diff
+                     << "\n";
+                results_agree = results_agree && max_diff <= 1.0e-10 * max_norm(r_idx, level);
+            }
+
+            // Check that the colored algorithm is bitwise reproducible.
+            LEInteractor::setSpreadingMode(COLORED_SPREADING);
+            time_spread(kernel_fcn, r_idx, level, Q_data, X_data, 1);
+            time_spread(kernel_fcn, q_idx, level, Q_data, X_data, 1);
+            const bool reproducible = max_difference(q_idx, r_idx, level) == 0.0;
+            pout << "  COLORED_SPREADING bitwise reproducible: " << (reproducible ? "yes" : "no") << "\n";
+            results_agree = results_agree && reproducible;
+        }
+        LEInteractor::setSpreadingMode(default_spread_mode);
+
+        // Compare the cost of interpolation and spreading for randomly ordered
+        // points to the cost for points sorted along a Morton (Z-order) curve,
+        // which is the ordering maintained by LDataManager when the node
+        // ordering is set to MORTON_NODE_ORDERING.
+        std::vector<std::vector<double> > Q_sorted_data(Q_data.size()), X_sorted_data(X_data.size());
+        local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const Box<NDIM>& patch_box = patch->getBox();
+            const std::vector<double>& X = X_data[local_patch_num];
+            const int num_points = static_cast<int>(X.size()) / NDIM;
+            std::vector<std::pair<unsigned long, int> > point_order(num_points);
+            for (int k = 0; k < num_points; ++k)
+            {
+                const Index<NDIM> i = IndexUtilities::getCellIndex(&X[NDIM * k], pgeom, patch_box);
+                point_order[k] = std::make_pair(IndexUtilities::getMortonIndex(i, patch_box.lower()), k);
+            }
+            std::sort(point_order.begin(), point_order.end());
+            Q_sorted_data[local_patch_num].resize(NDIM * num_points);
+            X_sorted_data[local_patch_num].resize(NDIM * num_points);
+            for (int k = 0; k < num_points; ++k)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const int idx = NDIM * point_order[k].second + d;
+                    Q_sorted_data[local_patch_num][NDIM * k + d] = Q_data[local_patch_num][idx];
+                    X_sorted_data[local_patch_num][NDIM * k + d] = X[idx];
+                }
+            }
+        }
+        pout << "random vs. Morton-sorted point ordering:\n";
+        std::vector<std::vector<double> > U_data(Q_data);
+        for (int k = 0; k < NUM_KERNELS; ++k)
+        {
+            const std::string kernel_fcn = kernel_fcns[k];
+            const double random_spread_time = time_spread(kernel_fcn, q_idx, level, Q_data, X_data, num_reps);
+            const double sorted_spread_time =
+                time_spread(kernel_fcn, q_idx, level, Q_sorted_data, X_sorted_data, num_reps);
+            const double random_interp_time = time_interp(kernel_fcn, q_idx, level, U_data, X_data, num_reps);
+            const double sorted_interp_time = time_interp(kernel_fcn, q_idx, level, U_data, X_sorted_data, num_reps);
+            pout << "  " << kernel_fcn << ": spread speedup = " << random_spread_time / sorted_spread_time
+                 << ", interp speedup = " << random_interp_time / sorted_interp_time << "\n";
+        }
+
+        // Compare the C++ kernel implementations to the Fortran
+        // implementations.
+        pout << "C++ vs. Fortran kernel implementations:\n";
+        const bool default_use_fortran_kernels = LEInteractor::getUseFortranKernels();
+        for (int k = 0; k < NUM_KERNELS; ++k)
+        {
+            const std::string kernel_fcn = kernel_fcns[k];
+            LEInteractor::setUseFortranKernels(true);
+            const double fortran_spread_time = time_spread(kernel_fcn, r_idx, level, Q_data, X_data, num_reps);
+            const double fortran_interp_time = time_interp(kernel_fcn, q_idx, level, U_data, X_data, num_reps);
+            LEInteractor::setUseFortranKernels(false);
+            const double cxx_spread_time = time_spread(kernel_fcn, q_idx, level, Q_data, X_data, num_reps);
+            const double cxx_interp_time = time_interp(kernel_fcn, q_idx, level, U_data, X_data, num_reps);
+            const double max_diff = max_difference(q_idx, r_idx, level);
+            pout << "  " << kernel_fcn << ": spread speedup = " << fortran_spread_time / cxx_spread_time
+                 << ", interp speedup = " << fortran_interp_time / cxx_interp_time
+                 << ", |q - q_fortran|_oo = " << max_diff << "\n";
+            results_agree = results_agree && max_diff <= 1.0e-10 * max_norm(r_idx, level);
+        }
+        LEInteractor::setUseFortranKernels(default_use_fortran_kernels);
+
+        // Compare the cost of interpolation and spreading with and without the
+        // weight cache.  The first repetition computes the weights, and the
+        // remaining repetitions reuse them.  Cached weights are identical to
+        // the computed weights, so the results must agree exactly.
+        pout << "cached vs. computed kernel weights:\n";
+        const bool default_use_weight_cache = LEInteractor::getUseWeightCache();
+        for (int k = 0; k < NUM_KERNELS; ++k)
+        {
+            const std::string kernel_fcn = kernel_fcns[k];
+            LEInteractor::setUseWeightCache(false);
+            const double computed_spread_time = time_spread(kernel_fcn, r_idx, level, Q_data, X_data, num_reps);
+            const double computed_interp_time = time_interp(kernel_fcn, q_idx, level, U_data, X_data, num_reps);
+            LEInteractor::setUseWeightCache(true);
+            const double cached_spread_time = time_spread(kernel_fcn, q_idx, level, Q_data, X_data, num_reps);
+            const double cached_interp_time = time_interp(kernel_fcn, q_idx, level, U_data, X_data, num_reps);
+            const double max_diff = max_difference(q_idx, r_idx, level);
+            pout << "  " << kernel_fcn << ": spread speedup = " << computed_spread_time / cached_spread_time
+                 << ", interp speedup = " << computed_interp_time / cached_interp_time
+                 << ", |q - q_computed|_oo = " << max_diff << "\n";
+            results_agree = results_agree && max_diff == 0.0;
+        }
+        TimerManager* timer_manager = TimerManager::getManager();
+        pout << "  weight cache hits = "
+             << timer_manager->getTimer("IBTK::LEInteractor::interpolate()[cache_hit]")->getNumberAccesses() +
+                    timer_manager->getTimer("IBTK::LEInteractor::spread()[cache_hit]")->getNumberAccesses()
+             << ", misses = "
+             << timer_manager->getTimer("IBTK::LEInteractor::interpolate()[cache_miss]")->getNumberAccesses() +
+                    timer_manager->getTimer("IBTK::LEInteractor::spread()[cache_miss]")->getNumberAccesses()
+             << "\n";
+        LEInteractor::setUseWeightCache(default_use_weight_cache);
+
+        pout << (results_agree ? "all spreading results agree\n" : "WARNING: spreading results do not agree\n");
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return true;
+} // run_example
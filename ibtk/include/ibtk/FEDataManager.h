@@ -54,11 +54,13 @@
 #include "VariableContext.h"
 #include "boost/multi_array.hpp"
 #include "boost/unordered_map.hpp"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 #include "libmesh/dof_map.h"
 #include "libmesh/elem.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
+#include "libmesh/fe_base.h"
 #include "libmesh/system.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
@@ -180,7 +182,7 @@ public:
      */
     struct SpreadSpec
     {
-        SpreadSpec()
+        SpreadSpec() : spread_mode(SERIAL_SPREADING)
         {
         }
 
@@ -188,12 +190,14 @@ public:
                    const libMesh::QuadratureType& quad_type,
                    const libMesh::Order& quad_order,
                    bool use_adaptive_quadrature,
-                   double point_density)
+                   double point_density,
+                   SpreadingMode spread_mode = SERIAL_SPREADING)
             : kernel_fcn(kernel_fcn),
               quad_type(quad_type),
               quad_order(quad_order),
               use_adaptive_quadrature(use_adaptive_quadrature),
-              point_density(point_density)
+              point_density(point_density),
+              spread_mode(spread_mode)
         {
         }
 
@@ -202,6 +206,7 @@ public:
         libMesh::Order quad_order;
         bool use_adaptive_quadrature;
         double point_density;
+        SpreadingMode spread_mode;
     };
 
     /*!
@@ -252,6 +257,16 @@ public:
      */
     static void freeAllManagers();
 
+    /*!
+     * \brief Print the number of times that scratch patch data have been
+     * allocated, the current and the peak amount of memory used by scratch
+     * patch data, and the peak resident set size of the process (maximized
+     * over all processes).
+     *
+     * \note This is a collective operation.
+     */
+    void printMemoryStatistics(std::ostream& os) const;
+
     /*!
      * \brief Register a load balancer for non-uniform load balancing.
      */
@@ -349,6 +364,16 @@ public:
      */
     void reinitElementMappings();
 
+    /*!
+     * \brief Clear the quadrature rules, shape function tables, and quadrature
+     * point layouts that are cached by spread().
+     *
+     * The cached data are cleared automatically by reinitElementMappings().
+     * This method needs to be called explicitly only if the reference
+     * configuration of the FE mesh is modified.
+     */
+    void clearSpreadQuadratureCache();
+
     /*!
      * \return A pointer to the unghosted solution vector associated with the
      * specified system.
@@ -375,17 +400,34 @@ public:
     /*!
      * \brief Spread a density from the FE mesh to the Cartesian grid using the
      * default spreading spec.
+     *
+     * The spread values are added to the values already stored in f_data_idx.
+     * This requires a scratch copy of the Eulerian data, which is drawn from a
+     * pool that persists between calls and that is rebuilt only when the patch
+     * hierarchy changes.  If f_data_is_zero is true, the caller guarantees that
+     * the data (including ghost cells) are zero, and the values are spread
+     * directly into f_data_idx without a scratch copy.
+     *
+     * The quadrature rule that is used for each element, the corresponding
+     * shape function values, and the offsets of the quadrature point data of
+     * each element are cached, and are recomputed only when the element
+     * mappings are reinitialized or, when adaptive quadrature is used, when the
+     * deformation of an element causes a different quadrature rule to be
+     * selected.
      */
     void spread(int f_data_idx,
                 libMesh::NumericVector<double>& F,
                 libMesh::NumericVector<double>& X,
                 const std::string& system_name,
                 RobinPhysBdryPatchStrategy* f_phys_bdry_op,
-                double fill_data_time);
+                double fill_data_time,
+                bool f_data_is_zero = false);
 
     /*!
      * \brief Spread a density from the FE mesh to the Cartesian grid using a
      * specified spreading spec.
+     *
+     * \see spread()
      */
     void spread(int f_data_idx,
                 libMesh::NumericVector<double>& F,
@@ -393,7 +435,8 @@ public:
                 const std::string& system_name,
                 const SpreadSpec& spread_spec,
                 RobinPhysBdryPatchStrategy* f_phys_bdry_op,
-                double fill_data_time);
+                double fill_data_time,
+                bool f_data_is_zero = false);
 
     /*!
      * \brief Prolong a value or a density from the FE mesh to the Cartesian
@@ -675,6 +718,83 @@ private:
      */
     FEDataManager& operator=(const FEDataManager& that);
 
+    /*!
+     * \brief Quadrature rule and shape function values for one combination of
+     * element type, p-refinement level, and quadrature order.
+     */
+    struct SpreadQuadratureTable
+    {
+        libMesh::ElemType elem_type;
+        unsigned int p_level;
+        libMesh::Order order;
+        SAMRAI::tbox::Pointer<libMesh::QBase> qrule;
+        std::vector<std::vector<double> > phi_F, phi_X;
+    };
+
+    /*!
+     * \brief Quadrature data for the elements associated with one local
+     * Cartesian grid patch.
+     *
+     * The quadrature point data of element e occupy entries qp_offset[e]
+     * through qp_offset[e+1]-1 of the packed arrays.  X_qp and F_JxW_qp are
+     * dense arrays of depth NDIM and n_vars, respectively, that are passed
+     * directly to LEInteractor.
+     */
+    struct SpreadQuadraturePatchData
+    {
+        std::vector<int> elem_table;
+        std::vector<unsigned int> qp_offset;
+        std::vector<double> JxW, X_qp, F_JxW_qp;
+    };
+
+    /*!
+     * \brief Quadrature data used to spread the values of a particular system.
+     */
+    struct SpreadQuadratureCache
+    {
+        libMesh::QuadratureType quad_type;
+        libMesh::Order quad_order;
+        bool use_adaptive_quadrature;
+        double point_density;
+        std::vector<SpreadQuadratureTable> tables;
+        std::vector<SpreadQuadraturePatchData> patch_data;
+    };
+
+    /*!
+     * Return the cached spreading quadrature data for the specified system,
+     * resetting the cached data if they were generated using a different
+     * quadrature specification.
+     */
+    SpreadQuadratureCache& getSpreadQuadratureCache(const std::string& system_name, const SpreadSpec& spread_spec);
+
+    /*!
+     * Return the index of the cached quadrature table for the specified
+     * element and quadrature order, building the table if necessary.
+     */
+    static int getSpreadQuadratureTable(SpreadQuadratureCache& cache,
+                                        libMesh::Elem* elem,
+                                        libMesh::Order order,
+                                        libMesh::FEBase* F_fe,
+                                        libMesh::FEBase* X_fe);
+
+    /*!
+     * Return the index of the scratch patch data that is used to store a copy
+     * of the specified patch data, and ensure that the scratch data are
+     * allocated on all levels of the patch hierarchy.
+     */
+    int getScratchPatchDataIndex(int data_idx);
+
+    /*!
+     * Deallocate the scratch patch data on all levels of the patch hierarchy.
+     */
+    void deallocateScratchPatchData();
+
+    /*!
+     * Return the amount of memory (in bytes) currently used by scratch patch
+     * data on this process.
+     */
+    size_t getScratchPatchDataSize() const;
+
     /*!
      * Compute the quadrature point counts in each cell of the level in which
      * the FE mesh is embedded.  Also zeros out node count data for other levels
@@ -731,6 +851,16 @@ private:
     static bool s_registered_callback;
     static unsigned char s_shutdown_priority;
 
+    /*!
+     * Scratch patch data descriptor indices, keyed by the index of the patch
+     * data that they copy.  The scratch data are shared by all data manager
+     * instances, so that spreading several parts does not require several
+     * copies of the Eulerian data.
+     */
+    static std::map<int, int> s_scratch_data_idxs;
+    static unsigned int s_num_scratch_data_allocations;
+    static size_t s_scratch_data_size_high_water_mark;
+
     /*
      * The object name is used as a handle to databases stored in restart files
      * and for error reporting purposes.  The boolean is used to control restart
@@ -804,6 +934,12 @@ private:
     std::map<std::string, std::vector<unsigned int> > d_active_patch_ghost_dofs;
     std::vector<std::pair<Point, Point> > d_active_elem_bboxes;
 
+    /*
+     * Quadrature data used to spread the values of each system, indexed by
+     * system name.
+     */
+    std::map<std::string, SpreadQuadratureCache> d_spread_quad_cache;
+
     /*
      * Ghost vectors for the various equation systems.
      */
@@ -64,6 +64,10 @@ namespace solv
 template <int DIM>
 class RobinBcCoefStrategy;
 } // namespace solv
+namespace tbox
+{
+class Schedule;
+} // namespace tbox
 namespace xfer
 {
 template <int DIM>
@@ -89,6 +93,22 @@ namespace IBTK
  * \note In cases where physical boundary conditions are set via extrapolation
  * from interior values, setting ghost cell values may require both coarsening
  * and refining.
+ *
+ * \note All of the transaction components registered with a single object are
+ * communicated by a single set of cached schedules, so that one aggregated
+ * message is exchanged with each neighboring processor per schedule, rather
+ * than one message per component.  Quantities that are filled at the same time
+ * (e.g., velocity and pressure) should therefore be registered with the same
+ * object.  The cached schedules are rebuilt only by initializeOperatorState()
+ * and reinitializeOperatorState().
+ *
+ * \note Ghost cell values may also be filled in two phases by
+ * beginFillData() and endFillData(), so that callers may compute on patch
+ * interiors while the ghost cell data are being exchanged.  When the operator
+ * acts only on the coarsest level of the patch hierarchy, the data exchange is
+ * performed asynchronously by a cached schedule of patch-to-patch copy
+ * transactions.  Otherwise, beginFillData() performs the coarsen and refine
+ * schedules, which complete their communication before they return.
  */
 class HierarchyGhostCellInterpolation : public SAMRAI::tbox::DescribedClass
 {
@@ -256,6 +276,26 @@ public:
             return *this;
         } // operator=
 
+        /*!
+         * \brief Equality operator.
+         *
+         * \param that The value to compare with this object.
+         *
+         * \return Whether the two components specify the same interpolation
+         * transaction.
+         */
+        inline bool operator==(const InterpolationTransactionComponent& that) const
+        {
+            return (d_dst_data_idx == that.d_dst_data_idx && d_src_data_idx == that.d_src_data_idx &&
+                    d_refine_op_name == that.d_refine_op_name &&
+                    d_use_cf_bdry_interpolation == that.d_use_cf_bdry_interpolation &&
+                    d_coarsen_op_name == that.d_coarsen_op_name &&
+                    d_phys_bdry_extrap_type == that.d_phys_bdry_extrap_type &&
+                    d_consistent_type_2_bdry == that.d_consistent_type_2_bdry &&
+                    d_robin_bc_coefs == that.d_robin_bc_coefs &&
+                    d_fill_pattern.getPointer() == that.d_fill_pattern.getPointer());
+        } // operator==
+
         /*!
          * \brief Destructor.
          */
@@ -334,9 +374,31 @@ public:
     /*!
      * \brief Fill coarse-fine boundary and physical boundary ghost cells on all
      * levels of the patch hierarchy.
+     *
+     * This is equivalent to calling beginFillData() followed by endFillData().
      */
     void fillData(double fill_time);
 
+    /*!
+     * \brief Begin filling coarse-fine boundary and physical boundary ghost
+     * cells on all levels of the patch hierarchy by starting the exchange of
+     * ghost cell data between patches.
+     *
+     * Until endFillData() is called, the ghost cell values of the destination
+     * patch data are undefined and must not be read, and the source patch data
+     * must not be modified.  Callers may compute on the cells of each patch
+     * whose stencils do not include ghost cells.
+     */
+    void beginFillData(double fill_time);
+
+    /*!
+     * \brief Complete filling coarse-fine boundary and physical boundary ghost
+     * cells on all levels of the patch hierarchy by waiting for the exchange
+     * of ghost cell data to finish and by setting physical boundary
+     * conditions at the time passed to beginFillData().
+     */
+    void endFillData();
+
 protected:
 private:
     /*!
@@ -359,6 +421,18 @@ private:
      */
     HierarchyGhostCellInterpolation& operator=(const HierarchyGhostCellInterpolation& that);
 
+    /*!
+     * \brief Setup the cached schedule that asynchronously exchanges ghost cell
+     * data between the patches of the coarsest level of the patch hierarchy.
+     */
+    void initializeGhostExchangeSchedule();
+
+    /*!
+     * \brief Determine whether the cached ghost cell exchange schedule can
+     * fill the ghost cells of the present transaction components.
+     */
+    bool canUseGhostExchangeSchedule() const;
+
     // Boolean indicating whether the operator is initialized.
     bool d_is_initialized;
 
@@ -366,6 +440,10 @@ private:
     // boundary conditions (when applicable).
     bool d_homogeneous_bc;
 
+    // Data for a two-phase ghost cell fill.
+    bool d_fill_data_in_progress;
+    double d_fill_time;
+
     // The component interpolation operations to perform.
     std::vector<InterpolationTransactionComponent> d_transaction_comps;
 
@@ -383,6 +461,13 @@ private:
     SAMRAI::xfer::RefinePatchStrategy<NDIM>* d_refine_strategy;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
 
+    // Cached schedule that asynchronously exchanges ghost cell data between the
+    // patches of a single-level patch hierarchy, the ghost cell width that it
+    // fills, and whether it is used to fill the present transaction components.
+    SAMRAI::tbox::Pointer<SAMRAI::tbox::Schedule> d_ghost_exchange_sched;
+    SAMRAI::hier::IntVector<NDIM> d_ghost_exchange_width;
+    bool d_use_ghost_exchange_sched;
+
     // Cached coarse-fine boundary and physical boundary condition handlers.
     std::vector<SAMRAI::tbox::Pointer<CoarseFineBoundaryRefinePatchStrategy> > d_cf_bdry_ops;
     std::vector<SAMRAI::tbox::Pointer<CartExtrapPhysBdryOp> > d_extrap_bc_ops;
@@ -138,6 +138,19 @@ public:
                  const SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> >& grid_geom,
                  const SAMRAI::hier::IntVector<NDIM>& ratio);
 
+    /*!
+     * \return The Morton (Z-order) index of the cell index \p i relative to
+     * the cell index \p ilower, which is obtained by interleaving the bits of
+     * the components of i - ilower.
+     *
+     * Sorting cell indices by their Morton indices yields a space-filling curve
+     * ordering of the cells that preserves spatial locality.
+     *
+     * \note The components of i - ilower are assumed to be nonnegative and
+     * less than 2^(64/NDIM).
+     */
+    static unsigned long getMortonIndex(const SAMRAI::hier::Index<NDIM>& i, const SAMRAI::hier::Index<NDIM>& ilower);
+
     /*!
      * \brief Map (i,j,k,d) index for a DOF defined for a SAMRAI variable
      * on a particular patch level to a positive integer. Such a mapping can
@@ -43,6 +43,7 @@
 #include <vector>
 
 #include "BasePatchLevel.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -61,7 +62,9 @@
 #include "ibtk/LNodeSetVariable.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
+#include "mpi.h"
 #include "petscao.h"
 #include "petscvec.h"
 #include "tbox/Pointer.h"
@@ -205,6 +208,51 @@ public:
      */
     const std::string& getDefaultSpreadKernelFunction() const;
 
+    /*!
+     * \brief Set the ordering of the Lagrangian nodes associated with each
+     * patch.
+     *
+     * The node ordering determines the order of the indices cached by the
+     * LNodeSetData patch data objects, which is the order in which the nodes
+     * are visited during interpolation and spreading.  If \p permute_lag_data
+     * is true, the local PETSc indices of the local nodes are also assigned in
+     * this order, so that the LData vectors are physically permuted to match.
+     *
+     * \note The new ordering takes effect at the next call to
+     * endDataRedistribution().
+     */
+    void setNodeOrdering(LNodeOrderingType node_ordering, bool permute_lag_data = false);
+
+    /*!
+     * \brief Return the ordering of the Lagrangian nodes associated with each
+     * patch.
+     */
+    LNodeOrderingType getNodeOrdering() const;
+
+    /*!
+     * \brief Return whether the LData vectors are permuted to match the node
+     * ordering.
+     */
+    bool getPermuteLagrangianData() const;
+
+    /*!
+     * \brief Set whether the Lagrangian index data are updated in place during
+     * redistribution.
+     *
+     * When this is enabled, beginDataRedistribution() only moves the nodes
+     * that have left their cells since the last redistribution and reuses the
+     * existing LNodeSet objects.  The index data are rebuilt from scratch on
+     * any level whose patch boxes have changed since the data were last
+     * redistributed.
+     */
+    void setIncrementalRedistribution(bool incremental_redistribution);
+
+    /*!
+     * \brief Return whether the Lagrangian index data are updated in place
+     * during redistribution.
+     */
+    bool getIncrementalRedistribution() const;
+
     /*!
      * \brief Spread a quantity from the Lagrangian mesh to the Eulerian grid
      * using the default spreading kernel function.
@@ -783,7 +831,11 @@ public:
      * C*dx*|U| with C << 1, it may be possible to redistribute the Lagrangian
      * data less frequently than every timestep.
      *
+     * After the data are redistributed, pooled storage that is no longer used
+     * by any LNode or LNodeSet is returned to the global heap.
+     *
      * \see beginDataRedistribution
+     * \see LObjectPool
      */
     void endDataRedistribution(int coarsest_ln = -1, int finest_ln = -1);
 
@@ -1002,6 +1054,30 @@ private:
      */
     static void computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, unsigned int num_local_nodes);
 
+    /*!
+     * Send each displaced node cached on the specified level to the processor
+     * indicated by \p dst_procs, and replace the cached nodes by the nodes that
+     * are now owned by this processor.
+     *
+     * The number of incoming messages is determined by a single reduction, and
+     * the node data are then exchanged only between processors that actually
+     * share displaced nodes.  The received nodes are appended in order of
+     * source rank, independent of the order in which the messages arrive.
+     */
+    void migrateDisplacedNodes(int level_number, const std::vector<int>& dst_procs);
+
+    /*!
+     * Update the index data of the specified patch to account for the new node
+     * positions without reallocating the index data.  Only nodes that have
+     * left their cells are moved, and only the nodes that are owned by the
+     * patch are retained.
+     */
+    void updateIndexDataInPlace(int patch_num,
+                                int level_number,
+                                const double* X_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geom,
+                                const SAMRAI::hier::IntVector<NDIM>& ratio);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -1104,6 +1180,20 @@ private:
      */
     const SAMRAI::hier::IntVector<NDIM> d_ghost_width;
 
+    /*
+     * The ordering of the Lagrangian nodes associated with each patch, and
+     * whether the LData vectors are permuted to match.
+     */
+    LNodeOrderingType d_node_ordering;
+    bool d_permute_lag_data;
+
+    /*
+     * Whether the index data are updated in place during redistribution, and
+     * the patch boxes of each level at the time of the last redistribution.
+     */
+    bool d_incremental_redistribution;
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_redistribution_boxes;
+
     /*
      * Communications algorithms and schedules.
      */
@@ -1143,6 +1233,27 @@ private:
     std::vector<std::vector<LNodeSet::value_type> > d_displaced_strct_lnode_idxs;
     std::vector<std::vector<Point> > d_displaced_strct_lnode_posns;
 
+    /*
+     * Work arrays and communication buffers used to migrate displaced
+     * structures between processors.  These are retained between regrids to
+     * avoid reallocating them.
+     */
+    std::vector<std::pair<int, int> > d_migration_node_order;
+    std::vector<int> d_migration_msg_flags, d_migration_recv_counts;
+    std::vector<MPI_Request> d_migration_send_reqs;
+    std::vector<char> d_migration_recv_buffer;
+
+    /*
+     * The periodic shifts of the nodes that cross a periodic boundary during
+     * redistribution.  For each local PETSc index, d_periodic_shift_idxs holds
+     * the position of the node's shift in d_periodic_shifts, or -1 if the node
+     * is not shifted.  d_periodic_shift_patch_nums records the last patch that
+     * has registered each shift.
+     */
+    std::vector<std::vector<int> > d_periodic_shift_idxs;
+    std::vector<std::vector<std::pair<SAMRAI::hier::IntVector<NDIM>, Vector> > > d_periodic_shifts;
+    std::vector<int> d_periodic_shift_patch_nums;
+
     /*!
      * Lagrangian mesh data.
      */
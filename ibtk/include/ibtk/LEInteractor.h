@@ -42,6 +42,7 @@
 
 #include "Box.h"
 #include "IntVector.h"
+#include "ibtk/ibtk_enums.h"
 #include "tbox/Pointer.h"
 
 namespace boost
@@ -91,6 +92,53 @@ namespace IBTK
  * to interpolate data from Eulerian grid patches onto Lagrangian meshes and to
  * spread values (\em not densities) from Lagrangian meshes to Eulerian grid
  * patches.
+ *
+ * Spreading may optionally be performed by multiple threads within each patch;
+ * see setSpreadingMode() and enum SpreadingMode.  Threaded spreading requires
+ * that IBTK be compiled with OpenMP support enabled (e.g., by including
+ * -fopenmp in CFLAGS, CXXFLAGS, and FCFLAGS), so that the Fortran spreading
+ * kernels are reentrant.  Without OpenMP, all spreading modes are executed by a
+ * single thread, although COLORED_SPREADING still uses the colored summation
+ * order.
+ *
+ * The standard kernel functions are evaluated by a C++ implementation that is
+ * specialized at compile time for each kernel function and for scalar- and
+ * vector-valued data.  The weights of batches of Lagrangian points are computed
+ * together, and all data components are handled in a single sweep over each
+ * stencil.  On x86 processors, versions of these routines are compiled for the
+ * AVX2 and AVX-512 instruction sets, and the version that is used is selected
+ * at runtime.  The original Fortran implementations remain available
+ * for verification; see setUseFortranKernels().  The DISCONTINUOUS_LINEAR and
+ * USER_DEFINED kernel functions are always evaluated by their original
+ * implementations.
+ *
+ * The C++ implementation can optionally retain the stencils and weights that it
+ * computes for each patch (see setUseWeightCache()), so that when the same
+ * Lagrangian positions are used for several interpolation and spreading
+ * operations, e.g., to spread the force and to interpolate the velocity at the
+ * midpoint of a timestep, the weights are only computed once.  Cached weights
+ * are associated with the Lagrangian position array, the kernel function, and
+ * the patch data geometry (which accounts for the data centering).  Because the
+ * position of each point is stored along with its weights, the weights of
+ * points that have moved are recomputed automatically and the cache never
+ * yields stale values.  The cache should be cleared via clearWeightCache()
+ * whenever the position data are deallocated or redistributed.  Each access to
+ * the cache entry of a patch is recorded by the timer
+ * "IBTK::LEInteractor::interpolate()[cache_hit]" (or "spread()[cache_hit]") if
+ * the stencils and weights of all of the points are loaded from the cache, and
+ * by "IBTK::LEInteractor::interpolate()[cache_miss]" (or
+ * "spread()[cache_miss]") otherwise.
+ *
+ * Configuration options read by setFromDatabase():
+ *
+ * - \p spread_mode: one of "SERIAL" (default), "COLORED", or "REPLICATED"
+ * - \p min_points_per_spread_thread: the minimum number of Lagrangian points
+ *   per thread required for a patch to be spread by multiple threads (default
+ *   256)
+ * - \p use_fortran_kernels: whether to use the Fortran implementations of the
+ *   standard kernel functions (default FALSE)
+ * - \p use_weight_cache: whether to cache the stencils and weights of the
+ *   Lagrangian points (default FALSE)
  */
 class LEInteractor
 {
@@ -130,6 +178,47 @@ public:
      */
     static int getMinimumGhostWidth(const std::string& kernel_fcn);
 
+    /*!
+     * \brief Set the algorithm used to spread Lagrangian values to Eulerian
+     * grid patches.
+     */
+    static void setSpreadingMode(SpreadingMode spread_mode);
+
+    /*!
+     * \brief Return the algorithm used to spread Lagrangian values to Eulerian
+     * grid patches.
+     */
+    static SpreadingMode getSpreadingMode();
+
+    /*!
+     * \brief Set whether the standard kernel functions are evaluated by the
+     * Fortran implementations instead of the C++ implementations.
+     */
+    static void setUseFortranKernels(bool use_fortran_kernels);
+
+    /*!
+     * \brief Return whether the standard kernel functions are evaluated by the
+     * Fortran implementations instead of the C++ implementations.
+     */
+    static bool getUseFortranKernels();
+
+    /*!
+     * \brief Set whether the stencils and weights of the Lagrangian points are
+     * cached and reused by subsequent interpolation and spreading operations.
+     */
+    static void setUseWeightCache(bool use_weight_cache);
+
+    /*!
+     * \brief Return whether the stencils and weights of the Lagrangian points
+     * are cached.
+     */
+    static bool getUseWeightCache();
+
+    /*!
+     * \brief Deallocate all cached stencils and weights.
+     */
+    static void clearWeightCache();
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1054,6 +1143,10 @@ public:
      * implemented operations spreads values, NOT densities.
      *
      * \warning This method does \em not support periodic offsets for positions.
+     *
+     * \note The spreading algorithm is specified by \a spread_mode.  If \a
+     * spread_mode is UNKNOWN_SPREADING_MODE, the algorithm set by
+     * setSpreadingMode() is used.
      */
     static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
                        const double* Q_data,
@@ -1064,7 +1157,8 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       SpreadingMode spread_mode = UNKNOWN_SPREADING_MODE);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -1113,6 +1207,10 @@ public:
      * implemented operations spreads values, NOT densities.
      *
      * \warning This method does \em not support periodic offsets for positions.
+     *
+     * \note The spreading algorithm is specified by \a spread_mode.  If \a
+     * spread_mode is UNKNOWN_SPREADING_MODE, the algorithm set by
+     * setSpreadingMode() is used.
      */
     static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
                        const double* Q_data,
@@ -1123,7 +1221,8 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       SpreadingMode spread_mode = UNKNOWN_SPREADING_MODE);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -1142,6 +1241,10 @@ public:
      * implemented operations spreads values, NOT densities.
      *
      * \warning This method does \em not support periodic offsets for positions.
+     *
+     * \note The spreading algorithm is specified by \a spread_mode.  If \a
+     * spread_mode is UNKNOWN_SPREADING_MODE, the algorithm set by
+     * setSpreadingMode() is used.
      */
     static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
                        const double* Q_data,
@@ -1152,7 +1255,8 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       SpreadingMode spread_mode = UNKNOWN_SPREADING_MODE);
 
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
@@ -1201,6 +1305,10 @@ public:
      * implemented operations spreads values, NOT densities.
      *
      * \warning This method does \em not support periodic offsets for positions.
+     *
+     * \note The spreading algorithm is specified by \a spread_mode.  If \a
+     * spread_mode is UNKNOWN_SPREADING_MODE, the algorithm set by
+     * setSpreadingMode() is used.
      */
     static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
                        const double* Q_data,
@@ -1211,7 +1319,8 @@ public:
                        int X_depth,
                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                        const SAMRAI::hier::Box<NDIM>& spread_box,
-                       const std::string& spread_fcn = "IB_4");
+                       const std::string& spread_fcn = "IB_4",
+                       SpreadingMode spread_mode = UNKNOWN_SPREADING_MODE);
 
 private:
     /*!
@@ -1286,7 +1395,73 @@ private:
                        const std::vector<int>& local_indices,
                        const std::vector<double>& periodic_shifts,
                        const std::string& spread_fcn,
-                       int axis = 0);
+                       int axis = 0,
+                       SpreadingMode spread_mode = UNKNOWN_SPREADING_MODE);
+
+    /*!
+     * Apply the specified spreading kernel to a list of Lagrangian points.
+     * This routine does not perform any error checking and is used both by
+     * serial and by threaded spreading.
+     *
+     * When weight_cache_id is nonnegative, it identifies the weight cache entry
+     * of the patch, and the cache slot of the l-th point is
+     * weight_cache_slots[l] (or l if weight_cache_slots is NULL).
+     */
+    static void spreadPoints(double* q_data,
+                             const SAMRAI::hier::Box<NDIM>& q_data_box,
+                             const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                             int q_depth,
+                             const double* Q_data,
+                             int Q_depth,
+                             const double* X_data,
+                             const double* x_lower,
+                             const double* x_upper,
+                             const double* dx,
+                             const int* local_indices,
+                             const double* periodic_shifts,
+                             int num_local_indices,
+                             const std::string& spread_fcn,
+                             int axis,
+                             int weight_cache_id,
+                             const int* weight_cache_slots);
+
+    /*!
+     * Implementation of COLORED_SPREADING.
+     */
+    static void spreadColored(double* q_data,
+                              const SAMRAI::hier::Box<NDIM>& q_data_box,
+                              const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                              int q_depth,
+                              const double* Q_data,
+                              int Q_depth,
+                              const double* X_data,
+                              const double* x_lower,
+                              const double* x_upper,
+                              const double* dx,
+                              const std::vector<int>& local_indices,
+                              const std::vector<double>& periodic_shifts,
+                              const std::string& spread_fcn,
+                              int axis,
+                              int weight_cache_id);
+
+    /*!
+     * Implementation of REPLICATED_SPREADING.
+     */
+    static void spreadReplicated(double* q_data,
+                                 const SAMRAI::hier::Box<NDIM>& q_data_box,
+                                 const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                                 int q_depth,
+                                 const double* Q_data,
+                                 int Q_depth,
+                                 const double* X_data,
+                                 const double* x_lower,
+                                 const double* x_upper,
+                                 const double* dx,
+                                 const std::vector<int>& local_indices,
+                                 const std::vector<double>& periodic_shifts,
+                                 const std::string& spread_fcn,
+                                 int axis,
+                                 int weight_cache_id);
 
     /*!
      * \brief Compute the local PETSc indices located within the provided box
@@ -1345,6 +1520,22 @@ private:
                                   const int* local_indices,
                                   const double* X_shift,
                                   int num_local_indices);
+
+    /*!
+     * Spreading configuration options.
+     */
+    static SpreadingMode s_spread_mode;
+    static int s_min_points_per_spread_thread;
+
+    /*!
+     * Whether to use the Fortran kernel implementations.
+     */
+    static bool s_use_fortran_kernels;
+
+    /*!
+     * Whether to cache the stencils and weights of the Lagrangian points.
+     */
+    static bool s_use_weight_cache;
 };
 } // namespace IBTK
 
@@ -40,6 +40,7 @@
 #include "Box.h"
 #include "IntVector.h"
 #include "ibtk/LSetData.h"
+#include "ibtk/ibtk_enums.h"
 #include "tbox/Pointer.h"
 
 namespace SAMRAI
@@ -81,9 +82,15 @@ public:
 
     /*!
      * \brief Update the cached indexing data.
+     *
+     * The cached indices are ordered according to \p node_ordering.  With
+     * MORTON_NODE_ORDERING, the indices are sorted by the Morton index of the
+     * cell that contains each node, and nodes in the same cell retain their
+     * relative order.
      */
     void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           LNodeOrderingType node_ordering = NATURAL_NODE_ORDERING);
 
     /*!
      * \return A constant reference to the set of Lagrangian data indices that
@@ -38,6 +38,7 @@
 #include <stddef.h>
 
 #include "IntVector.h"
+#include "ibtk/LObjectPool.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/DescribedClass.h"
 
@@ -90,6 +91,18 @@ public:
      */
     ~LMarker();
 
+    /*!
+     * \brief Allocate storage for an LMarker from a pool of LMarker objects.
+     *
+     * \see LObjectPool
+     */
+    static void* operator new(size_t size);
+
+    /*!
+     * \brief Return storage to the pool of LMarker objects.
+     */
+    static void operator delete(void* ptr, size_t size);
+
     /*!
      * \brief Assignment operator.
      *
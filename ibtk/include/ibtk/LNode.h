@@ -40,6 +40,7 @@
 
 #include "IntVector.h"
 #include "ibtk/LNodeIndex.h"
+#include "ibtk/LObjectPool.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Pointer.h"
@@ -104,6 +105,18 @@ public:
      */
     ~LNode();
 
+    /*!
+     * \brief Allocate storage for an LNode from a pool of LNode objects.
+     *
+     * \see LObjectPool
+     */
+    static void* operator new(size_t size);
+
+    /*!
+     * \brief Return storage to the pool of LNode objects.
+     */
+    static void operator delete(void* ptr, size_t size);
+
     /*!
      * \brief Assignment operator.
      *
@@ -41,6 +41,7 @@
 
 #include "IntVector.h"
 #include "boost/multi_array.hpp"
+#include "ibtk/LObjectPool.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/MathUtilities.h"
@@ -99,6 +100,18 @@ public:
      */
     virtual ~LNodeIndex();
 
+    /*!
+     * \brief Allocate storage for an LNodeIndex from a pool of LNodeIndex objects.
+     *
+     * \see LObjectPool
+     */
+    static void* operator new(size_t size);
+
+    /*!
+     * \brief Return storage to the pool of LNodeIndex objects.
+     */
+    static void operator delete(void* ptr, size_t size);
+
     /*!
      * \brief Assignment operator.
      *
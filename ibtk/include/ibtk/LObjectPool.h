@@ -0,0 +1,172 @@
+// Filename: LObjectPool.h
+// Created on 16 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LObjectPool
+#define included_IBTK_LObjectPool
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <new>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LObjectPool provides pooled storage for small, frequently
+ * allocated Lagrangian objects such as LNode, LMarker and LSet.
+ *
+ * Memory is obtained from the global heap in large chunks, each of which is
+ * carved into fixed-size blocks that are recycled through a free list.  Blocks
+ * taken from a new chunk are handed out in address order, so that objects that
+ * are allocated together (e.g., the nodes unpacked into a single LSet) are
+ * stored contiguously.  Chunks are retained for reuse at subsequent regrids
+ * until releaseUnusedChunks() is called, which returns every chunk that holds no
+ * live objects to the global heap.  LDataManager calls releaseUnusedChunks()
+ * for the pooled node types at the end of each data redistribution, so that the
+ * memory held by the pool tracks the current number of nodes rather than the
+ * peak number of nodes.
+ *
+ * Classes that use the pool define class-specific versions of operator new and
+ * operator delete that call allocate() and deallocate().  Requests whose size
+ * does not match the pooled type (e.g., allocations of derived classes) are
+ * forwarded to the global heap.
+ *
+ * \note The pool is not thread safe.  Lagrangian objects must not be allocated
+ * or freed concurrently from multiple threads.
+ */
+template <class T>
+class LObjectPool
+{
+public:
+    /*!
+     * \brief Allocate storage for an object of the specified size.
+     */
+    static void* allocate(size_t size);
+
+    /*!
+     * \brief Release storage obtained from allocate().
+     */
+    static void deallocate(void* ptr, size_t size);
+
+    /*!
+     * \brief Return every chunk that holds no live objects to the global heap
+     * and reorder the free list of the remaining chunks by address.
+     *
+     * \return The number of chunks that were released.
+     */
+    static size_t releaseUnusedChunks();
+
+    /*!
+     * \brief Return the number of chunks currently held by the pool.
+     */
+    static size_t getNumberOfChunks();
+
+    /*!
+     * \brief Return the number of blocks in each chunk.
+     */
+    static size_t getNumberOfBlocksPerChunk();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LObjectPool();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LObjectPool(const LObjectPool& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LObjectPool& operator=(const LObjectPool& that);
+
+    /*!
+     * \brief Carve a new chunk of memory into blocks and add them to the free
+     * list.
+     */
+    static void allocateChunk();
+
+    /*!
+     * \brief A free block of memory.
+     */
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    /*!
+     * \brief The size of each block, which is rounded up so that every block
+     * satisfies the alignment requirements of vectorized Eigen types.
+     */
+    static const size_t BLOCK_SIZE = ((sizeof(T) > sizeof(FreeBlock) ? sizeof(T) : sizeof(FreeBlock)) + 15) / 16 * 16;
+
+    /*!
+     * \brief The number of blocks in each chunk.
+     */
+    static const size_t BLOCKS_PER_CHUNK = 1024;
+
+    /*!
+     * \brief The head of the free list.
+     */
+    static FreeBlock* s_free_list;
+
+    /*!
+     * \brief The chunks held by the pool, sorted by address.
+     */
+    static std::vector<char*> s_chunks;
+};
+} // namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+#include "ibtk/private/LObjectPool-inl.h" // IWYU pragma: keep
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LObjectPool
@@ -42,6 +42,7 @@
 #include "ibtk/LMarker.h"
 #include "ibtk/LNode.h"
 #include "ibtk/LNodeIndex.h"
+#include "ibtk/LObjectPool.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
@@ -133,6 +134,18 @@ public:
      */
     ~LSet();
 
+    /*!
+     * \brief Allocate storage for an LSet from a pool of LSet objects.
+     *
+     * \see LObjectPool
+     */
+    static void* operator new(size_t size);
+
+    /*!
+     * \brief Return storage to the pool of LSet objects.
+     */
+    static void operator delete(void* ptr, size_t size);
+
     /*!
      * \brief Assignment operator.
      *
@@ -369,6 +369,68 @@ public:
                  int m = 0,
                  int n = 0) const;
 
+    /*!
+     * \brief Computes dst_l = alpha L src1_m + beta src1_m on the cells of the
+     * patch at which the stencil does not use the ghost cell values of src1.
+     *
+     * Uses the standard 5 point stencil in 2D (7 point stencil in 3D).  Together
+     * with laplaceOnBoundaryStrip(), this computes the same values as laplace()
+     * with gamma = 0, but it allows the interior values to be computed while the
+     * ghost cell values of src1 are still being filled.
+     */
+    void laplaceOnInterior(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dst,
+                           double alpha,
+                           double beta,
+                           SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src1,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           int l = 0,
+                           int m = 0) const;
+
+    /*!
+     * \brief Computes dst_l = alpha L src1_m + beta src1_m on the sides of the
+     * patch at which the stencil does not use the ghost cell values of src1.
+     *
+     * Uses the standard 5 point stencil in 2D (7 point stencil in 3D).  Together
+     * with laplaceOnBoundaryStrip(), this computes the same values as laplace()
+     * with gamma = 0, but it allows the interior values to be computed while the
+     * ghost cell values of src1 are still being filled.
+     */
+    void laplaceOnInterior(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dst,
+                           double alpha,
+                           double beta,
+                           SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src1,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           int l = 0,
+                           int m = 0) const;
+
+    /*!
+     * \brief Computes dst_l = alpha L src1_m + beta src1_m on the cells of the
+     * patch that are not treated by laplaceOnInterior().
+     *
+     * The ghost cell values of src1 must be filled before calling this method.
+     */
+    void laplaceOnBoundaryStrip(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dst,
+                                double alpha,
+                                double beta,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src1,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                int l = 0,
+                                int m = 0) const;
+
+    /*!
+     * \brief Computes dst_l = alpha L src1_m + beta src1_m on the sides of the
+     * patch that are not treated by laplaceOnInterior().
+     *
+     * The ghost cell values of src1 must be filled before calling this method.
+     */
+    void laplaceOnBoundaryStrip(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dst,
+                                double alpha,
+                                double beta,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src1,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                int l = 0,
+                                int m = 0) const;
+
     /*!
      * \brief Computes dst_l = div alpha grad src1_m + beta src1_m + gamma
      * src2_n.
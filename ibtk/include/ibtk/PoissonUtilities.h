@@ -46,6 +46,8 @@ namespace SAMRAI
 namespace hier
 {
 template <int DIM>
+class Box;
+template <int DIM>
 class Index;
 template <int DIM>
 class Patch;
@@ -53,6 +55,8 @@ class Patch;
 namespace pdat
 {
 template <int DIM, class TYPE>
+class ArrayData;
+template <int DIM, class TYPE>
 class CellData;
 template <int DIM, class TYPE>
 class SideData;
@@ -174,6 +178,31 @@ public:
                                   const SAMRAI::solv::PoissonSpecifications& poisson_spec,
                                   const SAMRAI::tbox::Array<SAMRAI::hier::BoundaryBox<NDIM> >& type1_cf_bdry);
 
+    /*!
+     * Perform a single "red" (red_or_black = 0) or "black" (red_or_black = 1)
+     * Gauss-Seidel sweep for F = alpha div grad U + beta U on the cells of the
+     * specified box, using the standard 2*NDIM+1 point stencil.
+     *
+     * All depths of the array data are smoothed in one pass.  Because cells of
+     * the same color are decoupled, each sweep is distributed over the rows of
+     * the box by OpenMP when it is enabled; the result does not depend on the
+     * number of threads.  When a mask is provided, U is left unmodified at
+     * degrees of freedom at which the mask is nonzero.
+     *
+     * \note This is a C++ implementation of the Fortran kernels rbgssmooth2d,
+     * rbgssmooth3d, rbgssmoothmask2d, and rbgssmoothmask3d, which remain the
+     * reference implementations.  The coloring uses the parity of i0+...+iNDIM-1
+     * also for negative cell indices.
+     */
+    static void redBlackGaussSeidelSweep(SAMRAI::pdat::ArrayData<NDIM, double>& U_data,
+                                         const SAMRAI::pdat::ArrayData<NDIM, double>& F_data,
+                                         const SAMRAI::hier::Box<NDIM>& box,
+                                         double alpha,
+                                         double beta,
+                                         const double* dx,
+                                         int red_or_black,
+                                         const SAMRAI::pdat::ArrayData<NDIM, int>* mask_data = NULL);
+
 protected:
 private:
     /*!
@@ -150,6 +150,12 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "THREADED_RED_BLACK_GAUSS_SEIDEL"
+     *
+     * \note \c "THREADED_RED_BLACK_GAUSS_SEIDEL" performs the same red-black
+     * sweeps as \c "RED_BLACK_GAUSS_SEIDEL" using
+     * PoissonUtilities::redBlackGaussSeidelSweep(), which smooths all data
+     * depths in one pass and distributes each sweep over OpenMP threads.
      */
     void setSmootherType(const std::string& smoother_type);
 
@@ -134,6 +134,89 @@ enum_to_string<RegridMode>(RegridMode val)
     return "UNKNOWN_REGRID_MODE";
 } // enum_to_string
 
+/*!
+ * \brief Enumerated type for different Lagrangian-to-Eulerian spreading
+ * algorithms.
+ *
+ * SERIAL_SPREADING scatters the Lagrangian values one point at a time.
+ * COLORED_SPREADING bins the points by Cartesian grid cell and colors the bins
+ * so that bins of the same color have non-overlapping kernel supports; bins of
+ * the same color are then spread concurrently.  The summation order does not
+ * depend on the number of threads, so that results are bitwise reproducible.
+ * REPLICATED_SPREADING spreads into thread-private copies of the patch data
+ * that are summed afterwards; it is typically faster for very dense point
+ * distributions, but the summation order depends on the number of threads.
+ */
+enum SpreadingMode
+{
+    SERIAL_SPREADING,
+    COLORED_SPREADING,
+    REPLICATED_SPREADING,
+    UNKNOWN_SPREADING_MODE = -1
+};
+
+template <>
+inline SpreadingMode
+string_to_enum<SpreadingMode>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "SERIAL") == 0) return SERIAL_SPREADING;
+    if (strcasecmp(val.c_str(), "SERIAL_SPREADING") == 0) return SERIAL_SPREADING;
+    if (strcasecmp(val.c_str(), "COLORED") == 0) return COLORED_SPREADING;
+    if (strcasecmp(val.c_str(), "COLORED_SPREADING") == 0) return COLORED_SPREADING;
+    if (strcasecmp(val.c_str(), "DETERMINISTIC") == 0) return COLORED_SPREADING;
+    if (strcasecmp(val.c_str(), "REPLICATED") == 0) return REPLICATED_SPREADING;
+    if (strcasecmp(val.c_str(), "REPLICATED_SPREADING") == 0) return REPLICATED_SPREADING;
+    return UNKNOWN_SPREADING_MODE;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<SpreadingMode>(SpreadingMode val)
+{
+    if (val == SERIAL_SPREADING) return "SERIAL_SPREADING";
+    if (val == COLORED_SPREADING) return "COLORED_SPREADING";
+    if (val == REPLICATED_SPREADING) return "REPLICATED_SPREADING";
+    return "UNKNOWN_SPREADING_MODE";
+} // enum_to_string
+
+/*!
+ * \brief Enumerated type for different orderings of the Lagrangian nodes that
+ * are associated with a patch.
+ *
+ * NATURAL_NODE_ORDERING leaves the nodes in the order in which they are stored
+ * in the patch data.  MORTON_NODE_ORDERING sorts the nodes by the Morton
+ * (Z-order) index of the Cartesian grid cell that contains each node, so that
+ * consecutive nodes access nearby Eulerian data during interpolation and
+ * spreading.
+ */
+enum LNodeOrderingType
+{
+    NATURAL_NODE_ORDERING,
+    MORTON_NODE_ORDERING,
+    UNKNOWN_NODE_ORDERING = -1
+};
+
+template <>
+inline LNodeOrderingType
+string_to_enum<LNodeOrderingType>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "NATURAL") == 0) return NATURAL_NODE_ORDERING;
+    if (strcasecmp(val.c_str(), "NATURAL_NODE_ORDERING") == 0) return NATURAL_NODE_ORDERING;
+    if (strcasecmp(val.c_str(), "MORTON") == 0) return MORTON_NODE_ORDERING;
+    if (strcasecmp(val.c_str(), "MORTON_NODE_ORDERING") == 0) return MORTON_NODE_ORDERING;
+    if (strcasecmp(val.c_str(), "Z_ORDER") == 0) return MORTON_NODE_ORDERING;
+    return UNKNOWN_NODE_ORDERING;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<LNodeOrderingType>(LNodeOrderingType val)
+{
+    if (val == NATURAL_NODE_ORDERING) return "NATURAL_NODE_ORDERING";
+    if (val == MORTON_NODE_ORDERING) return "MORTON_NODE_ORDERING";
+    return "UNKNOWN_NODE_ORDERING";
+} // enum_to_string
+
 /*!
  * \brief Enumerated type for different standard data contexts.
  */
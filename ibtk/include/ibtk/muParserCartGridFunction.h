@@ -40,6 +40,7 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "PatchLevel.h"
 #include "boost/array.hpp"
@@ -72,6 +73,14 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * The functions are evaluated in bulk over entire patch boxes.  When IBTK is
+ * compiled with OpenMP support, sufficiently large patch boxes are split into
+ * contiguous chunks that are evaluated concurrently by thread-private copies of
+ * the parsers.  Functions that do not depend on the position or time variables
+ * are evaluated only once per patch box, and the values of functions that do
+ * not depend on the time variable are cached (up to a fixed number of values)
+ * so that they are re-evaluated only after the patch hierarchy changes.
  */
 class muParserCartGridFunction : public CartGridFunction
 {
@@ -141,6 +150,73 @@ private:
      */
     muParserCartGridFunction& operator=(const muParserCartGridFunction& that);
 
+    /*!
+     * \brief Data centerings supported by the function.
+     */
+    enum DataCentering
+    {
+        CELL_CENTERING,
+        FACE_CENTERING,
+        NODE_CENTERING,
+        SIDE_CENTERING
+    };
+
+    /*!
+     * \brief Return the values of the function with index \a function_depth at
+     * the indices of the patch box (with the specified centering and axis) in
+     * the order in which they are visited by the corresponding SAMRAI iterator.
+     */
+    const std::vector<double>& evaluateFunction(int function_depth,
+                                                DataCentering centering,
+                                                unsigned int axis,
+                                                const SAMRAI::hier::Box<NDIM>& patch_box,
+                                                const double* x_lower,
+                                                const double* dx,
+                                                double data_time);
+
+    /*!
+     * \brief Evaluate the function with index \a function_depth at the first \a
+     * size positions stored in the bulk evaluation buffers.
+     */
+    void evaluateBulk(int function_depth, double* values, int size);
+
+    /*!
+     * \brief Ensure that the bulk evaluation buffers can hold at least \a size
+     * values.
+     */
+    void resizeParserBuffers(int size);
+
+    /*!
+     * \brief Bind the time and position variables of \a parser to the bulk
+     * evaluation buffers, starting at the specified offset.
+     */
+    void defineParserVariables(mu::Parser& parser, int offset);
+
+    /*!
+     * \brief Key identifying the values of a function on a particular patch
+     * box.
+     */
+    struct FunctionCacheKey
+    {
+        bool operator<(const FunctionCacheKey& that) const;
+
+        int function_depth;
+        DataCentering centering;
+        unsigned int axis;
+        SAMRAI::hier::Box<NDIM> patch_box;
+        double x_lower[NDIM], dx[NDIM];
+    };
+
+    /*!
+     * \brief Cached function values, along with the time at which they were
+     * evaluated.
+     */
+    struct FunctionCacheEntry
+    {
+        std::vector<double> values;
+        double time;
+    };
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -164,10 +240,30 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * Thread-private copies of the mu::Parser objects.
+     */
+    std::vector<mu::Parser> d_thread_parsers;
+
+    /*!
+     * Whether the data-setting functions depend on the position or time
+     * variables.
+     */
+    std::vector<bool> d_function_is_constant;
+    std::vector<bool> d_function_is_time_dependent;
+
+    /*!
+     * Time and position buffers used for bulk evaluation of the data-setting
+     * functions.
+     */
+    std::vector<double> d_parser_time;
+    std::vector<double> d_parser_posn[NDIM];
+
+    /*!
+     * Cached function values.
      */
-    double d_parser_time;
-    Point d_parser_posn;
+    std::map<FunctionCacheKey, FunctionCacheEntry> d_function_cache;
+    size_t d_num_cached_values;
+    std::vector<double> d_function_values;
 };
 } // namespace IBTK
 
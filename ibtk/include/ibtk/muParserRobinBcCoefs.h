@@ -39,7 +39,9 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
 #include "CartesianGridGeometry.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "RobinBcCoefStrategy.h"
 #include "muParser.h"
@@ -77,6 +79,15 @@ namespace IBTK
  * SAMRAI::solv::RobinBcCoefStrategy that allows for the run-time specification
  * of (possibly spatially- and temporally-varying) Robin boundary conditions.
  *
+ * The coefficients are evaluated in bulk over entire boundary boxes and are
+ * cached.  Expressions that do not depend on the time variable are evaluated
+ * only once for each boundary box, i.e., once per regrid, whereas
+ * time-dependent expressions are re-evaluated only when setBcCoefs() is called
+ * with a new fill time.  The number of cache hits and misses is recorded by the
+ * timers "IBTK::muParserRobinBcCoefs::setBcCoefs()[cache_hit]" and
+ * "IBTK::muParserRobinBcCoefs::setBcCoefs()[cache_miss]", and it is written to
+ * the log file when the object is destroyed.
+ *
  * \warning Not all linear solvers in IBTK properly handle time-varying \em
  * homogeneous Robin boundary condition coefficients.  Note, however, that all
  * linear solvers in IBTK are presently designed to support spatially and
@@ -185,6 +196,50 @@ private:
      */
     muParserRobinBcCoefs& operator=(const muParserRobinBcCoefs& that);
 
+    /*!
+     * \brief Ensure that the bulk evaluation buffers can hold at least \a
+     * size values, redefining the parser variables if the buffers are
+     * reallocated.
+     */
+    void resizeParserBuffers(unsigned int size) const;
+
+    /*!
+     * \brief Evaluate the expression stored in \a parser at the first \a size
+     * positions stored in the bulk evaluation buffers.
+     */
+    void evaluateParser(mu::Parser& parser, double* values, unsigned int size) const;
+
+    /*!
+     * \brief Key identifying the boundary coefficient data for a particular
+     * boundary box.
+     *
+     * Together, the patch lower index, the physical coordinates of the patch
+     * lower corner, and the grid spacing uniquely determine the positions at
+     * which the coefficients are evaluated.
+     */
+    struct BcCoefCacheKey
+    {
+        bool operator<(const BcCoefCacheKey& that) const;
+
+        unsigned int location_index;
+        SAMRAI::hier::Box<NDIM> bc_coef_box;
+        SAMRAI::hier::Index<NDIM> patch_lower;
+        double x_lower[NDIM], dx[NDIM];
+    };
+
+    /*!
+     * \brief Cached values of the a, b, and g coefficients, along with the
+     * times at which the coefficients were evaluated.
+     */
+    struct BcCoefCacheEntry
+    {
+        BcCoefCacheEntry();
+
+        std::vector<double> values[3];
+        double time[3];
+        bool valid[3];
+    };
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -207,15 +262,29 @@ private:
     /*!
      * The mu::Parser objects which evaluate the data-setting functions.
      */
-    std::vector<mu::Parser> d_acoef_parsers;
-    std::vector<mu::Parser> d_bcoef_parsers;
-    std::vector<mu::Parser> d_gcoef_parsers;
+    mutable std::vector<mu::Parser> d_acoef_parsers;
+    mutable std::vector<mu::Parser> d_bcoef_parsers;
+    mutable std::vector<mu::Parser> d_gcoef_parsers;
+
+    /*!
+     * Whether the data-setting functions depend on the time variable.
+     */
+    std::vector<bool> d_acoef_time_dependent;
+    std::vector<bool> d_bcoef_time_dependent;
+    std::vector<bool> d_gcoef_time_dependent;
+
+    /*!
+     * Time and position buffers used for bulk evaluation of the data-setting
+     * functions.
+     */
+    mutable std::vector<double> d_parser_time;
+    mutable std::vector<double> d_parser_posn[NDIM];
 
     /*!
-     * Time and position variables.
+     * Cached boundary coefficient data and cache statistics.
      */
-    double* d_parser_time;
-    Point* d_parser_posn;
+    mutable std::map<BcCoefCacheKey, BcCoefCacheEntry> d_bc_coef_cache;
+    mutable unsigned long d_num_cache_hits, d_num_cache_misses;
 };
 } // namespace IBTK
 
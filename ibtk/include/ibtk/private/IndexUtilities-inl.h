@@ -63,6 +63,22 @@ IndexUtilities::refine(const SAMRAI::hier::Index<NDIM>& i_coarse, const SAMRAI::
     return i_coarse * ratio;
 } // refine
 
+inline unsigned long
+IndexUtilities::getMortonIndex(const SAMRAI::hier::Index<NDIM>& i, const SAMRAI::hier::Index<NDIM>& ilower)
+{
+    static const unsigned int NBITS = (8 * sizeof(unsigned long)) / NDIM;
+    unsigned long key = 0;
+    for (unsigned int b = 0; b < NBITS; ++b)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const unsigned long offset = static_cast<unsigned long>(i(d) - ilower(d));
+            key |= ((offset >> b) & 1UL) << (NDIM * b + d);
+        }
+    }
+    return key;
+} // getMortonIndex
+
 template <class DoubleArray>
 inline SAMRAI::hier::Index<NDIM>
 IndexUtilities::getCellIndex(const DoubleArray& X,
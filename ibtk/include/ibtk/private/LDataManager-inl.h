@@ -62,6 +62,24 @@ LDataManager::getDefaultSpreadKernelFunction() const
     return d_default_spread_kernel_fcn;
 } // getDefaultSpreadKernelFunction
 
+inline LNodeOrderingType
+LDataManager::getNodeOrdering() const
+{
+    return d_node_ordering;
+} // getNodeOrdering
+
+inline bool
+LDataManager::getPermuteLagrangianData() const
+{
+    return d_permute_lag_data;
+} // getPermuteLagrangianData
+
+inline bool
+LDataManager::getIncrementalRedistribution() const
+{
+    return d_incremental_redistribution;
+} // getIncrementalRedistribution
+
 inline bool
 LDataManager::levelContainsLagrangianData(const int level_number) const
 {
@@ -73,6 +73,17 @@ inline LMarker::~LMarker()
     return;
 } // ~LMarker
 
+inline void* LMarker::operator new(const size_t size)
+{
+    return LObjectPool<LMarker>::allocate(size);
+} // operator new
+
+inline void LMarker::operator delete(void* const ptr, const size_t size)
+{
+    LObjectPool<LMarker>::deallocate(ptr, size);
+    return;
+} // operator delete
+
 inline LMarker& LMarker::operator=(const LMarker& that)
 {
     if (this == &that) return *this; // check for self-assignment
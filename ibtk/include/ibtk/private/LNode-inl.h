@@ -88,6 +88,17 @@ inline LNode::~LNode()
     return;
 } // ~LNode
 
+inline void* LNode::operator new(const size_t size)
+{
+    return LObjectPool<LNode>::allocate(size);
+} // operator new
+
+inline void LNode::operator delete(void* const ptr, const size_t size)
+{
+    LObjectPool<LNode>::deallocate(ptr, size);
+    return;
+} // operator delete
+
 inline LNode& LNode::operator=(const LNode& that)
 {
     if (this != &that)
@@ -95,6 +95,17 @@ inline LNodeIndex::~LNodeIndex()
     return;
 } // ~LNodeIndex
 
+inline void* LNodeIndex::operator new(const size_t size)
+{
+    return LObjectPool<LNodeIndex>::allocate(size);
+} // operator new
+
+inline void LNodeIndex::operator delete(void* const ptr, const size_t size)
+{
+    LObjectPool<LNodeIndex>::deallocate(ptr, size);
+    return;
+} // operator delete
+
 inline LNodeIndex& LNodeIndex::operator=(const LNodeIndex& that)
 {
     if (this != &that)
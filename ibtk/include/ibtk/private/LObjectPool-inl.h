@@ -0,0 +1,170 @@
+// Filename: LObjectPool-inl.h
+// Created on 16 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LObjectPool_inl_h
+#define included_IBTK_LObjectPool_inl_h
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "ibtk/LObjectPool.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+template <class T>
+typename LObjectPool<T>::FreeBlock* LObjectPool<T>::s_free_list = NULL;
+
+template <class T>
+std::vector<char*> LObjectPool<T>::s_chunks;
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+template <class T>
+inline void*
+LObjectPool<T>::allocate(const size_t size)
+{
+    if (size != sizeof(T)) return ::operator new(size);
+    if (!s_free_list) allocateChunk();
+    FreeBlock* const block = s_free_list;
+    s_free_list = block->next;
+    return block;
+} // allocate
+
+template <class T>
+inline void
+LObjectPool<T>::deallocate(void* const ptr, const size_t size)
+{
+    if (!ptr) return;
+    if (size != sizeof(T))
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    FreeBlock* const block = static_cast<FreeBlock*>(ptr);
+    block->next = s_free_list;
+    s_free_list = block;
+    return;
+} // deallocate
+
+template <class T>
+size_t
+LObjectPool<T>::releaseUnusedChunks()
+{
+    // Determine which blocks of each chunk are on the free list.
+    const size_t num_chunks = s_chunks.size();
+    std::vector<size_t> num_free_blocks(num_chunks, 0);
+    std::vector<bool> block_is_free(num_chunks * BLOCKS_PER_CHUNK, false);
+    for (FreeBlock* block = s_free_list; block; block = block->next)
+    {
+        char* const ptr = reinterpret_cast<char*>(block);
+        const size_t chunk_num =
+            (std::upper_bound(s_chunks.begin(), s_chunks.end(), ptr, std::less<char*>()) - s_chunks.begin()) - 1;
+        const size_t block_num = (ptr - s_chunks[chunk_num]) / BLOCK_SIZE;
+        block_is_free[chunk_num * BLOCKS_PER_CHUNK + block_num] = true;
+        ++num_free_blocks[chunk_num];
+    }
+
+    // Release the unused chunks and rebuild the free list of the remaining
+    // chunks in address order, so that subsequent allocations are contiguous.
+    s_free_list = NULL;
+    size_t num_released_chunks = 0;
+    std::vector<char*> retained_chunks;
+    retained_chunks.reserve(num_chunks);
+    for (size_t chunk_num = num_chunks; chunk_num > 0; --chunk_num)
+    {
+        char* const chunk = s_chunks[chunk_num - 1];
+        if (num_free_blocks[chunk_num - 1] == BLOCKS_PER_CHUNK)
+        {
+            ::operator delete(chunk);
+            ++num_released_chunks;
+            continue;
+        }
+        retained_chunks.push_back(chunk);
+        for (size_t k = BLOCKS_PER_CHUNK; k > 0; --k)
+        {
+            if (!block_is_free[(chunk_num - 1) * BLOCKS_PER_CHUNK + k - 1]) continue;
+            FreeBlock* const block = reinterpret_cast<FreeBlock*>(chunk + (k - 1) * BLOCK_SIZE);
+            block->next = s_free_list;
+            s_free_list = block;
+        }
+    }
+    s_chunks.assign(retained_chunks.rbegin(), retained_chunks.rend());
+    return num_released_chunks;
+} // releaseUnusedChunks
+
+template <class T>
+inline size_t
+LObjectPool<T>::getNumberOfChunks()
+{
+    return s_chunks.size();
+} // getNumberOfChunks
+
+template <class T>
+inline size_t
+LObjectPool<T>::getNumberOfBlocksPerChunk()
+{
+    return BLOCKS_PER_CHUNK;
+} // getNumberOfBlocksPerChunk
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+template <class T>
+void
+LObjectPool<T>::allocateChunk()
+{
+    // NOTE: Memory returned by ::operator new is suitably aligned for any
+    // fundamental type, and each block size is a multiple of 16 bytes.
+    char* const chunk = static_cast<char*>(::operator new(BLOCKS_PER_CHUNK * BLOCK_SIZE));
+    s_chunks.insert(std::upper_bound(s_chunks.begin(), s_chunks.end(), chunk, std::less<char*>()), chunk);
+    for (size_t k = BLOCKS_PER_CHUNK; k > 0; --k)
+    {
+        FreeBlock* const block = reinterpret_cast<FreeBlock*>(chunk + (k - 1) * BLOCK_SIZE);
+        block->next = s_free_list;
+        s_free_list = block;
+    }
+    return;
+} // allocateChunk
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LObjectPool_inl_h
@@ -68,6 +68,19 @@ inline LSet<T>::~LSet()
     return;
 } // ~LSet
 
+template <class T>
+inline void* LSet<T>::operator new(const size_t size)
+{
+    return LObjectPool<LSet<T> >::allocate(size);
+} // operator new
+
+template <class T>
+inline void LSet<T>::operator delete(void* const ptr, const size_t size)
+{
+    LObjectPool<LSet<T> >::deallocate(ptr, size);
+    return;
+} // operator delete
+
 template <class T>
 inline LSet<T>& LSet<T>::operator=(const LSet<T>& that)
 {
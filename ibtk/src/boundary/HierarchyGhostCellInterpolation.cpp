@@ -38,6 +38,10 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxGeometry.h"
+#include "BoxOverlap.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -48,9 +52,12 @@
 #include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchGeometry.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "RefineAlgorithm.h"
 #include "RefineOperator.h"
 #include "RefinePatchStrategy.h"
@@ -71,9 +78,13 @@
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/AbstractStream.h"
 #include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Schedule.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
+#include "tbox/Transaction.h"
 #include "tbox/Utilities.h"
 
 namespace SAMRAI
@@ -106,6 +117,147 @@ static Timer* t_fill_data;
 static Timer* t_fill_data_coarsen;
 static Timer* t_fill_data_refine;
 static Timer* t_fill_data_set_physical_bcs;
+static Timer* t_begin_fill_data;
+static Timer* t_end_fill_data;
+
+// A transaction that copies values into the ghost cells of a patch from the
+// interior of another patch on the same level of the patch hierarchy, possibly
+// shifted by a periodic offset.  The data are copied for each of the
+// transaction components, and the overlaps are computed from the patch boxes,
+// so that both the sending and the receiving processors determine the same
+// message contents.
+class GhostCellCopyTransaction : public Transaction
+{
+public:
+    typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+
+    GhostCellCopyTransaction(Pointer<PatchLevel<NDIM> > level,
+                             const std::vector<InterpolationTransactionComponent>* transaction_comps,
+                             const int dst_patch_num,
+                             const int src_patch_num,
+                             const IntVector<NDIM>& src_offset)
+        : d_level(level),
+          d_transaction_comps(transaction_comps),
+          d_dst_patch_num(dst_patch_num),
+          d_src_patch_num(src_patch_num),
+          d_src_offset(src_offset),
+          d_dst_proc(level->getProcessorMapping().getProcessorAssignment(dst_patch_num)),
+          d_src_proc(level->getProcessorMapping().getProcessorAssignment(src_patch_num))
+    {
+        // intentionally blank
+        return;
+    } // GhostCellCopyTransaction
+
+    ~GhostCellCopyTransaction()
+    {
+        // intentionally blank
+        return;
+    } // ~GhostCellCopyTransaction
+
+    bool canEstimateIncomingMessageSize()
+    {
+        return false;
+    } // canEstimateIncomingMessageSize
+
+    int computeIncomingMessageSize()
+    {
+        return 0;
+    } // computeIncomingMessageSize
+
+    int computeOutgoingMessageSize()
+    {
+        Pointer<Patch<NDIM> > src_patch = d_level->getPatch(d_src_patch_num);
+        int size = 0;
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps->size(); ++comp_idx)
+        {
+            const int data_idx = (*d_transaction_comps)[comp_idx].d_dst_data_idx;
+            size += src_patch->getPatchData(data_idx)->getDataStreamSize(*computeOverlap(comp_idx));
+        }
+        return size;
+    } // computeOutgoingMessageSize
+
+    int getSourceProcessor()
+    {
+        return d_src_proc;
+    } // getSourceProcessor
+
+    int getDestinationProcessor()
+    {
+        return d_dst_proc;
+    } // getDestinationProcessor
+
+    void packStream(AbstractStream& stream)
+    {
+        Pointer<Patch<NDIM> > src_patch = d_level->getPatch(d_src_patch_num);
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps->size(); ++comp_idx)
+        {
+            const int data_idx = (*d_transaction_comps)[comp_idx].d_dst_data_idx;
+            src_patch->getPatchData(data_idx)->packStream(stream, *computeOverlap(comp_idx));
+        }
+        return;
+    } // packStream
+
+    void unpackStream(AbstractStream& stream)
+    {
+        Pointer<Patch<NDIM> > dst_patch = d_level->getPatch(d_dst_patch_num);
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps->size(); ++comp_idx)
+        {
+            const int data_idx = (*d_transaction_comps)[comp_idx].d_dst_data_idx;
+            dst_patch->getPatchData(data_idx)->unpackStream(stream, *computeOverlap(comp_idx));
+        }
+        return;
+    } // unpackStream
+
+    void copyLocalData()
+    {
+        Pointer<Patch<NDIM> > dst_patch = d_level->getPatch(d_dst_patch_num);
+        Pointer<Patch<NDIM> > src_patch = d_level->getPatch(d_src_patch_num);
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps->size(); ++comp_idx)
+        {
+            const int data_idx = (*d_transaction_comps)[comp_idx].d_dst_data_idx;
+            dst_patch->getPatchData(data_idx)->copy(*src_patch->getPatchData(data_idx), *computeOverlap(comp_idx));
+        }
+        return;
+    } // copyLocalData
+
+    void printClassData(std::ostream& stream) const
+    {
+        stream << "Ghost Cell Copy Transaction" << std::endl;
+        stream << "   source processor:        " << d_src_proc << std::endl;
+        stream << "   destination processor:   " << d_dst_proc << std::endl;
+        stream << "   source patch number:      " << d_src_patch_num << std::endl;
+        stream << "   destination patch number: " << d_dst_patch_num << std::endl;
+        stream << "   source offset:            " << d_src_offset << std::endl;
+        return;
+    } // printClassData
+
+private:
+    GhostCellCopyTransaction(const GhostCellCopyTransaction& from);
+    GhostCellCopyTransaction& operator=(const GhostCellCopyTransaction& that);
+
+    // Compute the overlap of the ghost cell region of the destination patch
+    // with the interior of the (shifted) source patch for the specified
+    // transaction component.
+    Pointer<BoxOverlap<NDIM> > computeOverlap(const unsigned int comp_idx) const
+    {
+        const InterpolationTransactionComponent& transaction_comp = (*d_transaction_comps)[comp_idx];
+        Pointer<PatchDataFactory<NDIM> > pdat_factory =
+            d_level->getPatchDescriptor()->getPatchDataFactory(transaction_comp.d_dst_data_idx);
+        const Box<NDIM>& dst_box = d_level->getBoxes()[d_dst_patch_num];
+        const Box<NDIM>& src_box = d_level->getBoxes()[d_src_patch_num];
+        Pointer<BoxGeometry<NDIM> > dst_geometry = pdat_factory->getBoxGeometry(dst_box);
+        Pointer<BoxGeometry<NDIM> > src_geometry = pdat_factory->getBoxGeometry(src_box);
+        const bool overwrite_interior = false;
+        return transaction_comp.d_fill_pattern->calculateOverlap(
+            *dst_geometry, *src_geometry, dst_box, src_box, overwrite_interior, d_src_offset);
+    } // computeOverlap
+
+    Pointer<PatchLevel<NDIM> > d_level;
+    const std::vector<InterpolationTransactionComponent>* const d_transaction_comps;
+    const int d_dst_patch_num, d_src_patch_num;
+    const IntVector<NDIM> d_src_offset;
+    const int d_dst_proc, d_src_proc;
+};
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -113,6 +265,8 @@ static Timer* t_fill_data_set_physical_bcs;
 HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
     : d_is_initialized(false),
       d_homogeneous_bc(false),
+      d_fill_data_in_progress(false),
+      d_fill_time(0.0),
       d_transaction_comps(),
       d_hierarchy(NULL),
       d_grid_geom(NULL),
@@ -124,6 +278,9 @@ HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
       d_refine_alg(NULL),
       d_refine_strategy(NULL),
       d_refine_scheds(),
+      d_ghost_exchange_sched(NULL),
+      d_ghost_exchange_width(0),
+      d_use_ghost_exchange_sched(false),
       d_cf_bdry_ops(),
       d_extrap_bc_ops(),
       d_cc_robin_bc_ops(),
@@ -147,7 +304,11 @@ HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
         t_fill_data_refine =
             TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::fillData()[refine]");
         t_fill_data_set_physical_bcs = TimerManager::getManager()->getTimer(
-            "IBTK::HierarchyGhostCellInterpolation::fillData()[set_physical_bcs]"););
+            "IBTK::HierarchyGhostCellInterpolation::fillData()[set_physical_bcs]");
+        t_begin_fill_data =
+            TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::beginFillData()");
+        t_end_fill_data =
+            TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::endFillData()"););
     return;
 } // HierarchyGhostCellInterpolation
 
@@ -351,6 +512,9 @@ HierarchyGhostCellInterpolation::initializeOperatorState(
         d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy);
     }
 
+    // Setup the cached schedule used to exchange ghost cell data asynchronously.
+    initializeGhostExchangeSchedule();
+
     // Setup physical BC type.
     setHomogeneousBc(d_homogeneous_bc);
 
@@ -389,6 +553,7 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
 
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_is_initialized);
+    TBOX_ASSERT(!d_fill_data_in_progress);
 #endif
     if (d_transaction_comps.size() != transaction_comps.size())
     {
@@ -397,6 +562,14 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
                       "interpolation transaction components.\n");
     }
 
+    // Nothing needs to be done if the transaction components are unchanged;
+    // in this case, the cached algorithms and schedules are reused as-is.
+    if (d_transaction_comps == transaction_comps)
+    {
+        IBTK_TIMER_STOP(t_reset_transaction_components);
+        return;
+    }
+
     // Reset the transaction components.
     d_transaction_comps = transaction_comps;
 
@@ -529,6 +702,11 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
         d_refine_alg->resetSchedule(d_refine_scheds[dst_ln]);
     }
 
+    // The cached ghost cell exchange schedule refers to the transaction
+    // components, so it needs to be rebuilt only if it is not able to fill the
+    // ghost cells of the new components.
+    d_use_ghost_exchange_sched = !d_ghost_exchange_sched.isNull() && canUseGhostExchangeSchedule();
+
     IBTK_TIMER_STOP(t_reset_transaction_components);
     return;
 } // resetTransactionComponents
@@ -570,6 +748,9 @@ HierarchyGhostCellInterpolation::deallocateOperatorState()
     d_refine_strategy = NULL;
     d_refine_scheds.clear();
 
+    d_ghost_exchange_sched.setNull();
+    d_use_ghost_exchange_sched = false;
+
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
 
@@ -582,9 +763,25 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
 {
     IBTK_TIMER_START(t_fill_data);
 
+    beginFillData(fill_time);
+    endFillData();
+
+    IBTK_TIMER_STOP(t_fill_data);
+    return;
+} // fillData
+
+void
+HierarchyGhostCellInterpolation::beginFillData(double fill_time)
+{
+    IBTK_TIMER_START(t_begin_fill_data);
+
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_is_initialized);
+    TBOX_ASSERT(!d_fill_data_in_progress);
 #endif
+    d_fill_data_in_progress = true;
+    d_fill_time = fill_time;
+
     // Ensure the boundary condition objects are in the correct state.
     for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
     {
@@ -592,6 +789,17 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
         if (d_sc_robin_bc_ops[comp_idx]) d_sc_robin_bc_ops[comp_idx]->setHomogeneousBc(d_homogeneous_bc);
     }
 
+    // Post the messages that exchange ghost cell data between patches.  The
+    // exchange is completed by endFillData().
+    if (d_use_ghost_exchange_sched)
+    {
+        IBTK_TIMER_START(t_fill_data_refine);
+        d_ghost_exchange_sched->beginCommunication();
+        IBTK_TIMER_STOP(t_fill_data_refine);
+        IBTK_TIMER_STOP(t_begin_fill_data);
+        return;
+    }
+
     // Synchronize data on the patch hierarchy prior to filling ghost cell
     // values.
     IBTK_TIMER_START(t_fill_data_coarsen);
@@ -625,6 +833,46 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
     }
     IBTK_TIMER_STOP(t_fill_data_refine);
 
+    IBTK_TIMER_STOP(t_begin_fill_data);
+    return;
+} // beginFillData
+
+void
+HierarchyGhostCellInterpolation::endFillData()
+{
+    IBTK_TIMER_START(t_end_fill_data);
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+    TBOX_ASSERT(d_fill_data_in_progress);
+#endif
+    const double fill_time = d_fill_time;
+
+    // Complete the exchange of ghost cell data between patches and use
+    // extrapolation to determine ghost cell values at physical boundaries, as
+    // is otherwise done by the refine schedules.
+    if (d_use_ghost_exchange_sched)
+    {
+        IBTK_TIMER_START(t_fill_data_refine);
+        d_ghost_exchange_sched->finalizeCommunication();
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            if (!patch->getPatchGeometry()->getTouchesRegularBoundary()) continue;
+            for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+            {
+                if (d_extrap_bc_ops[comp_idx])
+                {
+                    const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
+                    const IntVector<NDIM>& ghost_width_to_fill = patch->getPatchData(dst_data_idx)->getGhostCellWidth();
+                    d_extrap_bc_ops[comp_idx]->setPhysicalBoundaryConditions(*patch, fill_time, ghost_width_to_fill);
+                }
+            }
+        }
+        IBTK_TIMER_STOP(t_fill_data_refine);
+    }
+
     // Set Robin boundary conditions at physical boundaries.
     IBTK_TIMER_START(t_fill_data_set_physical_bcs);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
@@ -659,14 +907,107 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
     }
     IBTK_TIMER_STOP(t_fill_data_set_physical_bcs);
 
-    IBTK_TIMER_STOP(t_fill_data);
+    d_fill_data_in_progress = false;
+
+    IBTK_TIMER_STOP(t_end_fill_data);
     return;
-} // fillData
+} // endFillData
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+HierarchyGhostCellInterpolation::initializeGhostExchangeSchedule()
+{
+    d_ghost_exchange_sched.setNull();
+    d_use_ghost_exchange_sched = false;
+
+    // The exchange schedule only copies destination data between the patches
+    // of a single level that covers the physical domain.
+    if (d_coarsest_ln != 0 || d_finest_ln != 0 || !d_grid_geom->getDomainIsSingleBox()) return;
+    d_ghost_exchange_width = 0;
+    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+    {
+        const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+        d_ghost_exchange_width = IntVector<NDIM>::max(
+            d_ghost_exchange_width,
+            level->getPatchDescriptor()->getPatchDataFactory(dst_data_idx)->getDefaultGhostCellWidth());
+    }
+
+    // Determine the periodic shifts of the source patches.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+    const IntVector<NDIM>& periodic_shift = d_grid_geom->getPeriodicShift(level->getRatio());
+    std::vector<IntVector<NDIM> > src_offsets(1, IntVector<NDIM>(0));
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (periodic_shift(d) == 0) continue;
+        const size_t num_offsets = src_offsets.size();
+        for (size_t k = 0; k < num_offsets; ++k)
+        {
+            for (int sgn = -1; sgn <= 1; sgn += 2)
+            {
+                IntVector<NDIM> src_offset = src_offsets[k];
+                src_offset(d) = sgn * periodic_shift(d);
+                src_offsets.push_back(src_offset);
+            }
+        }
+    }
+
+    // Create a transaction for each pair of patches for which the (shifted)
+    // source patch may provide ghost cell values for the destination patch.
+    // Both processors of each pair create the transactions in the same order.
+    // The ghost cell region is grown by one cell to account for the values
+    // that are located on the patch boundaries.
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    const ProcessorMapping& mapping = level->getProcessorMapping();
+    const int num_patches = level->getNumberOfPatches();
+    d_ghost_exchange_sched = new Schedule();
+    for (int dst_patch_num = 0; dst_patch_num < num_patches; ++dst_patch_num)
+    {
+        const bool dst_is_local = mapping.getProcessorAssignment(dst_patch_num) == mpi_rank;
+        const Box<NDIM> dst_ghost_box = Box<NDIM>::grow(boxes[dst_patch_num], d_ghost_exchange_width + 1);
+        for (int src_patch_num = 0; src_patch_num < num_patches; ++src_patch_num)
+        {
+            const bool src_is_local = mapping.getProcessorAssignment(src_patch_num) == mpi_rank;
+            if (!dst_is_local && !src_is_local) continue;
+            for (unsigned int k = 0; k < src_offsets.size(); ++k)
+            {
+                if (src_patch_num == dst_patch_num && src_offsets[k] == IntVector<NDIM>(0)) continue;
+                const Box<NDIM> src_box = Box<NDIM>::shift(boxes[src_patch_num], src_offsets[k]);
+                if (!dst_ghost_box.intersects(src_box)) continue;
+                d_ghost_exchange_sched->appendTransaction(new GhostCellCopyTransaction(
+                    level, &d_transaction_comps, dst_patch_num, src_patch_num, src_offsets[k]));
+            }
+        }
+    }
+    d_use_ghost_exchange_sched = canUseGhostExchangeSchedule();
+    return;
+} // initializeGhostExchangeSchedule
+
+bool
+HierarchyGhostCellInterpolation::canUseGhostExchangeSchedule() const
+{
+    // The ghost cell exchange only fills ghost cells of the destination data
+    // from the interiors of the destination data on other patches, so it can
+    // only be used when the source and destination data are the same and do
+    // not require ghost cell widths wider than those used to create the
+    // schedule.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+    {
+        const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
+        const int src_data_idx = d_transaction_comps[comp_idx].d_src_data_idx;
+        if (dst_data_idx != src_data_idx) return false;
+        const IntVector<NDIM>& ghost_width =
+            level->getPatchDescriptor()->getPatchDataFactory(dst_data_idx)->getDefaultGhostCellWidth();
+        if (!(ghost_width <= d_ghost_exchange_width)) return false;
+    }
+    return true;
+} // canUseGhostExchangeSchedule
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <string>
@@ -53,7 +54,10 @@
 #include "muParserError.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
+#include "tbox/PIO.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 namespace SAMRAI
@@ -74,7 +78,43 @@ namespace IBTK
 namespace
 {
 static const int EXTENSIONS_FILLABLE = 128;
-}
+
+// Maximum number of boundary boxes for which coefficient data are cached.  The
+// cache is cleared when this limit is reached, e.g., after repeated regridding.
+static const unsigned int MAX_CACHE_SIZE = 8192;
+
+// Timers.
+static Timer* t_set_bc_coefs;
+static Timer* t_cache_hit;
+static Timer* t_cache_miss;
+
+inline bool
+is_time_dependent(const mu::Parser& parser)
+{
+    bool time_dependent = false;
+    try
+    {
+        const mu::varmap_type& used_vars = parser.GetUsedVar();
+        time_dependent = used_vars.count("t") || used_vars.count("T");
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return time_dependent;
+} // is_time_dependent
+} // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
@@ -89,8 +129,13 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
       d_acoef_parsers(2 * NDIM),
       d_bcoef_parsers(2 * NDIM),
       d_gcoef_parsers(2 * NDIM),
-      d_parser_time(new double),
-      d_parser_posn(new Point)
+      d_acoef_time_dependent(2 * NDIM, false),
+      d_bcoef_time_dependent(2 * NDIM, false),
+      d_gcoef_time_dependent(2 * NDIM, false),
+      d_parser_time(),
+      d_bc_coef_cache(),
+      d_num_cache_hits(0),
+      d_num_cache_misses(0)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -318,28 +363,35 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         {
             (*cit)->DefineConst(map_cit->first, map_cit->second);
         }
+    }
 
-        // Variables.
-        (*cit)->DefineVar("T", d_parser_time);
-        (*cit)->DefineVar("t", d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            (*cit)->DefineVar("X" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("x" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("X_" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("x_" + postfix, &d_parser_posn->data()[d]);
-        }
+    // Variables.
+    resizeParserBuffers(1);
+
+    // Determine which functions depend on time.
+    for (int d = 0; d < 2 * NDIM; ++d)
+    {
+        d_acoef_time_dependent[d] = is_time_dependent(d_acoef_parsers[d]);
+        d_bcoef_time_dependent[d] = is_time_dependent(d_bcoef_parsers[d]);
+        d_gcoef_time_dependent[d] = is_time_dependent(d_gcoef_parsers[d]);
     }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_set_bc_coefs = TimerManager::getManager()->getTimer("IBTK::muParserRobinBcCoefs::setBcCoefs()");
+                 t_cache_hit =
+                     TimerManager::getManager()->getTimer("IBTK::muParserRobinBcCoefs::setBcCoefs()[cache_hit]");
+                 t_cache_miss =
+                     TimerManager::getManager()->getTimer("IBTK::muParserRobinBcCoefs::setBcCoefs()[cache_miss]"););
     return;
 } // muParserRobinBcCoefs
 
 muParserRobinBcCoefs::~muParserRobinBcCoefs()
 {
-    delete d_parser_time;
-    delete d_parser_posn;
+    if (d_num_cache_hits + d_num_cache_misses > 0)
+    {
+        plog << "muParserRobinBcCoefs::~muParserRobinBcCoefs(): boundary coefficient cache hits = "
+             << d_num_cache_hits << ", misses = " << d_num_cache_misses << "\n";
+    }
     return;
 } // ~muParserRobinBcCoefs
 
@@ -371,46 +423,86 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
-    const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
-    const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
-    const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
-    *d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    if (bc_coef_box.empty()) return;
+    IBTK_TIMER_START(t_set_bc_coefs);
+
+    // Look up the cached coefficients for this boundary box.
+    BcCoefCacheKey key;
+    key.location_index = location_index;
+    key.bc_coef_box = bc_coef_box;
+    key.patch_lower = patch_lower;
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        const Index<NDIM>& i = b();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            if (d != bdry_normal_axis)
-            {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-            }
-            else
-            {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-            }
-        }
-        try
-        {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
-        }
-        catch (mu::ParserError& e)
+        key.x_lower[d] = x_lower[d];
+        key.dx[d] = dx[d];
+    }
+    std::map<BcCoefCacheKey, BcCoefCacheEntry>::iterator it = d_bc_coef_cache.find(key);
+    if (it == d_bc_coef_cache.end())
+    {
+        if (d_bc_coef_cache.size() >= MAX_CACHE_SIZE) d_bc_coef_cache.clear();
+        it = d_bc_coef_cache.insert(std::make_pair(key, BcCoefCacheEntry())).first;
+    }
+    BcCoefCacheEntry& entry = it->second;
+
+    // Fill the coefficient data, re-evaluating the functions only when the
+    // cached values are missing or out of date.
+    const unsigned int size = static_cast<unsigned int>(bc_coef_box.size());
+    bool buffers_initialized = false;
+    Pointer<ArrayData<NDIM, double> >* const coef_data[3] = { &acoef_data, &bcoef_data, &gcoef_data };
+    mu::Parser* const parsers[3] = { &d_acoef_parsers[location_index],
+                                     &d_bcoef_parsers[location_index],
+                                     &d_gcoef_parsers[location_index] };
+    const bool time_dependent[3] = { d_acoef_time_dependent[location_index],
+                                     d_bcoef_time_dependent[location_index],
+                                     d_gcoef_time_dependent[location_index] };
+    for (unsigned int k = 0; k < 3; ++k)
+    {
+        Pointer<ArrayData<NDIM, double> >& data = *coef_data[k];
+        if (!data) continue;
+        if (entry.valid[k] && (!time_dependent[k] || entry.time[k] == fill_time))
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  error: "
-                       << e.GetMsg()
-                       << "\n"
-                       << "  in:    "
-                       << e.GetExpr()
-                       << "\n");
+            IBTK_TIMER_START(t_cache_hit);
+            ++d_num_cache_hits;
+            IBTK_TIMER_STOP(t_cache_hit);
         }
-        catch (...)
+        else
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  unrecognized exception generated by muParser library.\n");
+            IBTK_TIMER_START(t_cache_miss);
+            ++d_num_cache_misses;
+            if (!buffers_initialized)
+            {
+                resizeParserBuffers(size);
+                std::fill(d_parser_time.begin(), d_parser_time.begin() + size, fill_time);
+                unsigned int idx = 0;
+                for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++idx)
+                {
+                    const Index<NDIM>& i = b();
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        if (d != bdry_normal_axis)
+                        {
+                            d_parser_posn[d][idx] =
+                                x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                        }
+                        else
+                        {
+                            d_parser_posn[d][idx] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                        }
+                    }
+                }
+                buffers_initialized = true;
+            }
+            entry.values[k].resize(size);
+            evaluateParser(*parsers[k], &entry.values[k][0], size);
+            entry.time[k] = fill_time;
+            entry.valid[k] = true;
+            IBTK_TIMER_STOP(t_cache_miss);
         }
+
+        // The coefficient data and the cached values use the same ordering.
+        std::copy(entry.values[k].begin(), entry.values[k].end(), data->getPointer(0));
     }
+    IBTK_TIMER_STOP(t_set_bc_coefs);
     return;
 } // setBcCoefs
 
@@ -424,6 +516,90 @@ muParserRobinBcCoefs::numberOfExtensionsFillable() const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+muParserRobinBcCoefs::resizeParserBuffers(const unsigned int size) const
+{
+    if (size <= d_parser_time.size()) return;
+    const unsigned int new_size = std::max(size, static_cast<unsigned int>(2 * d_parser_time.size()));
+    d_parser_time.resize(new_size, 0.0);
+    for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d].resize(new_size, 0.0);
+
+    // Bulk evaluation reads every variable from an array, so that the parser
+    // variables must be redefined whenever the buffers are reallocated.
+    for (int l = 0; l < 2 * NDIM; ++l)
+    {
+        mu::Parser* const parsers[3] = { &d_acoef_parsers[l], &d_bcoef_parsers[l], &d_gcoef_parsers[l] };
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+            parsers[k]->DefineVar("T", &d_parser_time[0]);
+            parsers[k]->DefineVar("t", &d_parser_time[0]);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                std::ostringstream stream;
+                stream << d;
+                const std::string postfix = stream.str();
+                parsers[k]->DefineVar("X" + postfix, &d_parser_posn[d][0]);
+                parsers[k]->DefineVar("x" + postfix, &d_parser_posn[d][0]);
+                parsers[k]->DefineVar("X_" + postfix, &d_parser_posn[d][0]);
+                parsers[k]->DefineVar("x_" + postfix, &d_parser_posn[d][0]);
+            }
+        }
+    }
+    return;
+} // resizeParserBuffers
+
+void
+muParserRobinBcCoefs::evaluateParser(mu::Parser& parser, double* const values, const unsigned int size) const
+{
+    try
+    {
+        parser.Eval(values, static_cast<int>(size));
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setBcCoefs():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setBcCoefs():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return;
+} // evaluateParser
+
+bool
+muParserRobinBcCoefs::BcCoefCacheKey::operator<(const BcCoefCacheKey& that) const
+{
+    if (location_index != that.location_index) return location_index < that.location_index;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (bc_coef_box.lower()(d) != that.bc_coef_box.lower()(d))
+            return bc_coef_box.lower()(d) < that.bc_coef_box.lower()(d);
+        if (bc_coef_box.upper()(d) != that.bc_coef_box.upper()(d))
+            return bc_coef_box.upper()(d) < that.bc_coef_box.upper()(d);
+        if (patch_lower(d) != that.patch_lower(d)) return patch_lower(d) < that.patch_lower(d);
+        if (x_lower[d] != that.x_lower[d]) return x_lower[d] < that.x_lower[d];
+        if (dx[d] != that.dx[d]) return dx[d] < that.dx[d];
+    }
+    return false;
+} // operator<
+
+muParserRobinBcCoefs::BcCoefCacheEntry::BcCoefCacheEntry()
+{
+    for (unsigned int k = 0; k < 3; ++k)
+    {
+        time[k] = 0.0;
+        valid[k] = false;
+    }
+    return;
+} // BcCoefCacheEntry
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -42,6 +42,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <string>
+#include <sys/resource.h>
 #include <utility>
 #include <vector>
 
@@ -66,6 +67,8 @@
 #include "MultiblockDataTranslator.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "ProcessorMapping.h"
@@ -257,6 +260,39 @@ get_elem_hmax(Elem* const elem, const boost::multi_array<double, 2>& X_node)
     }
     return sqrt(hmax_squared);
 } // get_elem_hmax
+
+inline Order
+get_quadrature_order(const QuadratureType type,
+                     const Order order,
+                     const bool use_adaptive_quadrature,
+                     const double point_density,
+                     Elem* const elem,
+                     const boost::multi_array<double, 2>& X_node,
+                     const double dx_min)
+{
+    if (!use_adaptive_quadrature) return order;
+    const double hmax = get_elem_hmax(elem, X_node);
+    const int min_pts = elem->default_order() == FIRST ? 2 : 3;
+    const int npts = std::max(min_pts, static_cast<int>(std::ceil(point_density * hmax / dx_min)));
+    switch (type)
+    {
+    case QGAUSS:
+        return static_cast<Order>(std::min(2 * npts - 1, static_cast<int>(FORTYTHIRD)));
+    case QGRID:
+        return static_cast<Order>(npts);
+    default:
+        TBOX_ERROR("FEDataManager::updateQuadratureRule():\n"
+                   << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
+                      "or QGRID\n");
+    }
+    return order;
+} // get_quadrature_order
+
+inline UniquePtr<QBase>
+build_quadrature_rule(const QuadratureType type, const unsigned int dim, const Order order)
+{
+    return type == QGRID ? UniquePtr<QBase>(new QGrid(dim, order)) : QBase::build(type, dim, order);
+} // build_quadrature_rule
 }
 
 const short int FEDataManager::ZERO_DISPLACEMENT_X_BDRY_ID = 0x100;
@@ -269,6 +305,9 @@ const short int FEDataManager::ZERO_DISPLACEMENT_XYZ_BDRY_ID = 0x100 | 0x200 | 0
 std::map<std::string, FEDataManager*> FEDataManager::s_data_manager_instances;
 bool FEDataManager::s_registered_callback = false;
 unsigned char FEDataManager::s_shutdown_priority = 200;
+std::map<int, int> FEDataManager::s_scratch_data_idxs;
+unsigned int FEDataManager::s_num_scratch_data_allocations = 0;
+size_t FEDataManager::s_scratch_data_size_high_water_mark = 0;
 
 FEDataManager*
 FEDataManager::getManager(const std::string& name,
@@ -307,9 +346,36 @@ FEDataManager::freeAllManagers()
         }
         it->second = NULL;
     }
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (std::map<int, int>::const_iterator cit = s_scratch_data_idxs.begin(); cit != s_scratch_data_idxs.end(); ++cit)
+    {
+        var_db->removePatchDataIndex(cit->second);
+    }
+    s_scratch_data_idxs.clear();
     return;
 } // freeAllManagers
 
+void
+FEDataManager::printMemoryStatistics(std::ostream& os) const
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    const double max_rss_kb = static_cast<double>(usage.ru_maxrss) / 1024.0;
+#else
+    const double max_rss_kb = static_cast<double>(usage.ru_maxrss);
+#endif
+    const double kb = 1024.0;
+    os << d_object_name << "::printMemoryStatistics():\n";
+    os << "  number of scratch patch data allocations = " << s_num_scratch_data_allocations << "\n";
+    os << "  scratch patch data size (KB)             = "
+       << SAMRAI_MPI::maxReduction(static_cast<double>(getScratchPatchDataSize()) / kb) << "\n";
+    os << "  scratch patch data high-water mark (KB)  = "
+       << SAMRAI_MPI::maxReduction(static_cast<double>(s_scratch_data_size_high_water_mark) / kb) << "\n";
+    os << "  process peak resident set size (KB)      = " << SAMRAI_MPI::maxReduction(max_rss_kb) << "\n";
+    return;
+} // printMemoryStatistics
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 void
@@ -431,6 +497,7 @@ FEDataManager::reinitElementMappings()
         delete it->second;
     }
     d_system_ghost_vec.clear();
+    clearSpreadQuadratureCache();
 
     // Reset the mappings between grid patches and active mesh elements.
     collectActivePatchElements(d_active_patch_elem_map, d_level_number, d_ghost_width);
@@ -439,6 +506,13 @@ FEDataManager::reinitElementMappings()
     return;
 } // reinitElementMappings
 
+void
+FEDataManager::clearSpreadQuadratureCache()
+{
+    d_spread_quad_cache.clear();
+    return;
+} // clearSpreadQuadratureCache
+
 NumericVector<double>*
 FEDataManager::getSolutionVector(const std::string& system_name) const
 {
@@ -494,9 +568,11 @@ FEDataManager::spread(const int f_data_idx,
                       NumericVector<double>& X_vec,
                       const std::string& system_name,
                       RobinPhysBdryPatchStrategy* f_phys_bdry_op,
-                      const double fill_data_time)
+                      const double fill_data_time,
+                      const bool f_data_is_zero)
 {
-    spread(f_data_idx, F_vec, X_vec, system_name, d_default_spread_spec, f_phys_bdry_op, fill_data_time);
+    spread(
+        f_data_idx, F_vec, X_vec, system_name, d_default_spread_spec, f_phys_bdry_op, fill_data_time, f_data_is_zero);
     return;
 } // spread
 
@@ -507,12 +583,11 @@ FEDataManager::spread(const int f_data_idx,
                       const std::string& system_name,
                       const FEDataManager::SpreadSpec& spread_spec,
                       RobinPhysBdryPatchStrategy* f_phys_bdry_op,
-                      const double fill_data_time)
+                      const double fill_data_time,
+                      const bool f_data_is_zero)
 {
     IBTK_TIMER_START(t_spread);
 
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
 
     // Determine the type of data centering.
@@ -524,23 +599,21 @@ FEDataManager::spread(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || sc_data);
 
-    // Make a copy of the Eulerian data.
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
+    // Make a copy of the Eulerian data, unless the caller guarantees that the
+    // data are zero, in which case values are spread directly into f_data_idx.
+    const int f_copy_data_idx = f_data_is_zero ? -1 : getScratchPatchDataIndex(f_data_idx);
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
-    }
     Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
         HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
+    if (!f_data_is_zero)
+    {
+        f_data_ops->swapData(f_copy_data_idx, f_data_idx);
+        f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
+    }
 
     // Extract the mesh.
     const MeshBase& mesh = d_es->get_mesh();
     const unsigned int dim = mesh.mesh_dimension();
-    UniquePtr<QBase> qrule;
 
     // Extract the FE systems and DOF maps, and setup the FE object.
     System& F_system = d_es->get_system(system_name);
@@ -595,11 +668,19 @@ FEDataManager::spread(const int f_data_idx,
      */
     SystemDofMapCache& getDofMapCache(unsigned int system_num);
 
+    // Lookup the cached quadrature data.  The shape function values of
+    // Lagrange elements depend only on the element type and the quadrature
+    // rule, so that they may be tabulated once for each rule.
+    SpreadQuadratureCache& quad_cache = getSpreadQuadratureCache(system_name, spread_spec);
+    const bool use_phi_tables = F_fe_type.family == LAGRANGE && X_fe_type.family == LAGRANGE;
+
     // Loop over the patches to interpolate nodal values on the FE mesh to the
     // element quadrature points, then spread those values onto the Eulerian
     // grid.
     boost::multi_array<double, 2> F_node, X_node;
-    std::vector<double> F_JxW_qp, X_qp;
+    std::vector<int> new_elem_table;
+    std::vector<unsigned int> new_qp_offset;
+    std::vector<double> new_JxW;
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
@@ -613,28 +694,92 @@ FEDataManager::spread(const int f_data_idx,
         const double* const patch_dx = patch_geom->getDx();
         const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-        // Setup vectors to store the values of F_JxW and X at the quadrature
-        // points.
-        unsigned int n_qp_patch = 0;
-        for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+        // Determine the quadrature rule to use for each element.  The rules
+        // need to be determined again only if the cached data are out of date
+        // or if the rule depends on the current element geometry.  The cached
+        // data are valid only if the cached table of each element matches its
+        // current type, p-refinement level, and quadrature order.
+        SpreadQuadraturePatchData& patch_data = quad_cache.patch_data[local_patch_num];
+        bool patch_data_valid = patch_data.elem_table.size() == num_active_patch_elems;
+        for (unsigned int e_idx = 0; patch_data_valid && e_idx < num_active_patch_elems; ++e_idx)
         {
-            Elem* const elem = patch_elems[e_idx];
-            for (unsigned int d = 0; d < NDIM; ++d)
+            const Elem* const elem = patch_elems[e_idx];
+            const SpreadQuadratureTable& table = quad_cache.tables[patch_data.elem_table[e_idx]];
+            patch_data_valid = table.elem_type == elem->type() && table.p_level == elem->p_level() &&
+                               (spread_spec.use_adaptive_quadrature || table.order == spread_spec.quad_order);
+        }
+        if (!patch_data_valid || spread_spec.use_adaptive_quadrature)
+        {
+            bool elem_tables_changed = !patch_data_valid;
+            new_elem_table.resize(num_active_patch_elems);
+            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
             {
-                X_dof_map_cache.dof_indices(elem, X_dof_indices[d], d);
+                Elem* const elem = patch_elems[e_idx];
+                if (spread_spec.use_adaptive_quadrature)
+                {
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X_dof_map_cache.dof_indices(elem, X_dof_indices[d], d);
+                    }
+                    get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
+                }
+                const Order order = get_quadrature_order(spread_spec.quad_type,
+                                                         spread_spec.quad_order,
+                                                         spread_spec.use_adaptive_quadrature,
+                                                         spread_spec.point_density,
+                                                         elem,
+                                                         X_node,
+                                                         patch_dx_min);
+                new_elem_table[e_idx] = getSpreadQuadratureTable(quad_cache, elem, order, F_fe, X_fe);
+                elem_tables_changed = elem_tables_changed || new_elem_table[e_idx] != patch_data.elem_table[e_idx];
+            }
+
+            // Recompute the quadrature point offsets and the JxW values of
+            // those elements whose quadrature rules have changed.  The JxW
+            // values depend only on the reference configuration of the mesh,
+            // so that the values of the other elements are reused.
+            if (elem_tables_changed)
+            {
+                new_qp_offset.resize(num_active_patch_elems + 1);
+                new_qp_offset[0] = 0;
+                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+                {
+                    const SpreadQuadratureTable& table = quad_cache.tables[new_elem_table[e_idx]];
+                    new_qp_offset[e_idx + 1] = new_qp_offset[e_idx] + table.qrule->n_points();
+                }
+                new_JxW.resize(new_qp_offset[num_active_patch_elems]);
+                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+                {
+                    if (patch_data_valid && new_elem_table[e_idx] == patch_data.elem_table[e_idx])
+                    {
+                        std::copy(patch_data.JxW.begin() + patch_data.qp_offset[e_idx],
+                                  patch_data.JxW.begin() + patch_data.qp_offset[e_idx + 1],
+                                  new_JxW.begin() + new_qp_offset[e_idx]);
+                    }
+                    else
+                    {
+                        F_fe->attach_quadrature_rule(quad_cache.tables[new_elem_table[e_idx]].qrule.getPointer());
+                        F_fe->reinit(patch_elems[e_idx]);
+                        std::copy(JxW_F.begin(), JxW_F.end(), new_JxW.begin() + new_qp_offset[e_idx]);
+                    }
+                }
+                patch_data.elem_table.swap(new_elem_table);
+                patch_data.qp_offset.swap(new_qp_offset);
+                patch_data.JxW.swap(new_JxW);
             }
-            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
-            n_qp_patch += qrule->n_points();
         }
+
+        // Setup vectors to store the values of F_JxW and X at the quadrature
+        // points.
+        const unsigned int n_qp_patch = patch_data.qp_offset[num_active_patch_elems];
         if (!n_qp_patch) continue;
+        std::vector<double>& F_JxW_qp = patch_data.F_JxW_qp;
+        std::vector<double>& X_qp = patch_data.X_qp;
         F_JxW_qp.resize(n_vars * n_qp_patch);
         X_qp.resize(NDIM * n_qp_patch);
 
         // Loop over the elements and compute the values to be spread and the
         // positions of the quadrature points.
-        qrule.reset();
-        unsigned int qp_offset = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
             Elem* const elem = patch_elems[e_idx];
@@ -648,63 +793,85 @@ FEDataManager::spread(const int f_data_idx,
                 X_dof_map_cache.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_changed = updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
-            if (qrule_changed)
+            const SpreadQuadratureTable& table = quad_cache.tables[patch_data.elem_table[e_idx]];
+            const std::vector<std::vector<double> >* phi_F_elem = &table.phi_F;
+            const std::vector<std::vector<double> >* phi_X_elem = &table.phi_X;
+            if (!use_phi_tables)
             {
-                // NOTE: Because we are only using the shape function values for
-                // the FE object associated with X, we only need to reinitialize
-                // X_fe whenever the quadrature rule changes.  In particular,
-                // notice that the shape function values depend only on the
-                // element type and quadrature rule, not on the element
-                // geometry.
-                F_fe->attach_quadrature_rule(qrule.get());
-                X_fe->attach_quadrature_rule(qrule.get());
+                F_fe->attach_quadrature_rule(table.qrule.getPointer());
+                X_fe->attach_quadrature_rule(table.qrule.getPointer());
+                F_fe->reinit(elem);
                 if (X_fe != F_fe) X_fe->reinit(elem);
+                phi_F_elem = &phi_F;
+                phi_X_elem = &phi_X;
             }
-            F_fe->reinit(elem);
-            const unsigned int n_qp = qrule->n_points();
+            const unsigned int qp_offset = patch_data.qp_offset[e_idx];
+            const unsigned int n_qp = patch_data.qp_offset[e_idx + 1] - qp_offset;
+            const double* const JxW_elem = &patch_data.JxW[qp_offset];
             double* F_begin = &F_JxW_qp[n_vars * qp_offset];
             double* X_begin = &X_qp[NDIM * qp_offset];
             std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
             std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
             for (unsigned int k = 0; k < F_dof_indices[0].size(); ++k)
             {
+                const std::vector<double>& phi_F_k = (*phi_F_elem)[k];
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
                     for (unsigned int i = 0; i < n_vars; ++i)
                     {
-                        F_JxW_qp[n_vars * (qp_offset + qp) + i] += F_node[k][i] * phi_F[k][qp] * JxW_F[qp];
+                        F_begin[n_vars * qp + i] += F_node[k][i] * phi_F_k[qp] * JxW_elem[qp];
                     }
                 }
             }
             for (unsigned int k = 0; k < X_dof_indices[0].size(); ++k)
             {
+                const std::vector<double>& phi_X_k = (*phi_X_elem)[k];
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
                     for (unsigned int i = 0; i < NDIM; ++i)
                     {
-                        X_qp[NDIM * (qp_offset + qp) + i] += X_node[k][i] * phi_X[k][qp];
+                        X_begin[NDIM * qp + i] += X_node[k][i] * phi_X_k[qp];
                     }
                 }
             }
-            qp_offset += n_qp;
         }
 
         // Spread values from the quadrature points to the Cartesian grid patch.
         //
         // NOTE: Values are spread only from those quadrature points that are
-        // within the ghost cell width of the patch interior.
+        // within the ghost cell width of the patch interior.  The packed
+        // quadrature point data are passed to LEInteractor without copying.
         const Box<NDIM> spread_box = Box<NDIM>::grow(patch->getBox(), d_ghost_width);
         Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
         if (cc_data)
         {
             Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-            LEInteractor::spread(f_cc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
+            LEInteractor::spread(f_cc_data,
+                                 &F_JxW_qp[0],
+                                 n_vars * n_qp_patch,
+                                 n_vars,
+                                 &X_qp[0],
+                                 NDIM * n_qp_patch,
+                                 NDIM,
+                                 patch,
+                                 spread_box,
+                                 spread_spec.kernel_fcn,
+                                 spread_spec.spread_mode);
         }
         if (sc_data)
         {
             Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-            LEInteractor::spread(f_sc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
+            LEInteractor::spread(f_sc_data,
+                                 &F_JxW_qp[0],
+                                 n_vars * n_qp_patch,
+                                 n_vars,
+                                 &X_qp[0],
+                                 NDIM * n_qp_patch,
+                                 NDIM,
+                                 patch,
+                                 spread_box,
+                                 spread_spec.kernel_fcn,
+                                 spread_spec.spread_mode);
         }
         if (f_phys_bdry_op)
         {
@@ -714,14 +881,11 @@ FEDataManager::spread(const int f_data_idx,
     }
 
     // Accumulate data.
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    if (!f_data_is_zero)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
+        f_data_ops->swapData(f_copy_data_idx, f_data_idx);
+        f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
     }
-    var_db->removePatchDataIndex(f_copy_data_idx);
 
     VecRestoreArray(F_local_vec, &F_local_soln);
     VecGhostRestoreLocalForm(F_global_vec, &F_local_vec);
@@ -1768,30 +1932,12 @@ FEDataManager::updateQuadratureRule(UniquePtr<QBase>& qrule,
     unsigned int elem_dim = elem->dim();
     const ElemType elem_type = elem->type();
     const unsigned int elem_p_level = elem->p_level();
-    if (use_adaptive_quadrature)
-    {
-        const double hmax = get_elem_hmax(elem, X_node);
-        const int min_pts = elem->default_order() == FIRST ? 2 : 3;
-        const int npts = std::max(min_pts, static_cast<int>(std::ceil(point_density * hmax / dx_min)));
-        switch (type)
-        {
-        case QGAUSS:
-            order = static_cast<Order>(std::min(2 * npts - 1, static_cast<int>(FORTYTHIRD)));
-            break;
-        case QGRID:
-            order = static_cast<Order>(npts);
-            break;
-        default:
-            TBOX_ERROR("FEDataManager::updateQuadratureRule():\n"
-                       << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
-                          "or QGRID\n");
-        }
-    }
+    order = get_quadrature_order(type, order, use_adaptive_quadrature, point_density, elem, X_node, dx_min);
     bool qrule_updated = false;
     if (!qrule || qrule->type() != type || qrule->get_dim() != elem_dim || qrule->get_order() != order ||
         qrule->get_elem_type() != elem_type || qrule->get_p_level() != elem_p_level)
     {
-        qrule = (type == QGRID ? UniquePtr<QBase>(new QGrid(elem_dim, order)) : QBase::build(type, elem_dim, order));
+        qrule = build_quadrature_rule(type, elem_dim, order);
         // qrule->allow_rules_with_negative_weights = false;
         qrule->init(elem_type, elem_p_level);
         qrule_updated = true;
@@ -1888,6 +2034,10 @@ FEDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM
     setPatchHierarchy(hierarchy);
     setPatchLevels(0, d_hierarchy->getFinestLevelNumber());
 
+    // Release the scratch data, which are reallocated on the new patch levels
+    // when they are next required.
+    deallocateScratchPatchData();
+
     IBTK_TIMER_STOP(t_reset_hierarchy_configuration);
     return;
 } // resetHierarchyConfiguration
@@ -2155,6 +2305,163 @@ FEDataManager::~FEDataManager()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+FEDataManager::SpreadQuadratureCache&
+FEDataManager::getSpreadQuadratureCache(const std::string& system_name, const SpreadSpec& spread_spec)
+{
+    std::map<std::string, SpreadQuadratureCache>::iterator it = d_spread_quad_cache.find(system_name);
+    if (it != d_spread_quad_cache.end())
+    {
+        const SpreadQuadratureCache& cache = it->second;
+        if (cache.quad_type != spread_spec.quad_type || cache.quad_order != spread_spec.quad_order ||
+            cache.use_adaptive_quadrature != spread_spec.use_adaptive_quadrature ||
+            cache.point_density != spread_spec.point_density ||
+            cache.patch_data.size() != d_active_patch_elem_map.size())
+        {
+            d_spread_quad_cache.erase(it);
+            it = d_spread_quad_cache.end();
+        }
+    }
+    if (it == d_spread_quad_cache.end())
+    {
+        SpreadQuadratureCache& cache = d_spread_quad_cache[system_name];
+        cache.quad_type = spread_spec.quad_type;
+        cache.quad_order = spread_spec.quad_order;
+        cache.use_adaptive_quadrature = spread_spec.use_adaptive_quadrature;
+        cache.point_density = spread_spec.point_density;
+        cache.patch_data.resize(d_active_patch_elem_map.size());
+        return cache;
+    }
+    return it->second;
+} // getSpreadQuadratureCache
+
+int
+FEDataManager::getSpreadQuadratureTable(SpreadQuadratureCache& cache,
+                                        Elem* const elem,
+                                        const Order order,
+                                        FEBase* const F_fe,
+                                        FEBase* const X_fe)
+{
+    const ElemType elem_type = elem->type();
+    const unsigned int elem_p_level = elem->p_level();
+    for (int k = 0; k < static_cast<int>(cache.tables.size()); ++k)
+    {
+        const SpreadQuadratureTable& table = cache.tables[k];
+        if (table.elem_type == elem_type && table.p_level == elem_p_level && table.order == order) return k;
+    }
+
+    // Build a new quadrature rule and tabulate the shape functions at its
+    // quadrature points.
+    SpreadQuadratureTable table;
+    table.elem_type = elem_type;
+    table.p_level = elem_p_level;
+    table.order = order;
+    table.qrule = Pointer<QBase>(build_quadrature_rule(cache.quad_type, elem->dim(), order).release());
+    table.qrule->init(elem_type, elem_p_level);
+    F_fe->attach_quadrature_rule(table.qrule.getPointer());
+    X_fe->attach_quadrature_rule(table.qrule.getPointer());
+    F_fe->reinit(elem);
+    if (X_fe != F_fe) X_fe->reinit(elem);
+    table.phi_F = F_fe->get_phi();
+    table.phi_X = X_fe->get_phi();
+    cache.tables.push_back(table);
+    return static_cast<int>(cache.tables.size()) - 1;
+} // getSpreadQuadratureTable
+
+int
+FEDataManager::getScratchPatchDataIndex(const int data_idx)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<hier::Variable<NDIM> > var;
+    var_db->mapIndexToVariable(data_idx, var);
+    const IntVector<NDIM>& gcw = var_db->getPatchDescriptor()->getPatchDataFactory(data_idx)->getGhostCellWidth();
+
+    // Look up the scratch data index.  Because patch data indices may be
+    // reused, the cached index is only used if it refers to a copy of the
+    // same variable with the same ghost cell width.
+    int scratch_idx = -1;
+    std::map<int, int>::iterator it = s_scratch_data_idxs.find(data_idx);
+    if (it != s_scratch_data_idxs.end())
+    {
+        Pointer<hier::Variable<NDIM> > scratch_var;
+        var_db->mapIndexToVariable(it->second, scratch_var);
+        const IntVector<NDIM>& scratch_gcw =
+            var_db->getPatchDescriptor()->getPatchDataFactory(it->second)->getGhostCellWidth();
+        if (scratch_var == var && scratch_gcw == gcw)
+        {
+            scratch_idx = it->second;
+        }
+        else
+        {
+            for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+                if (level->checkAllocated(it->second)) level->deallocatePatchData(it->second);
+            }
+            var_db->removePatchDataIndex(it->second);
+            s_scratch_data_idxs.erase(it);
+        }
+    }
+    if (scratch_idx == -1)
+    {
+        scratch_idx = var_db->registerClonedPatchDataIndex(var, data_idx);
+        s_scratch_data_idxs[data_idx] = scratch_idx;
+    }
+
+    // Allocate the scratch data on any levels on which it is not already
+    // allocated.
+    bool allocated_data = false;
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(scratch_idx)) continue;
+        level->allocatePatchData(scratch_idx);
+        ++s_num_scratch_data_allocations;
+        allocated_data = true;
+    }
+    if (allocated_data)
+    {
+        s_scratch_data_size_high_water_mark = std::max(s_scratch_data_size_high_water_mark, getScratchPatchDataSize());
+    }
+    return scratch_idx;
+} // getScratchPatchDataIndex
+
+void
+FEDataManager::deallocateScratchPatchData()
+{
+    if (!d_hierarchy) return;
+    for (std::map<int, int>::const_iterator cit = s_scratch_data_idxs.begin(); cit != s_scratch_data_idxs.end(); ++cit)
+    {
+        for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (level && level->checkAllocated(cit->second)) level->deallocatePatchData(cit->second);
+        }
+    }
+    return;
+} // deallocateScratchPatchData
+
+size_t
+FEDataManager::getScratchPatchDataSize() const
+{
+    if (!d_hierarchy) return 0;
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = VariableDatabase<NDIM>::getDatabase()->getPatchDescriptor();
+    size_t size = 0;
+    for (std::map<int, int>::const_iterator cit = s_scratch_data_idxs.begin(); cit != s_scratch_data_idxs.end(); ++cit)
+    {
+        Pointer<PatchDataFactory<NDIM> > pdat_factory = patch_descriptor->getPatchDataFactory(cit->second);
+        for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (!level || !level->checkAllocated(cit->second)) continue;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                size += pdat_factory->getSizeOfMemory(level->getPatch(p())->getBox());
+            }
+        }
+    }
+    return size;
+} // getScratchPatchDataSize
+
 void
 FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_ln)
 {
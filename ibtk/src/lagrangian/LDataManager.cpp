@@ -88,6 +88,7 @@
 #include "boost/array.hpp"
 #include "boost/math/special_functions/round.hpp"
 #include "boost/multi_array.hpp"
+#include "ibtk/FixedSizedStream.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LData.h"
@@ -101,32 +102,31 @@
 #include "ibtk/LNodeSet.h"
 #include "ibtk/LNodeSetData.h"
 #include "ibtk/LNodeSetVariable.h"
-#include "ibtk/LNodeTransaction.h"
+#include "ibtk/LObjectPool.h"
 #include "ibtk/LSet.h"
 #include "ibtk/LSetData.h"
 #include "ibtk/LSetDataIterator.h"
 #include "ibtk/LSiloDataWriter.h"
-#include "ibtk/LTransaction.h"
 #include "ibtk/ParallelSet.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
 #include "petscao.h"
 #include "petscis.h"
 #include "petscsys.h"
 #include "petscvec.h"
+#include "tbox/AbstractStream.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
 #include "tbox/SAMRAI_MPI.h"
-#include "tbox/Schedule.h"
 #include "tbox/ShutdownRegistry.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
-#include "tbox/Transaction.h"
 #include "tbox/Utilities.h"
 
 namespace SAMRAI
@@ -172,6 +172,88 @@ static const double TOL = sqrt(std::numeric_limits<double>::epsilon());
 
 // Version of LDataManager restart file data.
 static const int LDATA_MANAGER_VERSION = 1;
+
+// Base MPI tag used when migrating displaced structures between processors.
+static const int MIGRATION_TAG = 7311;
+
+// Open-addressing hash table that maps Lagrangian indices to local PETSc
+// indices.  Keys must be nonnegative.
+class LagrangianIndexMap
+{
+public:
+    explicit LagrangianIndexMap(const size_t expected_size) : d_keys(), d_vals(), d_size(0)
+    {
+        size_t capacity = 16;
+        while (capacity < 2 * expected_size) capacity *= 2;
+        d_keys.assign(capacity, -1);
+        d_vals.resize(capacity);
+        return;
+    }
+
+    // Return the value associated with the key, or -1 if the key is not present.
+    inline int find(const int key) const
+    {
+        const size_t mask = d_keys.size() - 1;
+        for (size_t slot = hash(key) & mask;; slot = (slot + 1) & mask)
+        {
+            if (d_keys[slot] == key) return d_vals[slot];
+            if (d_keys[slot] == -1) return -1;
+        }
+    }
+
+    // Associate the value with the key.
+    inline void insert(const int key, const int val)
+    {
+        if (2 * (d_size + 1) > d_keys.size()) rehash(2 * d_keys.size());
+        const size_t mask = d_keys.size() - 1;
+        size_t slot = hash(key) & mask;
+        while (d_keys[slot] != -1 && d_keys[slot] != key) slot = (slot + 1) & mask;
+        if (d_keys[slot] == -1) ++d_size;
+        d_keys[slot] = key;
+        d_vals[slot] = val;
+        return;
+    }
+
+private:
+    static inline size_t hash(const int key)
+    {
+        // Use the MurmurHash3 finalizer so that strided indices do not collide
+        // in the low-order bits.
+        unsigned int h = static_cast<unsigned int>(key);
+        h ^= h >> 16;
+        h *= 0x85ebca6bU;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35U;
+        h ^= h >> 16;
+        return static_cast<size_t>(h);
+    }
+
+    void rehash(const size_t capacity)
+    {
+        std::vector<int> keys(capacity, -1), vals(capacity);
+        d_keys.swap(keys);
+        d_vals.swap(vals);
+        d_size = 0;
+        for (size_t k = 0; k < keys.size(); ++k)
+        {
+            if (keys[k] != -1) insert(keys[k], vals[k]);
+        }
+        return;
+    }
+
+    std::vector<int> d_keys, d_vals;
+    size_t d_size;
+};
+
+// Comparison functor that orders nodes by their Morton indices.
+struct MortonKeyComp
+{
+    inline bool operator()(const std::pair<unsigned long, LNode*>& lhs,
+                           const std::pair<unsigned long, LNode*>& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
 }
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -290,6 +372,7 @@ LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
     d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_posns.resize(d_finest_ln + 1);
+    d_redistribution_boxes.resize(d_finest_ln + 1);
     d_lag_mesh.resize(d_finest_ln + 1);
     d_lag_mesh_data.resize(d_finest_ln + 1);
     d_needs_synch.resize(d_finest_ln + 1, false);
@@ -309,6 +392,28 @@ LDataManager::getPatchLevels() const
     return std::make_pair(d_coarsest_ln, d_finest_ln + 1);
 } // getPatchLevels
 
+void
+LDataManager::setNodeOrdering(const LNodeOrderingType node_ordering, const bool permute_lag_data)
+{
+    if (node_ordering != NATURAL_NODE_ORDERING && node_ordering != MORTON_NODE_ORDERING)
+    {
+        TBOX_ERROR(d_object_name << "::setNodeOrdering():\n"
+                                 << "  unsupported node ordering: "
+                                 << enum_to_string<LNodeOrderingType>(node_ordering)
+                                 << "\n");
+    }
+    d_node_ordering = node_ordering;
+    d_permute_lag_data = permute_lag_data;
+    return;
+} // setNodeOrdering
+
+void
+LDataManager::setIncrementalRedistribution(const bool incremental_redistribution)
+{
+    d_incremental_redistribution = incremental_redistribution;
+    return;
+} // setIncrementalRedistribution
+
 void
 LDataManager::spread(const int f_data_idx,
                      Pointer<LData> F_data,
@@ -1399,8 +1504,8 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
     const double* const domain_x_lower = d_grid_geom->getXLower();
     const double* const domain_x_upper = d_grid_geom->getXUpper();
     const double* const domain_dx = d_grid_geom->getDx();
-    std::vector<std::map<int, IntVector<NDIM> > > periodic_offset_data(finest_ln + 1);
-    std::vector<std::map<int, Vector> > periodic_displacement_data(finest_ln + 1);
+    d_periodic_shift_idxs.resize(finest_ln + 1);
+    d_periodic_shifts.resize(finest_ln + 1);
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
         if (!d_level_contains_lag_data[level_number]) continue;
@@ -1419,6 +1524,10 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
         const IntVector<NDIM>& periodic_shift = d_grid_geom->getPeriodicShift();
         double level_dx[NDIM];
         for (unsigned int d = 0; d < NDIM; ++d) level_dx[d] = domain_dx[d] / ratio[d];
+        std::vector<int>& periodic_shift_idxs = d_periodic_shift_idxs[level_number];
+        std::vector<std::pair<IntVector<NDIM>, Vector> >& periodic_shifts = d_periodic_shifts[level_number];
+        periodic_shift_idxs.assign(num_nodes, -1);
+        periodic_shifts.clear();
         for (unsigned int local_idx = 0; local_idx < num_nodes; ++local_idx)
         {
             Eigen::Map<Vector> X(&X_data[local_idx][0], NDIM);
@@ -1453,8 +1562,8 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
             }
             if (periodic_offset != IntVector<NDIM>(0))
             {
-                periodic_offset_data[level_number][local_idx] = periodic_offset;
-                periodic_displacement_data[level_number][local_idx] = periodic_displacement;
+                periodic_shift_idxs[local_idx] = static_cast<int>(periodic_shifts.size());
+                periodic_shifts.push_back(std::make_pair(periodic_offset, periodic_displacement));
             }
         }
         d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
@@ -1478,6 +1587,34 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
         const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
         const IntVector<NDIM>& ratio = level->getRatio();
+
+        // The index data can be updated in place only if the patch boxes have
+        // not changed since the data were last redistributed.
+        bool update_in_place = d_incremental_redistribution;
+        if (update_in_place)
+        {
+            const BoxArray<NDIM>& boxes = level->getBoxes();
+            const BoxArray<NDIM>& redistribution_boxes = d_redistribution_boxes[level_number];
+            update_in_place = boxes.getNumberOfBoxes() == redistribution_boxes.getNumberOfBoxes();
+            for (int k = 0; update_in_place && k < boxes.getNumberOfBoxes(); ++k)
+            {
+                update_in_place = boxes[k] == redistribution_boxes[k];
+            }
+        }
+        const std::vector<int>& periodic_shift_idxs = d_periodic_shift_idxs[level_number];
+        const std::vector<std::pair<IntVector<NDIM>, Vector> >& periodic_shifts = d_periodic_shifts[level_number];
+        d_periodic_shift_patch_nums.assign(periodic_shifts.size(), -1);
+        if (update_in_place)
+        {
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                updateIndexDataInPlace(p(), level_number, X_data.data(), grid_geom, ratio);
+            }
+            d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
+            d_needs_synch[level_number] = true;
+            continue;
+        }
+
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -1486,7 +1623,6 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
                 new LNodeSetData(current_idx_data->getBox(), current_idx_data->getGhostCellWidth());
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            std::set<int> registered_periodic_idx;
             for (LNodeSetData::CellIterator it(Box<NDIM>::grow(patch_box, IntVector<NDIM>(CFL_WIDTH))); it; it++)
             {
                 const Index<NDIM>& old_cell_idx = *it;
@@ -1501,22 +1637,18 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
                         const CellIndex<NDIM> new_cell_idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
                         if (patch_box.contains(new_cell_idx))
                         {
-                            std::map<int, IntVector<NDIM> >::const_iterator it_offset =
-                                periodic_offset_data[level_number].find(local_idx);
-                            const bool periodic_node = it_offset != periodic_offset_data[level_number].end();
+                            const int shift_idx = periodic_shift_idxs[local_idx];
+                            const bool periodic_node = shift_idx != -1;
                             const bool unregistered_periodic_node =
-                                periodic_node &&
-                                registered_periodic_idx.find(local_idx) == registered_periodic_idx.end();
+                                periodic_node && d_periodic_shift_patch_nums[shift_idx] != p();
                             if (!periodic_node || unregistered_periodic_node)
                             {
                                 if (unregistered_periodic_node)
                                 {
-                                    const IntVector<NDIM>& periodic_offset = it_offset->second;
-                                    std::map<int, Vector>::const_iterator it_displacement =
-                                        periodic_displacement_data[level_number].find(local_idx);
-                                    const Vector& periodic_displacement = it_displacement->second;
+                                    const IntVector<NDIM>& periodic_offset = periodic_shifts[shift_idx].first;
+                                    const Vector& periodic_displacement = periodic_shifts[shift_idx].second;
                                     node_idx->registerPeriodicShift(periodic_offset, periodic_displacement);
-                                    registered_periodic_idx.insert(local_idx);
+                                    d_periodic_shift_patch_nums[shift_idx] = p();
                                 }
                                 if (!new_idx_data->isElement(new_cell_idx))
                                     new_idx_data->appendItemPointer(new_cell_idx, new LNodeSet());
@@ -1574,7 +1706,6 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     {
         if (!d_level_contains_lag_data[level_number] || d_displaced_strct_ids[level_number].empty()) continue;
 
-        const int num_procs = SAMRAI_MPI::getNodes();
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
         Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
         const ProcessorMapping& processor_mapping = level->getProcessorMapping();
@@ -1585,11 +1716,9 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_displaced_strct_lnode_posns[level_number].size() == num_nodes);
 #endif
-        typedef LNodeTransaction::LTransactionComponent LNodeTransactionComponent;
-        std::vector<std::vector<LNodeTransactionComponent> > src_index_set(num_procs);
+        std::vector<int> dst_procs(num_nodes);
         for (size_t k = 0; k < num_nodes; ++k)
         {
-            LNodeSet::value_type& lag_idx = d_displaced_strct_lnode_idxs[level_number][k];
             const Point& posn = d_displaced_strct_lnode_posns[level_number][k];
             const CellIndex<NDIM> cell_idx = IndexUtilities::getCellIndex(posn, d_grid_geom, ratio);
 
@@ -1602,58 +1731,11 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
 #if !defined(NDEBUG)
             TBOX_ASSERT(patch_num >= 0 && patch_num < level->getNumberOfPatches());
 #endif
-            const int dst_proc = processor_mapping.getProcessorAssignment(patch_num);
-            LNodeTransactionComponent component(lag_idx, posn);
-            src_index_set[dst_proc].push_back(component);
+            dst_procs[k] = processor_mapping.getProcessorAssignment(patch_num);
         }
 
-        // Setup communication transactions between each pair of processors.
-        Schedule lnode_idx_data_mover;
-        std::vector<std::vector<Pointer<Transaction> > > transactions(num_procs,
-                                                                      std::vector<Pointer<Transaction> >(num_procs));
-        for (int src_proc = 0; src_proc < num_procs; ++src_proc)
-        {
-            for (int dst_proc = 0; dst_proc < num_procs; ++dst_proc)
-            {
-                if (src_proc == SAMRAI_MPI::getRank())
-                {
-                    transactions[src_proc][dst_proc] =
-                        new LNodeTransaction(src_proc, dst_proc, src_index_set[dst_proc]);
-                }
-                else
-                {
-                    transactions[src_proc][dst_proc] = new LNodeTransaction(src_proc, dst_proc);
-                }
-                lnode_idx_data_mover.appendTransaction(transactions[src_proc][dst_proc]);
-            }
-        }
-
-        // Communicate the data.
-        lnode_idx_data_mover.communicate();
-
-        // Clear the cached displaced nodes.
-        d_displaced_strct_lnode_idxs[level_number].clear();
-        d_displaced_strct_lnode_posns[level_number].clear();
-
-        // Retrieve the communicated values.
-        for (int src_proc = 0; src_proc < num_procs; ++src_proc)
-        {
-            for (int dst_proc = 0; dst_proc < num_procs; ++dst_proc)
-            {
-                if (dst_proc == SAMRAI_MPI::getRank())
-                {
-                    Pointer<LNodeTransaction> transaction = transactions[src_proc][dst_proc];
-                    const std::vector<LNodeTransactionComponent>& dst_index_set = transaction->getDestinationData();
-                    for (std::vector<LNodeTransactionComponent>::const_iterator cit = dst_index_set.begin();
-                         cit != dst_index_set.end();
-                         ++cit)
-                    {
-                        d_displaced_strct_lnode_idxs[level_number].push_back(cit->item);
-                        d_displaced_strct_lnode_posns[level_number].push_back(cit->posn);
-                    }
-                }
-            }
-        }
+        // Send the displaced nodes to the processors that now own them.
+        migrateDisplacedNodes(level_number, dst_procs);
 
         // Determine which patch owns each of the local displaced nodes.
         num_nodes = d_displaced_strct_lnode_idxs[level_number].size();
@@ -1889,12 +1971,11 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         }
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
         const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
-        std::set<int> local_petsc_idxs;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_node_ordering);
             const Box<NDIM>& ghost_box = idx_data->getGhostBox();
             for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
             {
@@ -1903,7 +1984,6 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
                 TBOX_ASSERT(0 <= local_petsc_idx && local_petsc_idx < num_local_and_ghost_nodes);
                 Pointer<LNode> node_idx = local_and_ghost_node_ptrs[local_petsc_idx];
                 *node_idx = *tmp_node_idx;
-                local_petsc_idxs.insert(local_petsc_idx);
                 *it = node_idx;
                 TBOX_ASSERT((*it).getPointer() == node_idx.getPointer());
             }
@@ -1959,6 +2039,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
         d_needs_synch[level_number] = false;
+        d_redistribution_boxes[level_number] = d_hierarchy->getPatchLevel(level_number)->getBoxes();
 
         if (d_ao[level_number])
         {
@@ -1987,6 +2068,11 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         d_silo_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
     }
 
+    // Return the pooled storage that is no longer used by any node or node set
+    // to the global heap.
+    LObjectPool<LNode>::releaseUnusedChunks();
+    LObjectPool<LNodeSet>::releaseUnusedChunks();
+
     IBTK_TIMER_STOP(t_end_data_redistribution);
     return;
 } // endDataRedistribution
@@ -2158,6 +2244,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
         d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
         d_displaced_strct_lnode_posns.resize(d_finest_ln + 1);
+        d_redistribution_boxes.resize(level_number + 1);
         d_lag_mesh.resize(level_number + 1);
         d_lag_mesh_data.resize(level_number + 1);
         d_needs_synch.resize(level_number + 1, false);
@@ -2174,6 +2261,13 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
 #endif
         d_level_contains_lag_data[level_number] = d_lag_init->getLevelHasLagrangianData(level_number, can_be_refined);
     }
+
+    // The index data of a (re-)initialized level must be rebuilt from scratch
+    // at the next redistribution.
+    if (level_number < static_cast<int>(d_redistribution_boxes.size()))
+    {
+        d_redistribution_boxes[level_number] = BoxArray<NDIM>();
+    }
     if (initial_time && d_level_contains_lag_data[level_number])
     {
         int ierr;
@@ -2288,7 +2382,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
 
             node_count_data->fillAll(0.0);
 
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_node_ordering);
             for (LNodeSetData::SetIterator it(*idx_data); it; it++)
             {
                 const CellIndex<NDIM>& i = it.getIndex();
@@ -2676,6 +2770,10 @@ LDataManager::LDataManager(const std::string& object_name,
       d_default_spread_kernel_fcn(default_spread_kernel_fcn),
       d_error_if_points_leave_domain(error_if_points_leave_domain),
       d_ghost_width(ghost_width),
+      d_node_ordering(NATURAL_NODE_ORDERING),
+      d_permute_lag_data(false),
+      d_incremental_redistribution(false),
+      d_redistribution_boxes(),
       d_lag_node_index_bdry_fill_alg(NULL),
       d_lag_node_index_bdry_fill_scheds(),
       d_node_count_coarsen_alg(NULL),
@@ -2940,6 +3038,10 @@ LDataManager::computeNodeDistribution(AO& ao,
     TBOX_ASSERT(level_number >= d_coarsest_ln && level_number <= d_finest_ln);
 #endif
 
+    // The number of nodes in the previous distribution is used to size the
+    // map from Lagrangian to local PETSc indices.
+    LagrangianIndexMap lag_idx_to_petsc_idx(local_lag_indices.size() + nonlocal_lag_indices.size());
+
     local_lag_indices.clear();
     nonlocal_lag_indices.clear();
     local_petsc_indices.clear();
@@ -2962,13 +3064,47 @@ LDataManager::computeNodeDistribution(AO& ao,
 
     // Collect the local nodes and assign local indices to the local nodes.
     unsigned int local_offset = 0;
-    std::map<int, int> lag_idx_to_petsc_idx;
 #if 1
+    const bool use_node_ordering = d_permute_lag_data && d_node_ordering == MORTON_NODE_ORDERING;
+    std::vector<std::pair<unsigned long, LNode*> > ordered_nodes;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
         const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        if (use_node_ordering)
+        {
+            // Permute the local nodes so that they are ordered along a
+            // space-filling curve through the patch.
+            //
+            // NOTE: Nodes in the same cell retain their relative order because
+            // the sort is stable.
+            ordered_nodes.clear();
+            for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+            {
+                const CellIndex<NDIM>& i = it.getIndex();
+                if (!patch_box.contains(i)) continue;
+                const unsigned long key = IndexUtilities::getMortonIndex(i, idx_data->getGhostBox().lower());
+                const LNodeSet& node_set = *it;
+                for (LNodeSet::const_iterator n = node_set.begin(); n != node_set.end(); ++n)
+                {
+                    ordered_nodes.push_back(std::make_pair(key, n->getPointer()));
+                }
+            }
+            std::stable_sort(ordered_nodes.begin(), ordered_nodes.end(), MortonKeyComp());
+            for (std::vector<std::pair<unsigned long, LNode*> >::const_iterator it = ordered_nodes.begin();
+                 it != ordered_nodes.end();
+                 ++it)
+            {
+                LNode* const node_idx = it->second;
+                const int lag_idx = node_idx->getLagrangianIndex();
+                local_lag_indices.push_back(lag_idx);
+                const int petsc_idx = local_offset++;
+                node_idx->setLocalPETScIndex(petsc_idx);
+                lag_idx_to_petsc_idx.insert(lag_idx, petsc_idx);
+            }
+            continue;
+        }
         for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
         {
             LNode* const node_idx = *it;
@@ -2976,7 +3112,7 @@ LDataManager::computeNodeDistribution(AO& ao,
             local_lag_indices.push_back(lag_idx);
             const int petsc_idx = local_offset++;
             node_idx->setLocalPETScIndex(petsc_idx);
-            lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+            lag_idx_to_petsc_idx.insert(lag_idx, petsc_idx);
         }
     }
 #else
@@ -2997,7 +3133,7 @@ LDataManager::computeNodeDistribution(AO& ao,
                 local_lag_indices.push_back(lag_idx);
                 const int petsc_idx = local_offset++;
                 node_idx->setLocalPETScIndex(petsc_idx);
-                lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+                lag_idx_to_petsc_idx.insert(lag_idx, petsc_idx);
             }
         }
     }
@@ -3017,19 +3153,19 @@ LDataManager::computeNodeDistribution(AO& ao,
             {
                 LNode* const node_idx = *it;
                 const int lag_idx = node_idx->getLagrangianIndex();
-                std::map<int, int>::const_iterator idx_it = lag_idx_to_petsc_idx.find(lag_idx);
-                if (idx_it == lag_idx_to_petsc_idx.end())
+                const int existing_petsc_idx = lag_idx_to_petsc_idx.find(lag_idx);
+                if (existing_petsc_idx == -1)
                 {
                     // This is the first time we have encountered this index; it
                     // must be a nonlocal index.
                     nonlocal_lag_indices.push_back(lag_idx);
                     const int petsc_idx = local_offset++;
                     node_idx->setLocalPETScIndex(petsc_idx);
-                    lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+                    lag_idx_to_petsc_idx.insert(lag_idx, petsc_idx);
                 }
                 else
                 {
-                    node_idx->setLocalPETScIndex(idx_it->second);
+                    node_idx->setLocalPETScIndex(existing_petsc_idx);
                 }
             }
         }
@@ -3141,6 +3277,237 @@ LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_off
     return;
 } // computeNodeOffsets
 
+void
+LDataManager::updateIndexDataInPlace(const int patch_num,
+                                     const int level_number,
+                                     const double* const X_data,
+                                     const Pointer<CartesianGridGeometry<NDIM> > grid_geom,
+                                     const IntVector<NDIM>& ratio)
+{
+    Pointer<Patch<NDIM> > patch = d_hierarchy->getPatchLevel(level_number)->getPatch(patch_num);
+    Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+    const std::vector<int>& periodic_shift_idxs = d_periodic_shift_idxs[level_number];
+    const std::vector<std::pair<IntVector<NDIM>, Vector> >& periodic_shifts = d_periodic_shifts[level_number];
+    const Box<NDIM>& patch_box = patch->getBox();
+
+    // Remove the nodes that have left their cells.  Nodes that remain in the
+    // same interior cell are left in place.  Nodes that move into a different
+    // cell of the patch interior are collected so that they can be reinserted
+    // once all of the cells have been visited.
+    std::vector<std::pair<CellIndex<NDIM>, LNodeSet::value_type> > arriving_nodes;
+    for (LNodeSetData::CellIterator it(Box<NDIM>::grow(patch_box, IntVector<NDIM>(CFL_WIDTH))); it; it++)
+    {
+        const Index<NDIM>& old_cell_idx = *it;
+        LNodeSet* const node_set = idx_data->getItem(old_cell_idx);
+        if (!node_set) continue;
+        const bool interior_cell = patch_box.contains(old_cell_idx);
+        LNodeSet::DataSet& nodes = node_set->getDataSet();
+        size_t num_kept_nodes = 0;
+        for (LNodeSet::iterator n = nodes.begin(); n != nodes.end(); ++n)
+        {
+            LNodeSet::value_type& node_idx = *n;
+            const int local_idx = node_idx->getLocalPETScIndex();
+            const CellIndex<NDIM> new_cell_idx =
+                IndexUtilities::getCellIndex(&X_data[NDIM * local_idx], grid_geom, ratio);
+            const int shift_idx = periodic_shift_idxs[local_idx];
+            const bool periodic_node = shift_idx != -1;
+            if (interior_cell && !periodic_node && new_cell_idx == old_cell_idx)
+            {
+                nodes[num_kept_nodes++] = node_idx;
+                continue;
+            }
+            if (!patch_box.contains(new_cell_idx)) continue;
+            if (periodic_node)
+            {
+                if (d_periodic_shift_patch_nums[shift_idx] == patch_num) continue;
+                const IntVector<NDIM>& periodic_offset = periodic_shifts[shift_idx].first;
+                const Vector& periodic_displacement = periodic_shifts[shift_idx].second;
+                node_idx->registerPeriodicShift(periodic_offset, periodic_displacement);
+                d_periodic_shift_patch_nums[shift_idx] = patch_num;
+            }
+            arriving_nodes.push_back(std::make_pair(new_cell_idx, node_idx));
+        }
+        if (interior_cell)
+        {
+            nodes.resize(num_kept_nodes);
+            if (nodes.empty()) idx_data->removeItem(old_cell_idx);
+        }
+    }
+
+    // Only the nodes owned by the patch are retained; the ghost cell data are
+    // refilled by endDataRedistribution().
+    idx_data->removeGhostItems();
+
+    // Insert the nodes that have moved into a new interior cell, keeping the
+    // nodes in each cell sorted by Lagrangian index.
+    for (std::vector<std::pair<CellIndex<NDIM>, LNodeSet::value_type> >::const_iterator cit = arriving_nodes.begin();
+         cit != arriving_nodes.end();
+         ++cit)
+    {
+        const CellIndex<NDIM>& new_cell_idx = cit->first;
+        const LNodeSet::value_type& node_idx = cit->second;
+        if (!idx_data->isElement(new_cell_idx)) idx_data->appendItemPointer(new_cell_idx, new LNodeSet());
+        LNodeSet::DataSet& nodes = idx_data->getItem(new_cell_idx)->getDataSet();
+        LNodeSet::iterator pos =
+            std::lower_bound(nodes.begin(), nodes.end(), node_idx, LNodeIndexLagrangianIndexComp());
+        if (pos == nodes.end() || (*pos)->getLagrangianIndex() != node_idx->getLagrangianIndex())
+        {
+            nodes.insert(pos, node_idx);
+        }
+    }
+    return;
+} // updateIndexDataInPlace
+
+void
+LDataManager::migrateDisplacedNodes(const int level_number, const std::vector<int>& dst_procs)
+{
+    const MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int mpi_tag = MIGRATION_TAG + level_number;
+
+    std::vector<LNodeSet::value_type>& lnode_idxs = d_displaced_strct_lnode_idxs[level_number];
+    std::vector<Point>& lnode_posns = d_displaced_strct_lnode_posns[level_number];
+    const int num_nodes = static_cast<int>(lnode_idxs.size());
+#if !defined(NDEBUG)
+    TBOX_ASSERT(static_cast<int>(lnode_posns.size()) == num_nodes);
+    TBOX_ASSERT(static_cast<int>(dst_procs.size()) == num_nodes);
+#endif
+
+    // Group the displaced nodes by destination processor and determine the
+    // size of each outgoing message.  Nodes that remain on this processor are
+    // not communicated.
+    d_migration_node_order.resize(num_nodes);
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        d_migration_node_order[k] = std::make_pair(dst_procs[k], k);
+    }
+    std::sort(d_migration_node_order.begin(), d_migration_node_order.end());
+    d_migration_msg_flags.assign(mpi_size, 0);
+    std::vector<int> send_procs, send_begin, send_end, send_offset(1, 0);
+    for (int i = 0; i < num_nodes;)
+    {
+        const int dst_proc = d_migration_node_order[i].first;
+        int j = i;
+        int bytes = AbstractStream::sizeofInt();
+        for (; j < num_nodes && d_migration_node_order[j].first == dst_proc; ++j)
+        {
+            const int k = d_migration_node_order[j].second;
+            bytes += static_cast<int>(lnode_idxs[k]->getDataStreamSize()) + AbstractStream::sizeofDouble(NDIM);
+        }
+        if (dst_proc != mpi_rank)
+        {
+            d_migration_msg_flags[dst_proc] = 1;
+            send_procs.push_back(dst_proc);
+            send_begin.push_back(i);
+            send_end.push_back(j);
+            send_offset.push_back(send_offset.back() + bytes);
+        }
+        i = j;
+    }
+    const int num_sends = static_cast<int>(send_procs.size());
+
+    // Determine the number of incoming messages.  Each processor only learns
+    // the number of processors that will send data to it, which avoids
+    // forming any data structure that scales like the square of the number of
+    // processors.
+    d_migration_recv_counts.assign(mpi_size, 1);
+    int num_recvs = 0;
+    MPI_Reduce_scatter(
+        &d_migration_msg_flags[0], &num_recvs, &d_migration_recv_counts[0], MPI_INT, MPI_SUM, communicator);
+
+    // Pack and post the outgoing messages.
+    FixedSizedStream send_stream(send_offset.back());
+    d_migration_send_reqs.resize(num_sends);
+    for (int m = 0; m < num_sends; ++m)
+    {
+        send_stream << send_end[m] - send_begin[m];
+        for (int j = send_begin[m]; j < send_end[m]; ++j)
+        {
+            const int k = d_migration_node_order[j].second;
+            lnode_idxs[k]->packStream(send_stream);
+            send_stream.pack(lnode_posns[k].data(), NDIM);
+        }
+#if !defined(NDEBUG)
+        TBOX_ASSERT(send_stream.getCurrentSize() == send_offset[m + 1]);
+#endif
+        char* const send_buf = static_cast<char*>(send_stream.getBufferStart()) + send_offset[m];
+        MPI_Isend(send_buf,
+                  send_offset[m + 1] - send_offset[m],
+                  MPI_CHAR,
+                  send_procs[m],
+                  mpi_tag,
+                  communicator,
+                  &d_migration_send_reqs[m]);
+    }
+
+    // Retain the nodes that remain on this processor.
+    int num_kept_nodes = 0;
+    for (int j = 0; j < num_nodes; ++j)
+    {
+        if (d_migration_node_order[j].first != mpi_rank) continue;
+        const int k = d_migration_node_order[j].second;
+        lnode_idxs[num_kept_nodes] = lnode_idxs[k];
+        lnode_posns[num_kept_nodes] = lnode_posns[k];
+        ++num_kept_nodes;
+    }
+
+    // Receive the incoming messages in the order in which they arrive, but
+    // unpack them in order of source rank, so that the order of the received
+    // nodes does not depend on message timing.  The receive buffer is retained
+    // between calls.
+    std::vector<std::pair<int, std::pair<int, int> > > recv_msgs(num_recvs);
+    int recv_buffer_size = 0;
+    for (int m = 0; m < num_recvs; ++m)
+    {
+        MPI_Status status;
+        MPI_Probe(MPI_ANY_SOURCE, mpi_tag, communicator, &status);
+        int bytes = 0;
+        MPI_Get_count(&status, MPI_CHAR, &bytes);
+        if (static_cast<int>(d_migration_recv_buffer.size()) < recv_buffer_size + bytes)
+        {
+            d_migration_recv_buffer.resize(recv_buffer_size + bytes);
+        }
+        MPI_Recv(&d_migration_recv_buffer[recv_buffer_size],
+                 bytes,
+                 MPI_CHAR,
+                 status.MPI_SOURCE,
+                 mpi_tag,
+                 communicator,
+                 MPI_STATUS_IGNORE);
+        recv_msgs[m] = std::make_pair(status.MPI_SOURCE, std::make_pair(recv_buffer_size, bytes));
+        recv_buffer_size += bytes;
+    }
+    std::sort(recv_msgs.begin(), recv_msgs.end());
+    static const IntVector<NDIM> periodic_offset = 0;
+    std::vector<LNodeSet::value_type> recv_idxs;
+    std::vector<Point> recv_posns;
+    for (int m = 0; m < num_recvs; ++m)
+    {
+        FixedSizedStream recv_stream(&d_migration_recv_buffer[recv_msgs[m].second.first], recv_msgs[m].second.second);
+        int num_items;
+        recv_stream >> num_items;
+        for (int j = 0; j < num_items; ++j)
+        {
+            recv_idxs.push_back(LNodeSet::value_type(new LNode(recv_stream, periodic_offset)));
+            recv_posns.push_back(Point());
+            recv_stream.unpack(recv_posns.back().data(), NDIM);
+        }
+    }
+
+    // Wait for the outgoing messages to complete before releasing the nodes
+    // that have been sent to other processors.
+    if (num_sends > 0)
+    {
+        MPI_Waitall(num_sends, &d_migration_send_reqs[0], MPI_STATUSES_IGNORE);
+    }
+    lnode_idxs.resize(num_kept_nodes);
+    lnode_posns.resize(num_kept_nodes);
+    lnode_idxs.insert(lnode_idxs.end(), recv_idxs.begin(), recv_idxs.end());
+    lnode_posns.insert(lnode_posns.end(), recv_posns.begin(), recv_posns.end());
+    return;
+} // migrateDisplacedNodes
+
 void
 LDataManager::getFromRestart()
 {
@@ -3178,6 +3545,7 @@ LDataManager::getFromRestart()
     d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_posns.resize(d_finest_ln + 1);
+    d_redistribution_boxes.resize(d_finest_ln + 1);
     d_lag_mesh.resize(d_finest_ln + 1);
     d_lag_mesh_data.resize(d_finest_ln + 1);
     d_needs_synch.resize(d_finest_ln + 1, false);
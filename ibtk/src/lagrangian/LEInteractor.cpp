@@ -34,9 +34,16 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
 #include <ostream>
 #include <string>
 #include <vector>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
 
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
@@ -64,8 +71,20 @@
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+// Instruction-set-specific versions of the C++ interaction routines.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IBTK_LE_MULTIVERSION
+#define IBTK_LE_ALWAYS_INLINE __attribute__((always_inline))
+#define IBTK_LE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define IBTK_LE_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define IBTK_LE_ALWAYS_INLINE
+#endif
+
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC                                                                        \
@@ -986,6 +1005,136 @@ NINT(double a)
     return (a >= 0.0 ? static_cast<int>(a + 0.5) : static_cast<int>(a - 0.5));
 }
 
+// The number of colors required so that bins of the same color are never
+// adjacent.
+static const unsigned int NCOLORS = 1 << NDIM;
+
+inline int
+get_max_spread_threads()
+{
+#if defined(_OPENMP)
+    return omp_in_parallel() ? 1 : omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+inline int
+get_spread_thread_num()
+{
+#if defined(_OPENMP)
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+inline int
+get_spread_team_size()
+{
+#if defined(_OPENMP)
+    return omp_get_num_threads();
+#else
+    return 1;
+#endif
+}
+
+// Lagrangian points sorted into Cartesian bins, along with the positions of the
+// points in the unsorted list and the lists of nonempty bins of each color.
+struct SpreadingBins
+{
+    std::vector<int> local_indices;
+    std::vector<double> periodic_shifts;
+    std::vector<int> positions;
+    std::vector<int> bin_offsets;
+    boost::array<std::vector<int>, NCOLORS> color_bins;
+};
+
+void
+build_spreading_bins(SpreadingBins& bins,
+                     const int bin_width,
+                     const Box<NDIM>& q_data_box,
+                     const IntVector<NDIM>& q_gcw,
+                     const double* const X_data,
+                     const double* const x_lower,
+                     const double* const dx,
+                     const std::vector<int>& local_indices,
+                     const std::vector<double>& periodic_shifts)
+{
+    // Bins cover the ghost box of the patch data along with one additional
+    // layer of cells on each side.  Points outside of this region are assigned
+    // to the nearest bin; the kernel stencils of such points are truncated to
+    // the ghost box, so this does not introduce write conflicts.
+    boost::array<int, NDIM> extent, num_bins;
+    int total_num_bins = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        extent[d] = q_data_box.numberCells(d) + 2 * q_gcw(d) + 2;
+        num_bins[d] = (extent[d] + bin_width - 1) / bin_width;
+        total_num_bins *= num_bins[d];
+    }
+
+    // Determine the bin of each point.
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    std::vector<int> point_bin(num_local_indices);
+    bins.bin_offsets.assign(total_num_bins + 1, 0);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        int bin = 0, stride = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double X_o_dx = (X_data[NDIM * s + d] + periodic_shifts[NDIM * l + d] - x_lower[d]) / dx[d];
+            const double ic = std::floor(X_o_dx) + static_cast<double>(q_gcw(d) + 1);
+            const int i = static_cast<int>(std::min(std::max(ic, 0.0), static_cast<double>(extent[d] - 1)));
+            bin += stride * (i / bin_width);
+            stride *= num_bins[d];
+        }
+        point_bin[l] = bin;
+        ++bins.bin_offsets[bin + 1];
+    }
+    for (int bin = 0; bin < total_num_bins; ++bin)
+    {
+        bins.bin_offsets[bin + 1] += bins.bin_offsets[bin];
+    }
+
+    // Sort the points by bin.  The sort is stable, so that the points in each
+    // bin are ordered in the same way as in local_indices.
+    bins.local_indices.resize(num_local_indices);
+    bins.periodic_shifts.resize(NDIM * num_local_indices);
+    bins.positions.resize(num_local_indices);
+    std::vector<int> bin_fill(bins.bin_offsets.begin(), bins.bin_offsets.end() - 1);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int k = bin_fill[point_bin[l]]++;
+        bins.local_indices[k] = local_indices[l];
+        bins.positions[k] = l;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            bins.periodic_shifts[NDIM * k + d] = periodic_shifts[NDIM * l + d];
+        }
+    }
+
+    // Collect the nonempty bins of each color.
+    for (unsigned int color = 0; color < NCOLORS; ++color)
+    {
+        bins.color_bins[color].clear();
+    }
+    for (int bin = 0; bin < total_num_bins; ++bin)
+    {
+        if (bins.bin_offsets[bin + 1] == bins.bin_offsets[bin]) continue;
+        unsigned int color = 0;
+        int idx = bin;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            color |= static_cast<unsigned int>((idx % num_bins[d]) % 2) << d;
+            idx /= num_bins[d];
+        }
+        bins.color_bins[color].push_back(bin);
+    }
+    return;
+} // build_spreading_bins
+
 typedef boost::multi_array<double, 1> Weight;
 typedef boost::array<Weight, NDIM> TensorProductWeights;
 typedef boost::multi_array<double, NDIM> MLSWeight;
@@ -1254,84 +1403,1249 @@ interpolate_data(const int stencil_sz,
 #if (NDIM == 3)
     for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
     {
-        const int ic2 = stencil_lower[2] + i2;
-#endif
-        for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+        const int ic2 = stencil_lower[2] + i2;
+#endif
+        for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+        {
+            const int ic1 = stencil_lower[1] + i1;
+            for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+            {
+                const int ic0 = stencil_lower[0] + i0;
+#if (NDIM == 2)
+                const Index<NDIM> idx(ic0, ic1);
+                Q += q_data(idx, q_comp) * Psi[i1][i0];
+#elif(NDIM == 3)
+            const Index<NDIM> idx(ic0, ic1, ic2);
+            Q += q_data(idx, q_comp) * Psi[i2][i1][i0];
+#endif
+            }
+        }
+#if (NDIM == 3)
+    }
+#endif
+
+    return;
+
+} // interpolate_data
+
+void
+spread_data(const int stencil_sz,
+            const int* const ig_lower,
+            const int* const ig_upper,
+            const int* const stencil_lower,
+            const int* const stencil_upper,
+            const double* const dx,
+            ArrayData<NDIM, double>& q_data,
+            const int q_comp,
+            const MLSWeight& Psi,
+            const double& Q)
+{
+    int istart[NDIM], istop[NDIM];
+    double fac = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        istart[d] = std::max(ig_lower[d] - stencil_lower[d], 0);
+        istop[d] = (stencil_sz - 1) - std::max(stencil_upper[d] - ig_upper[d], 0);
+        fac /= dx[d];
+    }
+
+#if (NDIM == 3)
+    for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+    {
+        const int ic2 = stencil_lower[2] + i2;
+#endif
+        for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+        {
+            const int ic1 = stencil_lower[1] + i1;
+            for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+            {
+                const int ic0 = stencil_lower[0] + i0;
+#if (NDIM == 2)
+                const Index<NDIM> idx(ic0, ic1);
+                q_data(idx, q_comp) += Q * Psi[i1][i0] * fac;
+#elif(NDIM == 3)
+            const Index<NDIM> idx(ic0, ic1, ic2);
+            q_data(idx, q_comp) += Q * Psi[i2][i1][i0] * fac;
+#endif
+            }
+        }
+#if (NDIM == 3)
+    }
+#endif
+} // spread_data
+
+// Kernel functions that are evaluated by the C++ interaction engine.  Kernel
+// functions that are not listed here (e.g., DISCONTINUOUS_LINEAR and
+// USER_DEFINED) are handled by the original implementations.
+enum KernelFcnType
+{
+    PIECEWISE_CONSTANT_KERNEL,
+    PIECEWISE_LINEAR_KERNEL,
+    PIECEWISE_CUBIC_KERNEL,
+    IB_3_KERNEL,
+    IB_4_KERNEL,
+    IB_4_W8_KERNEL,
+    IB_5_KERNEL,
+    IB_6_KERNEL,
+    BSPLINE_3_KERNEL,
+    BSPLINE_4_KERNEL,
+    BSPLINE_5_KERNEL,
+    BSPLINE_6_KERNEL,
+    UNKNOWN_KERNEL = -1
+};
+
+inline KernelFcnType
+get_kernel_fcn_type(const std::string& kernel_fcn)
+{
+    if (kernel_fcn == "IB_4") return IB_4_KERNEL;
+    if (kernel_fcn == "PIECEWISE_LINEAR") return PIECEWISE_LINEAR_KERNEL;
+    if (kernel_fcn == "IB_6") return IB_6_KERNEL;
+    if (kernel_fcn == "IB_3") return IB_3_KERNEL;
+    if (kernel_fcn == "IB_5") return IB_5_KERNEL;
+    if (kernel_fcn == "IB_4_W8") return IB_4_W8_KERNEL;
+    if (kernel_fcn == "PIECEWISE_CONSTANT") return PIECEWISE_CONSTANT_KERNEL;
+    if (kernel_fcn == "PIECEWISE_CUBIC") return PIECEWISE_CUBIC_KERNEL;
+    if (kernel_fcn == "BSPLINE_3") return BSPLINE_3_KERNEL;
+    if (kernel_fcn == "BSPLINE_4") return BSPLINE_4_KERNEL;
+    if (kernel_fcn == "BSPLINE_5") return BSPLINE_5_KERNEL;
+    if (kernel_fcn == "BSPLINE_6") return BSPLINE_6_KERNEL;
+    return UNKNOWN_KERNEL;
+}
+
+inline int
+FLOOR(const double a)
+{
+    return static_cast<int>(std::floor(a));
+}
+
+// Each kernel class provides the stencil width, the lower index of the stencil
+// for a point located at X_o_dx = (X - x_lower)/dx, and the one-dimensional
+// weights for the cells of that stencil.  All indices are relative to the lower
+// index of the patch box.  The stencils and weights are the same as those used
+// by the Fortran implementations in lagrangian_interaction{2d,3d}.f.m4, except
+// that the stencil is always chosen using the periodically shifted position of
+// the point, and that the weights of stencils that are truncated at the edge of
+// the ghost box remain aligned with the corresponding cells.
+//
+// The weights of several points are computed at once.  Kernels that require
+// square roots first compute the NUM_ROOTS radicands for each point, the square
+// roots of all radicands of the batch are taken together, and the weights are
+// then computed from the roots.  Radicands, roots, and weights are stored with
+// the specified stride.
+struct PiecewiseConstantKernel
+{
+    static const int WIDTH = 1;
+    static const int NUM_ROOTS = 0;
+    static inline int lower(const double X_o_dx)
+    {
+        return NINT(X_o_dx - 0.5);
+    }
+    static inline void
+    radicands(const double /*X_o_dx*/, const int /*ic_lower*/, double* const /*a*/, const int /*stride*/)
+    {
+        return;
+    }
+    static inline void weights(const double /*X_o_dx*/,
+                               const int /*ic_lower*/,
+                               const double* const /*roots*/,
+                               double* const w,
+                               const int /*stride*/)
+    {
+        w[0] = 1.0;
+    }
+};
+
+struct PiecewiseLinearKernel
+{
+    static const int WIDTH = 2;
+    static const int NUM_ROOTS = 0;
+    static inline int lower(const double X_o_dx)
+    {
+        const int ic_center = NINT(X_o_dx - 0.5);
+        return X_o_dx < static_cast<double>(ic_center) + 0.5 ? ic_center - 1 : ic_center;
+    }
+    static inline void
+    radicands(const double /*X_o_dx*/, const int /*ic_lower*/, double* const /*a*/, const int /*stride*/)
+    {
+        return;
+    }
+    static inline void weights(const double X_o_dx,
+                               const int ic_lower,
+                               const double* const /*roots*/,
+                               double* const w,
+                               const int stride)
+    {
+        w[0] = static_cast<double>(ic_lower) + 1.5 - X_o_dx;
+        w[stride] = 1.0 - w[0];
+    }
+};
+
+inline double
+piecewise_cubic_delta(double r)
+{
+    r = std::abs(r);
+    if (r < 1.0) return 1.0 - 0.5 * r - r * r + 0.5 * r * r * r;
+    if (r < 2.0) return 1.0 - (11.0 / 6.0) * r + r * r - (1.0 / 6.0) * r * r * r;
+    return 0.0;
+}
+
+inline double
+bspline_3_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 1.5;
+    const double r2 = r * r;
+    if (modx <= 0.5) return 0.5 * (-2.0 * r2 + 6.0 * r - 3.0);
+    if (modx <= 1.5) return 0.5 * (r2 - 6.0 * r + 9.0);
+    return 0.0;
+}
+
+inline double
+bspline_4_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 2.0;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    if (modx <= 1.0) return (1.0 / 6.0) * (3.0 * r3 - 24.0 * r2 + 60.0 * r - 44.0);
+    if (modx <= 2.0) return (1.0 / 6.0) * (-r3 + 12.0 * r2 - 48.0 * r + 64.0);
+    return 0.0;
+}
+
+inline double
+bspline_5_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 2.5;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    const double r4 = r3 * r;
+    if (modx <= 0.5) return (1.0 / 24.0) * (6.0 * r4 - 60.0 * r3 + 210.0 * r2 - 300.0 * r + 155.0);
+    if (modx <= 1.5) return (1.0 / 24.0) * (-4.0 * r4 + 60.0 * r3 - 330.0 * r2 + 780.0 * r - 655.0);
+    if (modx <= 2.5) return (1.0 / 24.0) * (r4 - 20.0 * r3 + 150.0 * r2 - 500.0 * r + 625.0);
+    return 0.0;
+}
+
+inline double
+bspline_6_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 3.0;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    const double r4 = r3 * r;
+    const double r5 = r4 * r;
+    if (modx <= 1.0)
+        return (1.0 / 60.0) * (2193.0 - 3465.0 * r + 2130.0 * r2 - 630.0 * r3 + 90.0 * r4 - 5.0 * r5);
+    if (modx <= 2.0)
+        return (1.0 / 120.0) * (-10974.0 + 12270.0 * r - 5340.0 * r2 + 1140.0 * r3 - 120.0 * r4 + 5.0 * r5);
+    if (modx <= 3.0) return (1.0 / 120.0) * (7776.0 - 6480.0 * r + 2160.0 * r2 - 360.0 * r3 + 30.0 * r4 - r5);
+    return 0.0;
+}
+
+// Kernels whose weights are obtained by evaluating a piecewise polynomial delta
+// function at the distance between the point and each cell center.  The stencil
+// of an even-width kernel is shifted according to the position of the point
+// within its cell.
+template <int W, double (*delta)(double)>
+struct PolynomialKernel
+{
+    static const int WIDTH = W;
+    static const int NUM_ROOTS = 0;
+    static inline int lower(const double X_o_dx)
+    {
+        const int ic_center = FLOOR(X_o_dx);
+        if (W % 2 == 1) return ic_center - W / 2;
+        return X_o_dx < static_cast<double>(ic_center) + 0.5 ? ic_center - W / 2 : ic_center - W / 2 + 1;
+    }
+    static inline void
+    radicands(const double /*X_o_dx*/, const int /*ic_lower*/, double* const /*a*/, const int /*stride*/)
+    {
+        return;
+    }
+    static inline void weights(const double X_o_dx,
+                               const int ic_lower,
+                               const double* const /*roots*/,
+                               double* const w,
+                               const int stride)
+    {
+        for (int k = 0; k < W; ++k)
+        {
+            w[k * stride] = delta(X_o_dx - (static_cast<double>(ic_lower + k) + 0.5));
+        }
+    }
+};
+
+typedef PolynomialKernel<4, &piecewise_cubic_delta> PiecewiseCubicKernel;
+typedef PolynomialKernel<3, &bspline_3_delta> BSpline3Kernel;
+typedef PolynomialKernel<4, &bspline_4_delta> BSpline4Kernel;
+typedef PolynomialKernel<5, &bspline_5_delta> BSpline5Kernel;
+typedef PolynomialKernel<6, &bspline_6_delta> BSpline6Kernel;
+
+struct IB3Kernel
+{
+    static const int WIDTH = 3;
+    static const int NUM_ROOTS = 3;
+    static inline int lower(const double X_o_dx)
+    {
+        return FLOOR(X_o_dx) - 1;
+    }
+    static inline void radicands(const double X_o_dx, const int ic_lower, double* const a, const int stride)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            const double r = std::abs(X_o_dx - (static_cast<double>(ic_lower + k) + 0.5));
+            a[k * stride] = r < 0.5 ? 1.0 - 3.0 * r * r : r < 1.5 ? 1.0 - 3.0 * (1.0 - r) * (1.0 - r) : 0.0;
+        }
+    }
+    static inline void weights(const double X_o_dx,
+                               const int ic_lower,
+                               const double* const roots,
+                               double* const w,
+                               const int stride)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            const double r = std::abs(X_o_dx - (static_cast<double>(ic_lower + k) + 0.5));
+            w[k * stride] = r < 0.5 ? (1.0 + roots[k * stride]) / 3.0 :
+                                      r < 1.5 ? (5.0 - 3.0 * r - roots[k * stride]) / 6.0 : 0.0;
+        }
+    }
+};
+
+struct IB4Kernel
+{
+    static const int WIDTH = 4;
+    static const int NUM_ROOTS = 1;
+    static inline int lower(const double X_o_dx)
+    {
+        return NINT(X_o_dx) - 2;
+    }
+    static inline void radicands(const double X_o_dx, const int ic_lower, double* const a, const int /*stride*/)
+    {
+        const double r = X_o_dx - (static_cast<double>(ic_lower + 1) + 0.5);
+        a[0] = 1.0 + 4.0 * r * (1.0 - r);
+    }
+    static inline void weights(const double X_o_dx,
+                               const int ic_lower,
+                               const double* const roots,
+                               double* const w,
+                               const int stride)
+    {
+        const double r = X_o_dx - (static_cast<double>(ic_lower + 1) + 0.5);
+        const double q = roots[0];
+        w[0] = 0.125 * (3.0 - 2.0 * r - q);
+        w[stride] = 0.125 * (3.0 - 2.0 * r + q);
+        w[2 * stride] = 0.125 * (1.0 + 2.0 * r + q);
+        w[3 * stride] = 0.125 * (1.0 + 2.0 * r - q);
+    }
+};
+
+struct IB4W8Kernel
+{
+    static const int WIDTH = 8;
+    static const int NUM_ROOTS = 2;
+    static inline int lower(const double X_o_dx)
+    {
+        return NINT(X_o_dx) - 4;
+    }
+    static inline void radicands(const double X_o_dx, const int ic_lower, double* const a, const int stride)
+    {
+        const double r = 0.5 * (X_o_dx - (static_cast<double>(ic_lower + 3) + 0.5));
+        a[0] = 1.0 + 4.0 * r * (1.0 - r);
+        a[stride] = 1.0 + 4.0 * (r + 0.5) * (0.5 - r);
+    }
+    static inline void weights(const double X_o_dx,
+                               const int ic_lower,
+                               const double* const roots,
+                               double* const w,
+                               const int stride)
+    {
+        double r = 0.5 * (X_o_dx - (static_cast<double>(ic_lower + 3) + 0.5));
+        double q = roots[0];
+        w[stride] = 0.0625 * (3.0 - 2.0 * r - q);
+        w[3 * stride] = 0.0625 * (3.0 - 2.0 * r + q);
+        w[5 * stride] = 0.0625 * (1.0 + 2.0 * r + q);
+        w[7 * stride] = 0.0625 * (1.0 + 2.0 * r - q);
+        r += 0.5;
+        q = roots[stride];
+        w[0] = 0.0625 * (3.0 - 2.0 * r - q);
+        w[2 * stride] = 0.0625 * (3.0 - 2.0 * r + q);
+        w[4 * stride] = 0.0625 * (1.0 + 2.0 * r + q);
+        w[6 * stride] = 0.0625 * (1.0 + 2.0 * r - q);
+    }
+};
+
+static const double IB_5_K = (38.0 - sqrt(69.0)) / 60.0;
+
+struct IB5Kernel
+{
+    static const int WIDTH = 5;
+    static const int NUM_ROOTS = 1;
+    static inline int lower(const double X_o_dx)
+    {
+        return FLOOR(X_o_dx) - 2;
+    }
+    static inline void radicands(const double X_o_dx, const int ic_lower, double* const a, const int /*stride*/)
+    {
+        const double K = IB_5_K;
+        const double r = X_o_dx - (static_cast<double>(ic_lower + 2) + 0.5);
+        const double r2 = r * r;
+        const double r4 = r2 * r2;
+        a[0] = 3123.0 - 6840.0 * K + 3600.0 * K * K - 12440.0 * r2 + 25680.0 * K * r2 - 12600.0 * K * K * r2 +
+               8080.0 * r4 - 8400.0 * K * r4 - 1400.0 * r4 * r2;
+    }
+    static inline void weights(const double X_o_dx,
+                               const int ic_lower,
+                               const double* const roots,
+                               double* const w,
+                               const int stride)
+    {
+        const double K = IB_5_K;
+        const double r = X_o_dx - (static_cast<double>(ic_lower + 2) + 0.5);
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        const double phi = (136.0 - 40.0 * K - 40.0 * r2 + sqrt(2.0) * roots[0]) / 280.0;
+        w[0] = (1.0 / 12.0) * (-2.0 + 2.0 * phi + 2.0 * K + r - 3.0 * K * r + 2.0 * r2 - r3);
+        w[stride] = (1.0 / 6.0) * (4.0 - 4.0 * phi - K - 4.0 * r + 3.0 * K * r - r2 + r3);
+        w[2 * stride] = phi;
+        w[3 * stride] = (1.0 / 6.0) * (4.0 - 4.0 * phi - K + 4.0 * r - 3.0 * K * r - r2 - r3);
+        w[4 * stride] = (1.0 / 12.0) * (-2.0 + 2.0 * phi + 2.0 * K - r + 3.0 * K * r + 2.0 * r2 + r3);
+    }
+};
+
+static const double IB_6_K = (59.0 / 60.0) * (1.0 - sqrt(1.0 - (3220.0 / 3481.0)));
+static const double IB_6_SGN = (1.5 - IB_6_K) >= 0.0 ? 1.0 : -1.0;
+
+struct IB6Kernel
+{
+    static const int WIDTH = 6;
+    static const int NUM_ROOTS = 1;
+    static inline int lower(const double X_o_dx)
+    {
+        return NINT(X_o_dx) - 3;
+    }
+    static inline void coefficients(const double r, double& beta, double& gamma)
+    {
+        const double K = IB_6_K;
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        beta = (9.0 / 4.0) - (3.0 / 2.0) * (K + r2) + ((22.0 / 3.0) - 7.0 * K) * r - (7.0 / 3.0) * r3;
+        gamma = 0.25 * (((161.0 / 36.0) - (59.0 / 6.0) * K + 5.0 * K * K) * 0.5 * r2 +
+                        (-(109.0 / 24.0) + 5.0 * K) * (1.0 / 3.0) * r2 * r2 + (5.0 / 18.0) * r3 * r3);
+    }
+    static inline void radicands(const double X_o_dx, const int ic_lower, double* const a, const int /*stride*/)
+    {
+        static const double alpha = 28.0;
+        const double r = 1.0 - X_o_dx + (static_cast<double>(ic_lower + 2) + 0.5);
+        double beta, gamma;
+        coefficients(r, beta, gamma);
+        a[0] = beta * beta - 4.0 * alpha * gamma;
+    }
+    static inline void weights(const double X_o_dx,
+                               const int ic_lower,
+                               const double* const roots,
+                               double* const w,
+                               const int stride)
+    {
+        static const double alpha = 28.0;
+        const double K = IB_6_K;
+        const double r = 1.0 - X_o_dx + (static_cast<double>(ic_lower + 2) + 0.5);
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        double beta, gamma;
+        coefficients(r, beta, gamma);
+        const double pm3 = (-beta + IB_6_SGN * roots[0]) / (2.0 * alpha);
+        w[0] = pm3;
+        w[stride] = -3.0 * pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) + (1.0 / 12.0) * (3.0 * K - 1.0) * r +
+                    (1.0 / 12.0) * r3;
+        w[2 * stride] = 2.0 * pm3 + (1.0 / 4.0) + (1.0 / 6.0) * (4.0 - 3.0 * K) * r - (1.0 / 6.0) * r3;
+        w[3 * stride] = 2.0 * pm3 + (5.0 / 8.0) - (1.0 / 4.0) * (K + r2);
+        w[4 * stride] = -3.0 * pm3 + (1.0 / 4.0) - (1.0 / 6.0) * (4.0 - 3.0 * K) * r + (1.0 / 6.0) * r3;
+        w[5 * stride] =
+            pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) - (1.0 / 12.0) * (3.0 * K - 1.0) * r - (1.0 / 12.0) * r3;
+    }
+};
+
+// Describes the layout of the (Fortran-ordered) patch data array and the part
+// of the index space in which the Lagrangian points are located.
+struct PatchArrayLayout
+{
+    PatchArrayLayout(const Box<NDIM>& box,
+                     const IntVector<NDIM>& gcw,
+                     const double* const x_lower_,
+                     const double* const dx_)
+        : x_lower(x_lower_), dx(dx_)
+    {
+        int stride = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            ig_lower[d] = -gcw(d);
+            ig_upper[d] = box.upper()(d) - box.lower()(d) + gcw(d);
+            strides[d] = stride;
+            stride *= ig_upper[d] - ig_lower[d] + 1;
+        }
+        depth_stride = stride;
+    }
+
+    const double* const x_lower;
+    const double* const dx;
+    int ig_lower[NDIM], ig_upper[NDIM], strides[NDIM], depth_stride;
+};
+
+// The stencils and weights of the Lagrangian points of a patch that are retained
+// between interpolation and spreading operations.  Slot l corresponds to the
+// l-th entry of the list of local indices of the patch.  The node index and the
+// (periodically shifted) position of each slot are stored along with its
+// weights, so that the weights are recomputed whenever the point has moved.
+struct WeightCacheEntry
+{
+    void resize(const int num_slots, const int width)
+    {
+        if (static_cast<int>(node.size()) == num_slots) return;
+        node.assign(num_slots, -1);
+        X.resize(NDIM * num_slots);
+        ic_lower.resize(NDIM * num_slots);
+        w.resize(NDIM * width * num_slots);
+        return;
+    }
+
+    std::vector<int> node;
+    std::vector<double> X;
+    std::vector<int> ic_lower;
+    std::vector<double> w;
+};
+
+// Cached stencils and weights are associated with a particular position array,
+// kernel function, and patch data geometry.
+struct WeightCacheKey
+{
+    WeightCacheKey(const double* const X_,
+                   const KernelFcnType kernel_fcn_type_,
+                   const Box<NDIM>& box,
+                   const double* const x_lower_,
+                   const double* const dx_)
+        : X(X_), kernel_fcn_type(kernel_fcn_type_)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            ilower[d] = box.lower()(d);
+            iupper[d] = box.upper()(d);
+            x_lower[d] = x_lower_[d];
+            dx[d] = dx_[d];
+        }
+    }
+
+    bool operator<(const WeightCacheKey& that) const
+    {
+        if (X != that.X) return X < that.X;
+        if (kernel_fcn_type != that.kernel_fcn_type) return kernel_fcn_type < that.kernel_fcn_type;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (ilower[d] != that.ilower[d]) return ilower[d] < that.ilower[d];
+            if (iupper[d] != that.iupper[d]) return iupper[d] < that.iupper[d];
+            if (x_lower[d] != that.x_lower[d]) return x_lower[d] < that.x_lower[d];
+            if (dx[d] != that.dx[d]) return dx[d] < that.dx[d];
+        }
+        return false;
+    }
+
+    const double* X;
+    KernelFcnType kernel_fcn_type;
+    int ilower[NDIM], iupper[NDIM];
+    double x_lower[NDIM], dx[NDIM];
+};
+
+// The weight cache.  Entries are only created or resized outside of threaded
+// regions, so that concurrent spreading threads only access existing entries.
+std::map<WeightCacheKey, int> weight_cache_ids;
+std::vector<WeightCacheEntry> weight_cache_entries;
+
+// The number of points whose stencils and weights were not found in the weight
+// cache, which is used to determine whether each access to a cache entry is a
+// hit or a miss.
+unsigned long weight_cache_num_misses = 0;
+
+// Timers.
+static Timer* t_interpolate_cache_hit;
+static Timer* t_interpolate_cache_miss;
+static Timer* t_spread_cache_hit;
+static Timer* t_spread_cache_miss;
+
+inline int
+get_kernel_width(const KernelFcnType kernel_fcn_type)
+{
+    switch (kernel_fcn_type)
+    {
+    case PIECEWISE_CONSTANT_KERNEL:
+        return PiecewiseConstantKernel::WIDTH;
+    case PIECEWISE_LINEAR_KERNEL:
+        return PiecewiseLinearKernel::WIDTH;
+    case PIECEWISE_CUBIC_KERNEL:
+        return PiecewiseCubicKernel::WIDTH;
+    case IB_3_KERNEL:
+        return IB3Kernel::WIDTH;
+    case IB_4_KERNEL:
+        return IB4Kernel::WIDTH;
+    case IB_4_W8_KERNEL:
+        return IB4W8Kernel::WIDTH;
+    case IB_5_KERNEL:
+        return IB5Kernel::WIDTH;
+    case IB_6_KERNEL:
+        return IB6Kernel::WIDTH;
+    case BSPLINE_3_KERNEL:
+        return BSpline3Kernel::WIDTH;
+    case BSPLINE_4_KERNEL:
+        return BSpline4Kernel::WIDTH;
+    case BSPLINE_5_KERNEL:
+        return BSpline5Kernel::WIDTH;
+    case BSPLINE_6_KERNEL:
+        return BSpline6Kernel::WIDTH;
+    default:
+        return 0;
+    }
+}
+
+// Return the id of the weight cache entry that corresponds to the specified
+// data, or -1 if the weights of the kernel function are not cached.
+inline int
+get_weight_cache_id(const KernelFcnType kernel_fcn_type,
+                    const double* const X,
+                    const Box<NDIM>& box,
+                    const double* const x_lower,
+                    const double* const dx,
+                    const int num_slots)
+{
+    if (kernel_fcn_type == UNKNOWN_KERNEL) return -1;
+    const WeightCacheKey key(X, kernel_fcn_type, box, x_lower, dx);
+    std::map<WeightCacheKey, int>::iterator it = weight_cache_ids.find(key);
+    if (it == weight_cache_ids.end())
+    {
+        it = weight_cache_ids.insert(std::make_pair(key, static_cast<int>(weight_cache_entries.size()))).first;
+        weight_cache_entries.push_back(WeightCacheEntry());
+    }
+    weight_cache_entries[it->second].resize(num_slots, get_kernel_width(kernel_fcn_type));
+    return it->second;
+}
+
+inline WeightCacheEntry*
+get_weight_cache_entry(const int weight_cache_id)
+{
+    return weight_cache_id >= 0 ? &weight_cache_entries[weight_cache_id] : NULL;
+}
+
+inline void
+count_weight_cache_misses(const unsigned long num_misses)
+{
+#if defined(_OPENMP)
+#pragma omp atomic
+#endif
+    weight_cache_num_misses += num_misses;
+    return;
+}
+
+// Record an access to a weight cache entry as a hit if the stencils and
+// weights of all of the points were loaded from the cache, or as a miss if any
+// of them were recomputed.
+inline void
+record_weight_cache_access(const unsigned long prev_num_misses, Timer* const t_cache_hit, Timer* const t_cache_miss)
+{
+    Timer* const timer = weight_cache_num_misses == prev_num_misses ? t_cache_hit : t_cache_miss;
+    IBTK_TIMER_START(timer);
+    IBTK_TIMER_STOP(timer);
+    return;
+}
+
+// Set up the timers that record weight cache accesses.
+inline void
+setup_weight_cache_timers()
+{
+    IBTK_DO_ONCE(
+        t_interpolate_cache_hit = TimerManager::getManager()->getTimer("IBTK::LEInteractor::interpolate()[cache_hit]");
+        t_interpolate_cache_miss =
+            TimerManager::getManager()->getTimer("IBTK::LEInteractor::interpolate()[cache_miss]");
+        t_spread_cache_hit = TimerManager::getManager()->getTimer("IBTK::LEInteractor::spread()[cache_hit]");
+        t_spread_cache_miss = TimerManager::getManager()->getTimer("IBTK::LEInteractor::spread()[cache_miss]"););
+    return;
+}
+
+// The number of points whose stencils and weights are computed together.  The
+// weights are stored in structure-of-arrays form so that the weights of all
+// points in a batch are evaluated in SIMD lanes.
+static const int BATCH_SIZE = 8;
+
+// Square root routines for the instruction sets for which the interaction
+// routines are compiled.  Compilers generally do not vectorize std::sqrt()
+// unless errno handling is disabled, so the square roots of a batch are taken
+// explicitly.
+struct GenericSIMD
+{
+    static inline void sqrt_batch(double* const a, const int n)
+    {
+        for (int k = 0; k < n; ++k) a[k] = sqrt(a[k]);
+    }
+};
+
+#if defined(IBTK_LE_MULTIVERSION)
+struct AVX2SIMD
+{
+    IBTK_LE_TARGET_AVX2 static inline void sqrt_batch(double* const a, const int n)
+    {
+        for (int k = 0; k < n; k += 4) _mm256_storeu_pd(a + k, _mm256_sqrt_pd(_mm256_loadu_pd(a + k)));
+    }
+};
+
+struct AVX512SIMD
+{
+    IBTK_LE_TARGET_AVX512 static inline void sqrt_batch(double* const a, const int n)
+    {
+        for (int k = 0; k < n; k += 8) _mm512_storeu_pd(a + k, _mm512_sqrt_pd(_mm512_loadu_pd(a + k)));
+    }
+};
+#endif
+
+// The stencils and weights of a batch of points.
+template <class Kernel, class SIMD>
+struct StencilBatch
+{
+    double w[NDIM][Kernel::WIDTH][BATCH_SIZE];
+    int ic_lower[NDIM][BATCH_SIZE];
+
+    // Compute the stencils and weights of points l0, ..., l0 + n - 1.  Unused
+    // lanes are filled with copies of the first point.  When a cache entry is
+    // provided, the stencils and weights are loaded from the cache if none of
+    // the points has moved, and are stored in the cache otherwise.  Returns
+    // whether the values were loaded from the cache.
+    IBTK_LE_ALWAYS_INLINE inline bool compute(const int l0,
+                                              const int n,
+                                              const double* const X,
+                                              const double* const X_shift,
+                                              const int* const indices,
+                                              const PatchArrayLayout& layout,
+                                              WeightCacheEntry* const cache,
+                                              const int* const cache_slots)
+    {
+        if (cache && load(l0, n, X, X_shift, indices, *cache, cache_slots)) return true;
+        static const int NUM_ROOTS = Kernel::NUM_ROOTS > 0 ? Kernel::NUM_ROOTS : 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            double X_o_dx[BATCH_SIZE];
+            for (int k = 0; k < BATCH_SIZE; ++k)
+            {
+                const int l = l0 + (k < n ? k : 0);
+                X_o_dx[k] = (X[NDIM * indices[l] + d] + X_shift[NDIM * l + d] - layout.x_lower[d]) / layout.dx[d];
+            }
+            for (int k = 0; k < BATCH_SIZE; ++k)
+            {
+                ic_lower[d][k] = Kernel::lower(X_o_dx[k]);
+            }
+            double roots[NUM_ROOTS][BATCH_SIZE];
+            if (Kernel::NUM_ROOTS > 0)
+            {
+                for (int k = 0; k < BATCH_SIZE; ++k)
+                {
+                    Kernel::radicands(X_o_dx[k], ic_lower[d][k], &roots[0][k], BATCH_SIZE);
+                }
+                SIMD::sqrt_batch(&roots[0][0], Kernel::NUM_ROOTS * BATCH_SIZE);
+            }
+            for (int k = 0; k < BATCH_SIZE; ++k)
+            {
+                Kernel::weights(X_o_dx[k], ic_lower[d][k], &roots[0][k], &w[d][0][k], BATCH_SIZE);
+            }
+        }
+        if (cache) store(l0, n, X, X_shift, indices, *cache, cache_slots);
+        return false;
+    }
+
+    // Load the stencils and weights of points l0, ..., l0 + n - 1 from the
+    // cache.  Returns false without modifying the batch if any of the points
+    // has moved since its weights were stored.
+    inline bool load(const int l0,
+                     const int n,
+                     const double* const X,
+                     const double* const X_shift,
+                     const int* const indices,
+                     const WeightCacheEntry& cache,
+                     const int* const cache_slots)
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            const int l = l0 + k;
+            const int slot = cache_slots ? cache_slots[l] : l;
+            if (cache.node[slot] != indices[l]) return false;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (cache.X[NDIM * slot + d] != X[NDIM * indices[l] + d] + X_shift[NDIM * l + d]) return false;
+            }
+        }
+        for (int k = 0; k < n; ++k)
+        {
+            const int l = l0 + k;
+            const int slot = cache_slots ? cache_slots[l] : l;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                ic_lower[d][k] = cache.ic_lower[NDIM * slot + d];
+                const double* const w_slot = &cache.w[Kernel::WIDTH * (NDIM * slot + d)];
+                for (int i = 0; i < Kernel::WIDTH; ++i) w[d][i][k] = w_slot[i];
+            }
+        }
+        return true;
+    }
+
+    // Store the stencils and weights of points l0, ..., l0 + n - 1 in the
+    // cache.
+    inline void store(const int l0,
+                      const int n,
+                      const double* const X,
+                      const double* const X_shift,
+                      const int* const indices,
+                      WeightCacheEntry& cache,
+                      const int* const cache_slots) const
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            const int l = l0 + k;
+            const int slot = cache_slots ? cache_slots[l] : l;
+            cache.node[slot] = indices[l];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                cache.X[NDIM * slot + d] = X[NDIM * indices[l] + d] + X_shift[NDIM * l + d];
+                cache.ic_lower[NDIM * slot + d] = ic_lower[d][k];
+                double* const w_slot = &cache.w[Kernel::WIDTH * (NDIM * slot + d)];
+                for (int i = 0; i < Kernel::WIDTH; ++i) w_slot[i] = w[d][i][k];
+            }
+        }
+        return;
+    }
+
+    // Determine the part of the stencil of the point in lane k that lies
+    // within the ghost box, and return the index of the lower corner of the
+    // stencil in the patch data array.  The returned index is negative when
+    // the stencil extends below the ghost box, so that it may be used only in
+    // index computations; pointers are formed only for stencil entries that
+    // lie within the ghost box.
+    inline int clip(const int k, const PatchArrayLayout& layout, int istart[NDIM], int istop[NDIM]) const
+    {
+        int offset = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int L = ic_lower[d][k];
+            istart[d] = std::max(layout.ig_lower[d] - L, 0);
+            istop[d] = (Kernel::WIDTH - 1) - std::max(L + Kernel::WIDTH - 1 - layout.ig_upper[d], 0);
+            offset += (L - layout.ig_lower[d]) * layout.strides[d];
+        }
+        return offset;
+    }
+};
+
+// Interpolate q onto Q at the positions specified by X.  The depth of the data
+// is DEPTH when DEPTH > 0 and is depth otherwise.  All components of the data
+// are interpolated in a single sweep over each stencil.
+template <class Kernel, int DEPTH, class SIMD>
+IBTK_LE_ALWAYS_INLINE inline void
+interpolate_points_impl(double* const Q,
+                        const int depth,
+                        const double* const X,
+                        const double* const q,
+                        const PatchArrayLayout& layout,
+                        const int* const indices,
+                        const double* const X_shift,
+                        const int nindices,
+                        WeightCacheEntry* const cache,
+                        const int* const cache_slots)
+{
+    const int q_depth = DEPTH > 0 ? DEPTH : depth;
+    const int depth_stride = layout.depth_stride;
+    StencilBatch<Kernel, SIMD> batch;
+    int istart[NDIM], istop[NDIM];
+    unsigned long num_hits = 0;
+    for (int l0 = 0; l0 < nindices; l0 += BATCH_SIZE)
+    {
+        const int n = std::min(BATCH_SIZE, nindices - l0);
+        if (batch.compute(l0, n, X, X_shift, indices, layout, cache, cache_slots)) num_hits += n;
+        for (int k = 0; k < n; ++k)
+        {
+            const int stencil_idx = batch.clip(k, layout, istart, istop);
+            double w0_clip[Kernel::WIDTH];
+            const int n0 = istop[0] - istart[0] + 1;
+            for (int i0 = 0; i0 < n0; ++i0) w0_clip[i0] = batch.w[0][istart[0] + i0][k];
+            double* const Q_s = Q + q_depth * indices[l0 + k];
+            for (int d = 0; d < q_depth; ++d) Q_s[d] = 0.0;
+#if (NDIM == 3)
+            for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+            {
+                const double w2 = batch.w[2][i2][k];
+                const int idx_i2 = stencil_idx + i2 * layout.strides[2] + istart[0];
+#endif
+#if (NDIM == 2)
+                const double w2 = 1.0;
+                const int idx_i2 = stencil_idx + istart[0];
+#endif
+                for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                {
+                    const double w12 = batch.w[1][i1][k] * w2;
+                    const int idx_i1 = idx_i2 + i1 * layout.strides[1];
+                    for (int d = 0; d < q_depth; ++d)
+                    {
+                        const double* const q_d = q + (idx_i1 + d * depth_stride);
+                        double Q_i1 = 0.0;
+                        for (int i0 = 0; i0 < n0; ++i0)
+                        {
+                            Q_i1 += w0_clip[i0] * q_d[i0];
+                        }
+                        Q_s[d] += w12 * Q_i1;
+                    }
+                }
+#if (NDIM == 3)
+            }
+#endif
+        }
+    }
+    if (cache) count_weight_cache_misses(nindices - num_hits);
+    return;
+}
+
+// Spread Q onto q at the positions specified by X.  The depth of the data is
+// DEPTH when DEPTH > 0 and is depth otherwise.  All components of the data are
+// spread in a single sweep over each stencil.
+template <class Kernel, int DEPTH, class SIMD>
+IBTK_LE_ALWAYS_INLINE inline void
+spread_points_impl(double* const q,
+                   const int depth,
+                   const double* const X,
+                   const double* const Q,
+                   const PatchArrayLayout& layout,
+                   const int* const indices,
+                   const double* const X_shift,
+                   const int nindices,
+                   WeightCacheEntry* const cache,
+                   const int* const cache_slots)
+{
+    const int q_depth = DEPTH > 0 ? DEPTH : depth;
+    const int depth_stride = layout.depth_stride;
+    double fac = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d) fac /= layout.dx[d];
+    StencilBatch<Kernel, SIMD> batch;
+    int istart[NDIM], istop[NDIM];
+    unsigned long num_hits = 0;
+    for (int l0 = 0; l0 < nindices; l0 += BATCH_SIZE)
+    {
+        const int n = std::min(BATCH_SIZE, nindices - l0);
+        if (batch.compute(l0, n, X, X_shift, indices, layout, cache, cache_slots)) num_hits += n;
+        for (int k = 0; k < n; ++k)
         {
-            const int ic1 = stencil_lower[1] + i1;
-            for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+            const int stencil_idx = batch.clip(k, layout, istart, istop);
+            double w0_clip[Kernel::WIDTH];
+            const int n0 = istop[0] - istart[0] + 1;
+            for (int i0 = 0; i0 < n0; ++i0) w0_clip[i0] = batch.w[0][istart[0] + i0][k];
+            const double* const Q_s = Q + q_depth * indices[l0 + k];
+#if (NDIM == 3)
+            for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
             {
-                const int ic0 = stencil_lower[0] + i0;
+                const double w2 = batch.w[2][i2][k] * fac;
+                const int idx_i2 = stencil_idx + i2 * layout.strides[2] + istart[0];
+#endif
 #if (NDIM == 2)
-                const Index<NDIM> idx(ic0, ic1);
-                Q += q_data(idx, q_comp) * Psi[i1][i0];
-#elif(NDIM == 3)
-            const Index<NDIM> idx(ic0, ic1, ic2);
-            Q += q_data(idx, q_comp) * Psi[i2][i1][i0];
+                const double w2 = fac;
+                const int idx_i2 = stencil_idx + istart[0];
 #endif
+                for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                {
+                    const double w12 = batch.w[1][i1][k] * w2;
+                    const int idx_i1 = idx_i2 + i1 * layout.strides[1];
+                    for (int d = 0; d < q_depth; ++d)
+                    {
+                        double* const q_d = q + (idx_i1 + d * depth_stride);
+                        const double Q_i1 = w12 * Q_s[d];
+                        for (int i0 = 0; i0 < n0; ++i0)
+                        {
+                            q_d[i0] += w0_clip[i0] * Q_i1;
+                        }
+                    }
+                }
+#if (NDIM == 3)
             }
+#endif
         }
-#if (NDIM == 3)
     }
+    if (cache) count_weight_cache_misses(nindices - num_hits);
+    return;
+}
+
+// Instruction sets for which the interaction routines are compiled.  On x86
+// processors, versions of the routines are generated for AVX2 and AVX-512, and
+// the version to use is selected at runtime according to the capabilities of
+// the processor, so that the same library runs efficiently on all of them.
+enum SIMDInstructionSet
+{
+    GENERIC_SIMD_ISA,
+    AVX2_SIMD_ISA,
+    AVX512_SIMD_ISA
+};
+
+inline SIMDInstructionSet
+detect_simd_isa()
+{
+#if defined(IBTK_LE_MULTIVERSION)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return AVX512_SIMD_ISA;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return AVX2_SIMD_ISA;
 #endif
+    return GENERIC_SIMD_ISA;
+}
 
-    return;
+static const SIMDInstructionSet SIMD_ISA = detect_simd_isa();
 
-} // interpolate_data
+inline const char*
+simd_isa_name(const SIMDInstructionSet isa)
+{
+    if (isa == AVX512_SIMD_ISA) return "AVX512";
+    if (isa == AVX2_SIMD_ISA) return "AVX2";
+    return "GENERIC";
+}
 
-void
-spread_data(const int stencil_sz,
-            const int* const ig_lower,
-            const int* const ig_upper,
-            const int* const stencil_lower,
-            const int* const stencil_upper,
-            const double* const dx,
-            ArrayData<NDIM, double>& q_data,
-            const int q_comp,
-            const MLSWeight& Psi,
-            const double& Q)
+#define IBTK_LE_DEFINE_TARGET_VERSION(NAME, TARGET, IMPL, SIMD)                                                        \
+    template <class Kernel, int DEPTH>                                                                                 \
+    TARGET void NAME(double* const out,                                                                                \
+                     const int depth,                                                                                  \
+                     const double* const X,                                                                            \
+                     const double* const in,                                                                           \
+                     const PatchArrayLayout& layout,                                                                   \
+                     const int* const indices,                                                                         \
+                     const double* const X_shift,                                                                      \
+                     const int nindices,                                                                               \
+                     WeightCacheEntry* const cache,                                                                    \
+                     const int* const cache_slots)                                                                     \
+    {                                                                                                                  \
+        IMPL<Kernel, DEPTH, SIMD>(out, depth, X, in, layout, indices, X_shift, nindices, cache, cache_slots);          \
+    }
+
+IBTK_LE_DEFINE_TARGET_VERSION(interpolate_points_generic, inline, interpolate_points_impl, GenericSIMD)
+IBTK_LE_DEFINE_TARGET_VERSION(spread_points_generic, inline, spread_points_impl, GenericSIMD)
+#if defined(IBTK_LE_MULTIVERSION)
+IBTK_LE_DEFINE_TARGET_VERSION(interpolate_points_avx2, IBTK_LE_TARGET_AVX2, interpolate_points_impl, AVX2SIMD)
+IBTK_LE_DEFINE_TARGET_VERSION(spread_points_avx2, IBTK_LE_TARGET_AVX2, spread_points_impl, AVX2SIMD)
+IBTK_LE_DEFINE_TARGET_VERSION(interpolate_points_avx512, IBTK_LE_TARGET_AVX512, interpolate_points_impl, AVX512SIMD)
+IBTK_LE_DEFINE_TARGET_VERSION(spread_points_avx512, IBTK_LE_TARGET_AVX512, spread_points_impl, AVX512SIMD)
+#endif
+
+#undef IBTK_LE_DEFINE_TARGET_VERSION
+
+// Select the specialization that corresponds to the instruction set of the
+// processor.
+template <class Kernel, int DEPTH>
+inline void
+interpolate_points(double* const Q,
+                   const int depth,
+                   const double* const X,
+                   const double* const q,
+                   const PatchArrayLayout& layout,
+                   const int* const indices,
+                   const double* const X_shift,
+                   const int nindices,
+                   WeightCacheEntry* const cache,
+                   const int* const cache_slots)
 {
-    int istart[NDIM], istop[NDIM];
-    double fac = 1.0;
-    for (unsigned int d = 0; d < NDIM; ++d)
+#if defined(IBTK_LE_MULTIVERSION)
+    if (SIMD_ISA == AVX512_SIMD_ISA)
     {
-        istart[d] = std::max(ig_lower[d] - stencil_lower[d], 0);
-        istop[d] = (stencil_sz - 1) - std::max(stencil_upper[d] - ig_upper[d], 0);
-        fac /= dx[d];
+        interpolate_points_avx512<Kernel, DEPTH>(
+            Q, depth, X, q, layout, indices, X_shift, nindices, cache, cache_slots);
+        return;
     }
-
-#if (NDIM == 3)
-    for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+    if (SIMD_ISA == AVX2_SIMD_ISA)
     {
-        const int ic2 = stencil_lower[2] + i2;
-#endif
-        for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
-        {
-            const int ic1 = stencil_lower[1] + i1;
-            for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
-            {
-                const int ic0 = stencil_lower[0] + i0;
-#if (NDIM == 2)
-                const Index<NDIM> idx(ic0, ic1);
-                q_data(idx, q_comp) += Q * Psi[i1][i0] * fac;
-#elif(NDIM == 3)
-            const Index<NDIM> idx(ic0, ic1, ic2);
-            q_data(idx, q_comp) += Q * Psi[i2][i1][i0] * fac;
+        interpolate_points_avx2<Kernel, DEPTH>(Q, depth, X, q, layout, indices, X_shift, nindices, cache, cache_slots);
+        return;
+    }
 #endif
-            }
-        }
-#if (NDIM == 3)
+    interpolate_points_generic<Kernel, DEPTH>(Q, depth, X, q, layout, indices, X_shift, nindices, cache, cache_slots);
+    return;
+}
+
+template <class Kernel, int DEPTH>
+inline void
+spread_points(double* const q,
+              const int depth,
+              const double* const X,
+              const double* const Q,
+              const PatchArrayLayout& layout,
+              const int* const indices,
+              const double* const X_shift,
+              const int nindices,
+              WeightCacheEntry* const cache,
+              const int* const cache_slots)
+{
+#if defined(IBTK_LE_MULTIVERSION)
+    if (SIMD_ISA == AVX512_SIMD_ISA)
+    {
+        spread_points_avx512<Kernel, DEPTH>(q, depth, X, Q, layout, indices, X_shift, nindices, cache, cache_slots);
+        return;
+    }
+    if (SIMD_ISA == AVX2_SIMD_ISA)
+    {
+        spread_points_avx2<Kernel, DEPTH>(q, depth, X, Q, layout, indices, X_shift, nindices, cache, cache_slots);
+        return;
     }
 #endif
-} // spread_data
+    spread_points_generic<Kernel, DEPTH>(q, depth, X, Q, layout, indices, X_shift, nindices, cache, cache_slots);
+    return;
+}
+
+// Select the specialization that corresponds to the data depth.
+template <class Kernel>
+inline void
+interpolate_points(double* const Q,
+                   const int depth,
+                   const double* const X,
+                   const double* const q,
+                   const PatchArrayLayout& layout,
+                   const int* const indices,
+                   const double* const X_shift,
+                   const int nindices,
+                   WeightCacheEntry* const cache,
+                   const int* const cache_slots)
+{
+    if (depth == 1)
+        interpolate_points<Kernel, 1>(Q, depth, X, q, layout, indices, X_shift, nindices, cache, cache_slots);
+    else if (depth == NDIM)
+        interpolate_points<Kernel, NDIM>(Q, depth, X, q, layout, indices, X_shift, nindices, cache, cache_slots);
+    else
+        interpolate_points<Kernel, 0>(Q, depth, X, q, layout, indices, X_shift, nindices, cache, cache_slots);
+    return;
+}
+
+template <class Kernel>
+inline void
+spread_points(double* const q,
+              const int depth,
+              const double* const X,
+              const double* const Q,
+              const PatchArrayLayout& layout,
+              const int* const indices,
+              const double* const X_shift,
+              const int nindices,
+              WeightCacheEntry* const cache,
+              const int* const cache_slots)
+{
+    if (depth == 1)
+        spread_points<Kernel, 1>(q, depth, X, Q, layout, indices, X_shift, nindices, cache, cache_slots);
+    else if (depth == NDIM)
+        spread_points<Kernel, NDIM>(q, depth, X, Q, layout, indices, X_shift, nindices, cache, cache_slots);
+    else
+        spread_points<Kernel, 0>(q, depth, X, Q, layout, indices, X_shift, nindices, cache, cache_slots);
+    return;
+}
+
+// Select the specialization that corresponds to the kernel function.  Returns
+// false if the kernel function is not supported by the C++ engine.
+#define IBTK_LE_KERNEL_SWITCH(KERNEL_FCN_TYPE, FCN, ARGS)                                                              \
+    switch (KERNEL_FCN_TYPE)                                                                                           \
+    {                                                                                                                  \
+    case PIECEWISE_CONSTANT_KERNEL:                                                                                    \
+        FCN<PiecewiseConstantKernel> ARGS;                                                                             \
+        return true;                                                                                                   \
+    case PIECEWISE_LINEAR_KERNEL:                                                                                      \
+        FCN<PiecewiseLinearKernel> ARGS;                                                                               \
+        return true;                                                                                                   \
+    case PIECEWISE_CUBIC_KERNEL:                                                                                       \
+        FCN<PiecewiseCubicKernel> ARGS;                                                                                \
+        return true;                                                                                                   \
+    case IB_3_KERNEL:                                                                                                  \
+        FCN<IB3Kernel> ARGS;                                                                                           \
+        return true;                                                                                                   \
+    case IB_4_KERNEL:                                                                                                  \
+        FCN<IB4Kernel> ARGS;                                                                                           \
+        return true;                                                                                                   \
+    case IB_4_W8_KERNEL:                                                                                               \
+        FCN<IB4W8Kernel> ARGS;                                                                                         \
+        return true;                                                                                                   \
+    case IB_5_KERNEL:                                                                                                  \
+        FCN<IB5Kernel> ARGS;                                                                                           \
+        return true;                                                                                                   \
+    case IB_6_KERNEL:                                                                                                  \
+        FCN<IB6Kernel> ARGS;                                                                                           \
+        return true;                                                                                                   \
+    case BSPLINE_3_KERNEL:                                                                                             \
+        FCN<BSpline3Kernel> ARGS;                                                                                      \
+        return true;                                                                                                   \
+    case BSPLINE_4_KERNEL:                                                                                             \
+        FCN<BSpline4Kernel> ARGS;                                                                                      \
+        return true;                                                                                                   \
+    case BSPLINE_5_KERNEL:                                                                                             \
+        FCN<BSpline5Kernel> ARGS;                                                                                      \
+        return true;                                                                                                   \
+    case BSPLINE_6_KERNEL:                                                                                             \
+        FCN<BSpline6Kernel> ARGS;                                                                                      \
+        return true;                                                                                                   \
+    default:                                                                                                           \
+        return false;                                                                                                  \
+    }
+
+inline bool
+interpolate_points(const KernelFcnType kernel_fcn_type,
+                   double* const Q,
+                   const int depth,
+                   const double* const X,
+                   const double* const q,
+                   const PatchArrayLayout& layout,
+                   const int* const indices,
+                   const double* const X_shift,
+                   const int nindices,
+                   WeightCacheEntry* const cache,
+                   const int* const cache_slots)
+{
+    IBTK_LE_KERNEL_SWITCH(
+        kernel_fcn_type, interpolate_points, (Q, depth, X, q, layout, indices, X_shift, nindices, cache, cache_slots));
+}
+
+inline bool
+spread_points(const KernelFcnType kernel_fcn_type,
+              double* const q,
+              const int depth,
+              const double* const X,
+              const double* const Q,
+              const PatchArrayLayout& layout,
+              const int* const indices,
+              const double* const X_shift,
+              const int nindices,
+              WeightCacheEntry* const cache,
+              const int* const cache_slots)
+{
+    IBTK_LE_KERNEL_SWITCH(
+        kernel_fcn_type, spread_points, (q, depth, X, Q, layout, indices, X_shift, nindices, cache, cache_slots));
+}
+
+#undef IBTK_LE_KERNEL_SWITCH
 }
 
 double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
 int LEInteractor::s_kernel_fcn_stencil_size = 4;
+SpreadingMode LEInteractor::s_spread_mode = SERIAL_SPREADING;
+int LEInteractor::s_min_points_per_spread_thread = 256;
+bool LEInteractor::s_use_fortran_kernels = false;
+bool LEInteractor::s_use_weight_cache = false;
 
-void LEInteractor::setFromDatabase(Pointer<Database> /*db*/)
+void
+LEInteractor::setFromDatabase(Pointer<Database> db)
 {
-    // intentionally blank
+    if (!db) return;
+    if (db->isString("spread_mode"))
+    {
+        setSpreadingMode(string_to_enum<SpreadingMode>(db->getString("spread_mode")));
+    }
+    if (db->isInteger("min_points_per_spread_thread"))
+    {
+        s_min_points_per_spread_thread = db->getInteger("min_points_per_spread_thread");
+    }
+    if (db->isBool("use_fortran_kernels"))
+    {
+        s_use_fortran_kernels = db->getBool("use_fortran_kernels");
+    }
+    if (db->isBool("use_weight_cache"))
+    {
+        setUseWeightCache(db->getBool("use_weight_cache"));
+    }
     return;
 }
 
@@ -1339,6 +2653,16 @@ void
 LEInteractor::printClassData(std::ostream& os)
 {
     os << "LEInteractor::printClassData():\n";
+    os << "  spread_mode = " << enum_to_string<SpreadingMode>(s_spread_mode) << "\n";
+    os << "  min_points_per_spread_thread = " << s_min_points_per_spread_thread << "\n";
+    os << "  max_spread_threads = " << get_max_spread_threads() << "\n";
+    os << "  use_fortran_kernels = " << (s_use_fortran_kernels ? "TRUE" : "FALSE") << "\n";
+    os << "  simd_instruction_set = " << simd_isa_name(SIMD_ISA) << "\n";
+    os << "  use_weight_cache = " << (s_use_weight_cache ? "TRUE" : "FALSE") << "\n";
+    if (s_use_weight_cache)
+    {
+        os << "  weight_cache_num_entries = " << weight_cache_entries.size() << "\n";
+    }
     return;
 }
 
@@ -1374,6 +2698,63 @@ LEInteractor::getMinimumGhostWidth(const std::string& kernel_fcn)
     return static_cast<int>(floor(0.5 * getStencilSize(kernel_fcn))) + 1;
 }
 
+void
+LEInteractor::setSpreadingMode(const SpreadingMode spread_mode)
+{
+    if (spread_mode != SERIAL_SPREADING && spread_mode != COLORED_SPREADING &&
+        spread_mode != REPLICATED_SPREADING)
+    {
+        TBOX_ERROR("LEInteractor::setSpreadingMode()\n"
+                   << "  unsupported spreading mode: "
+                   << enum_to_string<SpreadingMode>(spread_mode)
+                   << "\n"
+                   << "  valid choices are: SERIAL, COLORED, REPLICATED\n");
+    }
+    s_spread_mode = spread_mode;
+    return;
+}
+
+SpreadingMode
+LEInteractor::getSpreadingMode()
+{
+    return s_spread_mode;
+}
+
+void
+LEInteractor::setUseFortranKernels(const bool use_fortran_kernels)
+{
+    s_use_fortran_kernels = use_fortran_kernels;
+    return;
+}
+
+bool
+LEInteractor::getUseFortranKernels()
+{
+    return s_use_fortran_kernels;
+}
+
+void
+LEInteractor::setUseWeightCache(const bool use_weight_cache)
+{
+    s_use_weight_cache = use_weight_cache;
+    if (!s_use_weight_cache) clearWeightCache();
+    return;
+}
+
+bool
+LEInteractor::getUseWeightCache()
+{
+    return s_use_weight_cache;
+}
+
+void
+LEInteractor::clearWeightCache()
+{
+    weight_cache_ids.clear();
+    std::vector<WeightCacheEntry>().swap(weight_cache_entries);
+    return;
+}
+
 template <class T>
 void
 LEInteractor::interpolate(Pointer<LData> Q_data,
@@ -3189,7 +4570,8 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const SpreadingMode spread_mode)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -3238,7 +4620,9 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               spread_fcn,
+               /*axis*/ 0,
+               spread_mode);
     }
     return;
 }
@@ -3384,7 +4768,8 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const SpreadingMode spread_mode)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -3439,7 +4824,9 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               spread_fcn,
+               /*axis*/ 0,
+               spread_mode);
     }
     return;
 }
@@ -3454,7 +4841,8 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const SpreadingMode spread_mode)
 {
     if (Q_depth != NDIM || q_data->getDepth() != 1)
     {
@@ -3522,7 +4910,8 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                    local_indices,
                    periodic_shifts,
                    spread_fcn,
-                   axis);
+                   axis,
+                   spread_mode);
         }
     }
     return;
@@ -3678,7 +5067,8 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const std::string& spread_fcn,
+                     const SpreadingMode spread_mode)
 {
     if (NDIM != 3 || Q_depth != NDIM || q_data->getDepth() != 1)
     {
@@ -3749,7 +5139,8 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                    local_indices,
                    periodic_shifts,
                    spread_fcn,
-                   axis);
+                   axis,
+                   spread_mode);
         }
     }
     return;
@@ -3798,6 +5189,32 @@ LEInteractor::interpolate(double* const Q_data,
     }
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
+    const KernelFcnType kernel_fcn_type = get_kernel_fcn_type(interp_fcn);
+    int weight_cache_id = -1;
+    if (s_use_weight_cache && !s_use_fortran_kernels)
+    {
+        weight_cache_id = get_weight_cache_id(kernel_fcn_type, X_data, q_data_box, x_lower, dx, local_indices_size);
+    }
+    const unsigned long prev_weight_cache_num_misses = weight_cache_num_misses;
+    if (!s_use_fortran_kernels && interpolate_points(kernel_fcn_type,
+                                                     Q_data,
+                                                     q_depth,
+                                                     X_data,
+                                                     q_data,
+                                                     PatchArrayLayout(q_data_box, q_gcw, x_lower, dx),
+                                                     &local_indices[0],
+                                                     &periodic_shifts[0],
+                                                     local_indices_size,
+                                                     get_weight_cache_entry(weight_cache_id),
+                                                     NULL))
+    {
+        if (weight_cache_id >= 0)
+        {
+            setup_weight_cache_timers();
+            record_weight_cache_access(prev_weight_cache_num_misses, t_interpolate_cache_hit, t_interpolate_cache_miss);
+        }
+        return;
+    }
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
     if (interp_fcn == "PIECEWISE_CONSTANT")
@@ -4259,7 +5676,8 @@ LEInteractor::spread(double* const q_data,
                      const std::vector<int>& local_indices,
                      const std::vector<double>& periodic_shifts,
                      const std::string& spread_fcn,
-                     const int axis)
+                     const int axis,
+                     const SpreadingMode spread_mode)
 {
     const int stencil_size = getStencilSize(spread_fcn);
     const int min_ghosts = getMinimumGhostWidth(spread_fcn);
@@ -4287,7 +5705,114 @@ LEInteractor::spread(double* const q_data,
                    << "\n");
     }
     if (local_indices.empty()) return;
-    const int local_indices_size = static_cast<int>(local_indices.size());
+    int weight_cache_id = -1;
+    if (s_use_weight_cache && !s_use_fortran_kernels)
+    {
+        weight_cache_id = get_weight_cache_id(get_kernel_fcn_type(spread_fcn),
+                                              X_data,
+                                              q_data_box,
+                                              x_lower,
+                                              dx,
+                                              static_cast<int>(local_indices.size()));
+    }
+    const unsigned long prev_weight_cache_num_misses = weight_cache_num_misses;
+    switch (spread_mode == UNKNOWN_SPREADING_MODE ? s_spread_mode : spread_mode)
+    {
+    case COLORED_SPREADING:
+        spreadColored(q_data,
+                      q_data_box,
+                      q_gcw,
+                      q_depth,
+                      Q_data,
+                      Q_depth,
+                      X_data,
+                      x_lower,
+                      x_upper,
+                      dx,
+                      local_indices,
+                      periodic_shifts,
+                      spread_fcn,
+                      axis,
+                      weight_cache_id);
+        break;
+    case REPLICATED_SPREADING:
+        spreadReplicated(q_data,
+                         q_data_box,
+                         q_gcw,
+                         q_depth,
+                         Q_data,
+                         Q_depth,
+                         X_data,
+                         x_lower,
+                         x_upper,
+                         dx,
+                         local_indices,
+                         periodic_shifts,
+                         spread_fcn,
+                         axis,
+                         weight_cache_id);
+        break;
+    default:
+        spreadPoints(q_data,
+                     q_data_box,
+                     q_gcw,
+                     q_depth,
+                     Q_data,
+                     Q_depth,
+                     X_data,
+                     x_lower,
+                     x_upper,
+                     dx,
+                     &local_indices[0],
+                     &periodic_shifts[0],
+                     static_cast<int>(local_indices.size()),
+                     spread_fcn,
+                     axis,
+                     weight_cache_id,
+                     NULL);
+    }
+    if (weight_cache_id >= 0)
+    {
+        setup_weight_cache_timers();
+        record_weight_cache_access(prev_weight_cache_num_misses, t_spread_cache_hit, t_spread_cache_miss);
+    }
+    return;
+}
+
+void
+LEInteractor::spreadPoints(double* const q_data,
+                           const Box<NDIM>& q_data_box,
+                           const IntVector<NDIM>& q_gcw,
+                           const int q_depth,
+                           const double* const Q_data,
+                           const int Q_depth,
+                           const double* const X_data,
+                           const double* const x_lower,
+                           const double* const x_upper,
+                           const double* const dx,
+                           const int* const local_indices,
+                           const double* const periodic_shifts,
+                           const int num_local_indices,
+                           const std::string& spread_fcn,
+                           const int axis,
+                           const int weight_cache_id,
+                           const int* const weight_cache_slots)
+{
+    if (num_local_indices == 0) return;
+    if (!s_use_fortran_kernels && spread_points(get_kernel_fcn_type(spread_fcn),
+                                                q_data,
+                                                q_depth,
+                                                X_data,
+                                                Q_data,
+                                                PatchArrayLayout(q_data_box, q_gcw, x_lower, dx),
+                                                local_indices,
+                                                periodic_shifts,
+                                                num_local_indices,
+                                                get_weight_cache_entry(weight_cache_id),
+                                                weight_cache_slots))
+    {
+        return;
+    }
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
     if (spread_fcn == "PIECEWISE_CONSTANT")
@@ -4296,9 +5821,9 @@ LEInteractor::spread(double* const q_data,
                                                 x_lower,
                                                 x_upper,
                                                 q_depth,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
+                                                local_indices,
+                                                periodic_shifts,
+                                                num_local_indices,
                                                 X_data,
                                                 Q_data,
 #if (NDIM == 2)
@@ -4329,9 +5854,9 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data,
 #if (NDIM == 2)
@@ -4361,9 +5886,9 @@ LEInteractor::spread(double* const q_data,
                                               x_lower,
                                               x_upper,
                                               q_depth,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
+                                              local_indices,
+                                              periodic_shifts,
+                                              num_local_indices,
                                               X_data,
                                               Q_data,
 #if (NDIM == 2)
@@ -4393,9 +5918,9 @@ LEInteractor::spread(double* const q_data,
                                              x_lower,
                                              x_upper,
                                              q_depth,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
+                                             local_indices,
+                                             periodic_shifts,
+                                             num_local_indices,
                                              X_data,
                                              Q_data,
 #if (NDIM == 2)
@@ -4425,9 +5950,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4457,9 +5982,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4489,9 +6014,9 @@ LEInteractor::spread(double* const q_data,
                                      x_lower,
                                      x_upper,
                                      q_depth,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
+                                     local_indices,
+                                     periodic_shifts,
+                                     num_local_indices,
                                      X_data,
                                      Q_data,
 #if (NDIM == 2)
@@ -4521,9 +6046,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4553,9 +6078,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4585,9 +6110,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4617,9 +6142,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4649,9 +6174,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4681,9 +6206,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4719,13 +6244,13 @@ LEInteractor::spread(double* const q_data,
                           Q_data,
                           Q_depth,
                           X_data,
-                          &local_indices[0],
-                          &periodic_shifts[0],
-                          local_indices_size);
+                          local_indices,
+                          periodic_shifts,
+                          num_local_indices);
     }
     else
     {
-        TBOX_ERROR("LEInteractor::spread()\n"
+        TBOX_ERROR("LEInteractor::spreadPoints()\n"
                    << "  Unknown spreading kernel function "
                    << spread_fcn
                    << std::endl);
@@ -4733,6 +6258,173 @@ LEInteractor::spread(double* const q_data,
     return;
 }
 
+void
+LEInteractor::spreadColored(double* const q_data,
+                            const Box<NDIM>& q_data_box,
+                            const IntVector<NDIM>& q_gcw,
+                            const int q_depth,
+                            const double* const Q_data,
+                            const int Q_depth,
+                            const double* const X_data,
+                            const double* const x_lower,
+                            const double* const x_upper,
+                            const double* const dx,
+                            const std::vector<int>& local_indices,
+                            const std::vector<double>& periodic_shifts,
+                            const std::string& spread_fcn,
+                            const int axis,
+                            const int weight_cache_id)
+{
+    // Sort the points into bins that are wide enough that the kernel supports
+    // of points in bins of the same color cannot overlap.  Notice that the bin
+    // width does not depend on the number of threads, so that the order in
+    // which values are summed is independent of the number of threads.
+    const int bin_width = 2 * getMinimumGhostWidth(spread_fcn);
+    SpreadingBins bins;
+    build_spreading_bins(
+        bins, bin_width, q_data_box, q_gcw, X_data, x_lower, dx, local_indices, periodic_shifts);
+
+    // Spread the values one color at a time.
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    const bool use_threads = num_local_indices >= s_min_points_per_spread_thread * get_max_spread_threads();
+    for (unsigned int color = 0; color < NCOLORS; ++color)
+    {
+        const std::vector<int>& color_bins = bins.color_bins[color];
+        const int num_color_bins = static_cast<int>(color_bins.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (use_threads && num_color_bins > 1)
+#endif
+        for (int k = 0; k < num_color_bins; ++k)
+        {
+            const int bin = color_bins[k];
+            const int bin_offset = bins.bin_offsets[bin];
+            spreadPoints(q_data,
+                         q_data_box,
+                         q_gcw,
+                         q_depth,
+                         Q_data,
+                         Q_depth,
+                         X_data,
+                         x_lower,
+                         x_upper,
+                         dx,
+                         &bins.local_indices[bin_offset],
+                         &bins.periodic_shifts[NDIM * bin_offset],
+                         bins.bin_offsets[bin + 1] - bin_offset,
+                         spread_fcn,
+                         axis,
+                         weight_cache_id,
+                         &bins.positions[bin_offset]);
+        }
+    }
+    NULL_USE(use_threads);
+    return;
+}
+
+void
+LEInteractor::spreadReplicated(double* const q_data,
+                               const Box<NDIM>& q_data_box,
+                               const IntVector<NDIM>& q_gcw,
+                               const int q_depth,
+                               const double* const Q_data,
+                               const int Q_depth,
+                               const double* const X_data,
+                               const double* const x_lower,
+                               const double* const x_upper,
+                               const double* const dx,
+                               const std::vector<int>& local_indices,
+                               const std::vector<double>& periodic_shifts,
+                               const std::string& spread_fcn,
+                               const int axis,
+                               const int weight_cache_id)
+{
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    const int num_threads = std::min(get_max_spread_threads(),
+                                     std::max(num_local_indices / std::max(s_min_points_per_spread_thread, 1), 1));
+    if (num_threads == 1)
+    {
+        spreadPoints(q_data,
+                     q_data_box,
+                     q_gcw,
+                     q_depth,
+                     Q_data,
+                     Q_depth,
+                     X_data,
+                     x_lower,
+                     x_upper,
+                     dx,
+                     &local_indices[0],
+                     &periodic_shifts[0],
+                     num_local_indices,
+                     spread_fcn,
+                     axis,
+                     weight_cache_id,
+                     NULL);
+        return;
+    }
+
+    // Each thread spreads a contiguous block of points into its own copy of
+    // the patch data (thread 0 spreads directly into q_data), and the copies
+    // are then summed.
+    int q_size = q_depth;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        q_size *= q_data_box.numberCells(d) + 2 * q_gcw(d);
+    }
+    std::vector<std::vector<double> > q_buffers(num_threads);
+    std::vector<int> weight_cache_slots;
+    if (weight_cache_id >= 0)
+    {
+        weight_cache_slots.resize(num_local_indices);
+        for (int l = 0; l < num_local_indices; ++l) weight_cache_slots[l] = l;
+    }
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        const int thread_num = get_spread_thread_num();
+        const int team_size = get_spread_team_size();
+        const int block_size = (num_local_indices + team_size - 1) / team_size;
+        const int l_begin = std::min(thread_num * block_size, num_local_indices);
+        const int l_end = std::min(l_begin + block_size, num_local_indices);
+        double* q_thread_data = q_data;
+        if (thread_num > 0)
+        {
+            q_buffers[thread_num].resize(q_size, 0.0);
+            q_thread_data = &q_buffers[thread_num][0];
+        }
+        spreadPoints(q_thread_data,
+                     q_data_box,
+                     q_gcw,
+                     q_depth,
+                     Q_data,
+                     Q_depth,
+                     X_data,
+                     x_lower,
+                     x_upper,
+                     dx,
+                     &local_indices[0] + l_begin,
+                     &periodic_shifts[0] + NDIM * l_begin,
+                     l_end - l_begin,
+                     spread_fcn,
+                     axis,
+                     weight_cache_id,
+                     weight_cache_id >= 0 ? &weight_cache_slots[0] + l_begin : NULL);
+#if defined(_OPENMP)
+#pragma omp barrier
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < q_size; ++i)
+        {
+            for (int t = 1; t < team_size; ++t)
+            {
+                q_data[i] += q_buffers[t][i];
+            }
+        }
+    }
+    return;
+}
+
 template <class T>
 void
 LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
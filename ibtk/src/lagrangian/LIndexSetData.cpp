@@ -32,6 +32,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "Box.h"
@@ -41,9 +43,11 @@
 #include "IntVector.h"
 #include "Patch.h"
 #include "boost/array.hpp"
+#include "ibtk/IndexUtilities.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LSet.h"
 #include "ibtk/LSetData.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Pointer.h"
 
@@ -90,7 +94,9 @@ LIndexSetData<T>::~LIndexSetData()
 
 template <class T>
 void
-LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector<NDIM>& periodic_shift)
+LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch,
+                                    const IntVector<NDIM>& periodic_shift,
+                                    const LNodeOrderingType node_ordering)
 {
     d_lag_indices.clear();
     d_interior_lag_indices.clear();
@@ -118,9 +124,32 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
         patch_touches_upper_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 1);
     }
 
+    // Determine the order in which the cells are visited.
+    std::vector<CellIndex<NDIM> > cell_indices;
+    std::vector<const LSet<T>*> cell_sets;
     for (typename LSetData<T>::SetIterator it(*this); it; it++)
     {
-        const CellIndex<NDIM>& i = it.getIndex();
+        cell_indices.push_back(it.getIndex());
+        cell_sets.push_back(&(*it));
+    }
+    const int num_cells = static_cast<int>(cell_indices.size());
+    std::vector<std::pair<unsigned long, int> > cell_order(num_cells);
+    const Index<NDIM>& ghost_lower = this->getGhostBox().lower();
+    for (int k = 0; k < num_cells; ++k)
+    {
+        cell_order[k].first =
+            node_ordering == MORTON_NODE_ORDERING ? IndexUtilities::getMortonIndex(cell_indices[k], ghost_lower) : 0;
+        cell_order[k].second = k;
+    }
+    if (node_ordering == MORTON_NODE_ORDERING)
+    {
+        // NOTE: Ties are broken by the original position of the cell.
+        std::sort(cell_order.begin(), cell_order.end());
+    }
+
+    for (int k = 0; k < num_cells; ++k)
+    {
+        const CellIndex<NDIM>& i = cell_indices[cell_order[k].second];
         boost::array<int, NDIM> offset;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
@@ -138,7 +167,7 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
                 offset[d] = 0;
             }
         }
-        const LSet<T>& idx_set = *it;
+        const LSet<T>& idx_set = *cell_sets[cell_order[k].second];
         const bool patch_owns_idx_set = patch_box.contains(i);
         for (typename LSet<T>::const_iterator n = idx_set.begin(); n != idx_set.end(); ++n)
         {
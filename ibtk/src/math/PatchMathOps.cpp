@@ -34,13 +34,16 @@
 
 #include <ostream>
 
+#include "ArrayData.h"
 #include "Box.h"
+#include "BoxList.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "EdgeData.h" // IWYU pragma: keep
 #include "FaceData.h"
 #include "FaceGeometry.h"
 #include "IBTK_config.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "NodeData.h"
 #include "NodeGeometry.h"
@@ -1329,6 +1332,88 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Compute F_l = alpha L U_m + beta U_m on the indices of the specified box
+// using the standard 5 point stencil in 2D (7 point stencil in 3D).  The
+// arithmetic is performed in the same order as in the Fortran kernels.
+void
+damped_laplace_on_box(ArrayData<NDIM, double>& F_data,
+                      const int l,
+                      const double alpha,
+                      const double beta,
+                      const ArrayData<NDIM, double>& U_data,
+                      const int m,
+                      const Box<NDIM>& box,
+                      const double* const dx)
+{
+    const Box<NDIM>& F_box = F_data.getBox();
+    const Box<NDIM>& U_box = U_data.getBox();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(F_box.contains(box.lower()) && F_box.contains(box.upper()));
+    const Box<NDIM> stencil_box = Box<NDIM>::grow(box, 1);
+    TBOX_ASSERT(U_box.contains(stencil_box.lower()) && U_box.contains(stencil_box.upper()));
+#endif
+    double* const F = F_data.getPointer(l);
+    const double* const U = U_data.getPointer(m);
+    int F_stride[NDIM], U_stride[NDIM];
+    double fac[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        F_stride[d] = d == 0 ? 1 : F_stride[d - 1] * F_box.numberCells(d - 1);
+        U_stride[d] = d == 0 ? 1 : U_stride[d - 1] * U_box.numberCells(d - 1);
+        fac[d] = alpha / (dx[d] * dx[d]);
+    }
+    for (Box<NDIM>::Iterator b(box); b; b++)
+    {
+        const Index<NDIM>& i = b();
+        int F_offset = 0, U_offset = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            F_offset += (i(d) - F_box.lower(d)) * F_stride[d];
+            U_offset += (i(d) - U_box.lower(d)) * U_stride[d];
+        }
+        const double u = U[U_offset];
+        double f = 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            f += fac[d] * (U[U_offset - U_stride[d]] + U[U_offset + U_stride[d]] - 2.0 * u);
+        }
+        F[F_offset] = f + beta * u;
+    }
+    return;
+} // damped_laplace_on_box
+
+// Compute F_l = alpha L U_m + beta U_m either on the indices of the specified
+// data box whose stencils do not extend outside of the data box, or on the
+// remaining indices of the data box.
+void
+damped_laplace_on_part(ArrayData<NDIM, double>& F_data,
+                       const int l,
+                       const double alpha,
+                       const double beta,
+                       const ArrayData<NDIM, double>& U_data,
+                       const int m,
+                       const Box<NDIM>& data_box,
+                       const bool interior,
+                       const double* const dx)
+{
+    const Box<NDIM> interior_box = Box<NDIM>::grow(data_box, -1);
+    if (interior)
+    {
+        if (!interior_box.empty()) damped_laplace_on_box(F_data, l, alpha, beta, U_data, m, interior_box, dx);
+        return;
+    }
+    BoxList<NDIM> strip_boxes(data_box);
+    strip_boxes.removeIntersections(interior_box);
+    for (BoxList<NDIM>::Iterator it(strip_boxes); it; it++)
+    {
+        damped_laplace_on_box(F_data, l, alpha, beta, U_data, m, it(), dx);
+    }
+    return;
+} // damped_laplace_on_part
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 PatchMathOps::PatchMathOps()
@@ -4649,6 +4734,104 @@ PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
     return;
 } // laplace
 
+void
+PatchMathOps::laplaceOnInterior(Pointer<CellData<NDIM, double> > dst,
+                                const double alpha,
+                                const double beta,
+                                const Pointer<CellData<NDIM, double> > src1,
+                                const Pointer<Patch<NDIM> > patch,
+                                const int l,
+                                const int m) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(src1 != dst);
+    TBOX_ASSERT(patch->getBox() == dst->getBox() && patch->getBox() == src1->getBox());
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    damped_laplace_on_part(
+        dst->getArrayData(), l, alpha, beta, src1->getArrayData(), m, patch->getBox(), true, pgeom->getDx());
+    return;
+} // laplaceOnInterior
+
+void
+PatchMathOps::laplaceOnInterior(Pointer<SideData<NDIM, double> > dst,
+                                const double alpha,
+                                const double beta,
+                                const Pointer<SideData<NDIM, double> > src1,
+                                const Pointer<Patch<NDIM> > patch,
+                                const int l,
+                                const int m) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(src1 != dst);
+    TBOX_ASSERT(patch->getBox() == dst->getBox() && patch->getBox() == src1->getBox());
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        damped_laplace_on_part(dst->getArrayData(axis),
+                               l,
+                               alpha,
+                               beta,
+                               src1->getArrayData(axis),
+                               m,
+                               SideGeometry<NDIM>::toSideBox(patch->getBox(), axis),
+                               true,
+                               pgeom->getDx());
+    }
+    return;
+} // laplaceOnInterior
+
+void
+PatchMathOps::laplaceOnBoundaryStrip(Pointer<CellData<NDIM, double> > dst,
+                                     const double alpha,
+                                     const double beta,
+                                     const Pointer<CellData<NDIM, double> > src1,
+                                     const Pointer<Patch<NDIM> > patch,
+                                     const int l,
+                                     const int m) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(src1 != dst);
+    TBOX_ASSERT(patch->getBox() == dst->getBox() && patch->getBox() == src1->getBox());
+    TBOX_ASSERT(src1->getGhostCellWidth().min() >= 1);
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    damped_laplace_on_part(
+        dst->getArrayData(), l, alpha, beta, src1->getArrayData(), m, patch->getBox(), false, pgeom->getDx());
+    return;
+} // laplaceOnBoundaryStrip
+
+void
+PatchMathOps::laplaceOnBoundaryStrip(Pointer<SideData<NDIM, double> > dst,
+                                     const double alpha,
+                                     const double beta,
+                                     const Pointer<SideData<NDIM, double> > src1,
+                                     const Pointer<Patch<NDIM> > patch,
+                                     const int l,
+                                     const int m) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(src1 != dst);
+    TBOX_ASSERT(patch->getBox() == dst->getBox() && patch->getBox() == src1->getBox());
+    TBOX_ASSERT(src1->getGhostCellWidth().min() >= 1);
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        damped_laplace_on_part(dst->getArrayData(axis),
+                               l,
+                               alpha,
+                               beta,
+                               src1->getArrayData(axis),
+                               m,
+                               SideGeometry<NDIM>::toSideBox(patch->getBox(), axis),
+                               false,
+                               pgeom->getDx());
+    }
+    return;
+} // laplaceOnBoundaryStrip
+
 void
 PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                       const Pointer<FaceData<NDIM, double> > alpha,
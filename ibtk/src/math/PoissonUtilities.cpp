@@ -1083,6 +1083,102 @@ PoissonUtilities::adjustRHSAtCoarseFineBoundary(SideData<NDIM, double>& rhs_data
     return;
 } // adjustRHSAtCoarseFineBoundary
 
+void
+PoissonUtilities::redBlackGaussSeidelSweep(ArrayData<NDIM, double>& U_data,
+                                           const ArrayData<NDIM, double>& F_data,
+                                           const Box<NDIM>& box,
+                                           const double alpha,
+                                           const double beta,
+                                           const double* const dx,
+                                           const int red_or_black,
+                                           const ArrayData<NDIM, int>* const mask_data)
+{
+    const int depth = U_data.getDepth();
+    const Box<NDIM>& U_box = U_data.getBox();
+    const Box<NDIM>& F_box = F_data.getBox();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(F_data.getDepth() == depth);
+    TBOX_ASSERT(U_box.contains(Box<NDIM>::grow(box, 1)));
+    TBOX_ASSERT(F_box.contains(box));
+    if (mask_data)
+    {
+        TBOX_ASSERT(mask_data->getDepth() == depth);
+        TBOX_ASSERT(mask_data->getBox().contains(box));
+    }
+#endif
+    if (box.empty()) return;
+
+    // Compute the strides of the array data.
+    const Box<NDIM> mask_box = mask_data ? mask_data->getBox() : box;
+    int U_stride[NDIM], F_stride[NDIM], mask_stride[NDIM];
+    U_stride[0] = 1;
+    F_stride[0] = 1;
+    mask_stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        U_stride[d] = U_stride[d - 1] * U_box.numberCells(d - 1);
+        F_stride[d] = F_stride[d - 1] * F_box.numberCells(d - 1);
+        mask_stride[d] = mask_stride[d - 1] * mask_box.numberCells(d - 1);
+    }
+
+    // Compute the stencil coefficients.
+    double fac[NDIM], fac_sum = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac[d] = alpha / (dx[d] * dx[d]);
+        fac_sum += fac[d];
+    }
+    const double fac_diag = 0.5 / (fac_sum - 0.5 * beta);
+
+    // Cells of the same color are decoupled, so that the rows of the box can be
+    // updated concurrently.
+    const int color = red_or_black % 2; // "red" = 0, "black" = 1
+    const int n1 = box.numberCells(1);
+    int num_rows = 1;
+    for (unsigned int d = 1; d < NDIM; ++d) num_rows *= box.numberCells(d);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) if (num_rows > 1)
+#endif
+    for (int row = 0; row < num_rows; ++row)
+    {
+        Index<NDIM> i_lower = box.lower();
+        i_lower(1) += row % n1;
+#if (NDIM == 3)
+        i_lower(2) += row / n1;
+#endif
+        int parity = 0;
+        for (unsigned int d = 0; d < NDIM; ++d) parity += i_lower(d);
+        if ((parity & 1) != color) i_lower(0) += 1;
+        if (i_lower(0) > box.upper(0)) continue;
+        int U_offset = 0, F_offset = 0, mask_offset = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            U_offset += (i_lower(d) - U_box.lower(d)) * U_stride[d];
+            F_offset += (i_lower(d) - F_box.lower(d)) * F_stride[d];
+            mask_offset += (i_lower(d) - mask_box.lower(d)) * mask_stride[d];
+        }
+        const int num_cells = (box.upper(0) - i_lower(0)) / 2 + 1;
+        for (int k = 0; k < depth; ++k)
+        {
+            double* const U = U_data.getPointer(k) + U_offset;
+            const double* const F = F_data.getPointer(k) + F_offset;
+            const int* const mask = mask_data ? mask_data->getPointer(k) + mask_offset : NULL;
+            for (int n = 0; n < num_cells; ++n)
+            {
+                const int i = 2 * n;
+                if (mask && mask[i] != 0) continue;
+                double U_nbr_sum = fac[0] * (U[i - 1] + U[i + 1]);
+                for (unsigned int d = 1; d < NDIM; ++d)
+                {
+                    U_nbr_sum += fac[d] * (U[i - U_stride[d]] + U[i + U_stride[d]]);
+                }
+                U[i] = fac_diag * (U_nbr_sum - F[i]);
+            }
+        }
+    }
+    return;
+} // redBlackGaussSeidelSweep
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
@@ -82,6 +82,7 @@
 #include "ibtk/LinearSolver.h"
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/PoissonUtilities.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -198,6 +199,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    THREADED_RED_BLACK_GAUSS_SEIDEL,
     UNKNOWN = -1
 };
 
@@ -206,8 +208,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "THREADED_RED_BLACK_GAUSS_SEIDEL")
+        return THREADED_RED_BLACK_GAUSS_SEIDEL;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -215,7 +218,7 @@ get_smoother_type(const std::string& smoother_type_string)
 inline bool
 use_red_black_ordering(SmootherType smoother_type)
 {
-    if (smoother_type == RED_BLACK_GAUSS_SEIDEL)
+    if (smoother_type == RED_BLACK_GAUSS_SEIDEL || smoother_type == THREADED_RED_BLACK_GAUSS_SEIDEL)
     {
         return true;
     }
@@ -228,7 +231,8 @@ use_red_black_ordering(SmootherType smoother_type)
 inline bool
 do_local_data_update(SmootherType smoother_type)
 {
-    if (smoother_type == PROCESSOR_GAUSS_SEIDEL || smoother_type == RED_BLACK_GAUSS_SEIDEL)
+    if (smoother_type == PROCESSOR_GAUSS_SEIDEL || smoother_type == RED_BLACK_GAUSS_SEIDEL ||
+        smoother_type == THREADED_RED_BLACK_GAUSS_SEIDEL)
     {
         return true;
     }
@@ -381,41 +385,35 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
-    // Cache coarse-fine interface ghost cell values in the "scratch" data.
-    if (level_num > d_coarsest_ln && num_sweeps > 1)
-    {
-        int patch_counter = 0;
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
-            Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
-#if !defined(NDEBUG)
-            const Box<NDIM>& ghost_box = error_data->getGhostBox();
-            TBOX_ASSERT(ghost_box == scratch_data->getGhostBox());
-            TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
-            TBOX_ASSERT(scratch_data->getGhostCellWidth() == d_gcw);
-#endif
-            scratch_data->getArrayData().copy(
-                error_data->getArrayData(), d_patch_bc_box_overlap[level_num][patch_counter], IntVector<NDIM>(0));
-        }
-    }
-
     // Smooth the error by the specified number of sweeps.
+    //
+    // When more than one sweep is performed on a level with a coarser level,
+    // the coarse-fine interface ghost cell values are cached in the "scratch"
+    // data during the first sweep and are restored into the error data as soon
+    // as each patch has been smoothed, rather than in separate passes over the
+    // level.
     if (red_black_ordering) num_sweeps *= 2;
+    const bool cache_cf_ghost_values = level_num > d_coarsest_ln && num_sweeps > 1;
     for (int isweep = 0; isweep < num_sweeps; ++isweep)
     {
         // Re-fill ghost cell data as needed.
         if (level_num > d_coarsest_ln)
         {
-            if (isweep > 0)
+            // Fill the non-coarse-fine interface ghost cell values.  The
+            // coarse-fine interface ghost cell values were restored at the end
+            // of the previous sweep.
+            if (isweep > 0) xeqScheduleGhostFillNoCoarse(error_idx, level_num);
+
+            // Complete the coarse-fine interface interpolation by computing the
+            // normal extension.
+            d_cf_bdry_op->setPatchDataIndex(error_idx);
+            const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
             {
-                // Copy the coarse-fine interface ghost cell values which are
-                // cached in the scratch data into the error data.
-                int patch_counter = 0;
-                for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                if (isweep == 0 && cache_cf_ghost_values)
                 {
-                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
                     Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
                     Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
 #if !defined(NDEBUG)
@@ -424,22 +422,10 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
                     TBOX_ASSERT(scratch_data->getGhostCellWidth() == d_gcw);
 #endif
-                    error_data->getArrayData().copy(scratch_data->getArrayData(),
-                                                    d_patch_bc_box_overlap[level_num][patch_counter],
-                                                    IntVector<NDIM>(0));
+                    scratch_data->getArrayData().copy(error_data->getArrayData(),
+                                                      d_patch_bc_box_overlap[level_num][patch_counter],
+                                                      IntVector<NDIM>(0));
                 }
-
-                // Fill the non-coarse-fine interface ghost cell values.
-                xeqScheduleGhostFillNoCoarse(error_idx, level_num);
-            }
-
-            // Complete the coarse-fine interface interpolation by computing the
-            // normal extension.
-            d_cf_bdry_op->setPatchDataIndex(error_idx);
-            const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-            {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
                 const IntVector<NDIM>& ghost_width_to_fill = d_gcw;
                 d_cf_bdry_op->computeNormalExtension(*patch, ratio, ghost_width_to_fill);
             }
@@ -492,51 +478,75 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             // data.
             const double& alpha = d_poisson_spec.getDConstant();
             const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
-            for (int depth = 0; depth < error_data->getDepth(); ++depth)
+            if (smoother_type == THREADED_RED_BLACK_GAUSS_SEIDEL)
+            {
+                const int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                PoissonUtilities::redBlackGaussSeidelSweep(error_data->getArrayData(),
+                                                           residual_data->getArrayData(),
+                                                           patch_box,
+                                                           alpha,
+                                                           beta,
+                                                           dx,
+                                                           red_or_black);
+            }
+            else
             {
-                double* const U = error_data->getPointer(depth);
-                const int U_ghosts = (error_data->getGhostCellWidth()).max();
-                const double* const F = residual_data->getPointer(depth);
-                const int F_ghosts = (residual_data->getGhostCellWidth()).max();
-                if (red_black_ordering)
+                for (int depth = 0; depth < error_data->getDepth(); ++depth)
                 {
-                    int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                    RB_GS_SMOOTH_FC(U,
-                                    U_ghosts,
-                                    alpha,
-                                    beta,
-                                    F,
-                                    F_ghosts,
-                                    patch_box.lower(0),
-                                    patch_box.upper(0),
-                                    patch_box.lower(1),
-                                    patch_box.upper(1),
+                    double* const U = error_data->getPointer(depth);
+                    const int U_ghosts = (error_data->getGhostCellWidth()).max();
+                    const double* const F = residual_data->getPointer(depth);
+                    const int F_ghosts = (residual_data->getGhostCellWidth()).max();
+                    if (red_black_ordering)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        RB_GS_SMOOTH_FC(U,
+                                        U_ghosts,
+                                        alpha,
+                                        beta,
+                                        F,
+                                        F_ghosts,
+                                        patch_box.lower(0),
+                                        patch_box.upper(0),
+                                        patch_box.lower(1),
+                                        patch_box.upper(1),
 #if (NDIM == 3)
-                                    patch_box.lower(2),
-                                    patch_box.upper(2),
+                                        patch_box.lower(2),
+                                        patch_box.upper(2),
 #endif
-                                    dx,
-                                    red_or_black);
-                }
-                else
-                {
-                    GS_SMOOTH_FC(U,
-                                 U_ghosts,
-                                 alpha,
-                                 beta,
-                                 F,
-                                 F_ghosts,
-                                 patch_box.lower(0),
-                                 patch_box.upper(0),
-                                 patch_box.lower(1),
-                                 patch_box.upper(1),
+                                        dx,
+                                        red_or_black);
+                    }
+                    else
+                    {
+                        GS_SMOOTH_FC(U,
+                                     U_ghosts,
+                                     alpha,
+                                     beta,
+                                     F,
+                                     F_ghosts,
+                                     patch_box.lower(0),
+                                     patch_box.upper(0),
+                                     patch_box.lower(1),
+                                     patch_box.upper(1),
 #if (NDIM == 3)
-                                 patch_box.lower(2),
-                                 patch_box.upper(2),
+                                     patch_box.lower(2),
+                                     patch_box.upper(2),
 #endif
-                                 dx);
+                                     dx);
+                    }
                 }
             }
+
+            // Copy the coarse-fine interface ghost cell values which are cached
+            // in the scratch data into the error data for the next sweep.
+            if (cache_cf_ghost_values && isweep + 1 < num_sweeps)
+            {
+                Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+                error_data->getArrayData().copy(scratch_data->getArrayData(),
+                                                d_patch_bc_box_overlap[level_num][patch_counter],
+                                                IntVector<NDIM>(0));
+            }
         }
     }
     IBTK_TIMER_STOP(t_smooth_error);
@@ -39,15 +39,19 @@
 
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
 #include "SideDataFactory.h"
 #include "SideVariable.h"
 #include "VariableFillPattern.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LaplaceOperator.h"
+#include "ibtk/PatchMathOps.h"
 #include "ibtk/SCLaplaceOperator.h"
 #include "ibtk/SideNoCornersFillPattern.h"
 #include "ibtk/StaggeredPhysicalBoundaryHelper.h"
@@ -93,6 +97,7 @@ static const bool CONSISTENT_TYPE_2_BDRY = false;
 
 // Timers.
 static Timer* t_apply;
+static Timer* t_apply_overlap;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
 }
@@ -117,6 +122,7 @@ SCLaplaceOperator::SCLaplaceOperator(const std::string& object_name, const bool
 
     // Setup Timers.
     IBTK_DO_ONCE(t_apply = TimerManager::getManager()->getTimer("IBTK::SCLaplaceOperator::apply()");
+                 t_apply_overlap = TimerManager::getManager()->getTimer("IBTK::SCLaplaceOperator::apply()[overlap]");
                  t_initialize_operator_state =
                      TimerManager::getManager()->getTimer("IBTK::SCLaplaceOperator::initializeOperatorState()");
                  t_deallocate_operator_state =
@@ -167,13 +173,24 @@ SCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
     // Allocate scratch data.
     d_x->allocateVectorData();
 
+    // When the operator is discretized with the standard 5 point (7 point)
+    // stencil on a single level, the action of the operator is computed at the
+    // sides that do not require ghost cell values while the ghost cell values
+    // are being filled.  In this case, the interior values of x are copied into
+    // the scratch data so that the ghost cell values can be filled in place.
+    const bool overlap_fill = d_coarsest_ln == d_finest_ln && d_poisson_spec.dIsConstant() &&
+                              (d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant());
+    if (overlap_fill) d_x->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
+
     // Simultaneously fill ghost cell values for all components.
     typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
     std::vector<InterpolationTransactionComponent> transaction_comps;
     for (int comp = 0; comp < d_ncomp; ++comp)
     {
-        InterpolationTransactionComponent x_component(d_x->getComponentDescriptorIndex(comp),
-                                                      x.getComponentDescriptorIndex(comp),
+        const int x_scratch_idx = d_x->getComponentDescriptorIndex(comp);
+        const int x_src_idx = overlap_fill ? x_scratch_idx : x.getComponentDescriptorIndex(comp);
+        InterpolationTransactionComponent x_component(x_scratch_idx,
+                                                      x_src_idx,
                                                       DATA_REFINE_TYPE,
                                                       USE_CF_INTERPOLATION,
                                                       DATA_COARSEN_TYPE,
@@ -185,7 +202,29 @@ SCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
     }
     d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
     d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
-    d_hier_bdry_fill->fillData(d_solution_time);
+    d_hier_bdry_fill->beginFillData(d_solution_time);
+
+    const double alpha = d_poisson_spec.dIsConstant() ? d_poisson_spec.getDConstant() : 0.0;
+    const double beta = d_poisson_spec.cIsConstant() ? d_poisson_spec.getCConstant() : 0.0;
+    PatchMathOps patch_math_ops;
+    if (overlap_fill)
+    {
+        IBTK_TIMER_START(t_apply_overlap);
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int comp = 0; comp < d_ncomp; ++comp)
+            {
+                Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(d_x->getComponentDescriptorIndex(comp));
+                Pointer<SideData<NDIM, double> > y_data = patch->getPatchData(y.getComponentDescriptorIndex(comp));
+                patch_math_ops.laplaceOnInterior(y_data, alpha, beta, x_data, patch);
+            }
+        }
+        IBTK_TIMER_STOP(t_apply_overlap);
+    }
+
+    d_hier_bdry_fill->endFillData();
     d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
 
     // Compute the action of the operator.
@@ -195,7 +234,21 @@ SCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
         Pointer<SideVariable<NDIM, double> > y_sc_var = y.getComponentVariable(comp);
         const int x_scratch_idx = d_x->getComponentDescriptorIndex(comp);
         const int y_idx = y.getComponentDescriptorIndex(comp);
-        d_hier_math_ops->laplace(y_idx, y_sc_var, d_poisson_spec, x_scratch_idx, x_sc_var, d_no_fill, 0.0);
+        if (overlap_fill)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(x_scratch_idx);
+                Pointer<SideData<NDIM, double> > y_data = patch->getPatchData(y_idx);
+                patch_math_ops.laplaceOnBoundaryStrip(y_data, alpha, beta, x_data, patch);
+            }
+        }
+        else
+        {
+            d_hier_math_ops->laplace(y_idx, y_sc_var, d_poisson_spec, x_scratch_idx, x_sc_var, d_no_fill, 0.0);
+        }
         const int x_idx = x.getComponentDescriptorIndex(comp);
         d_bc_helpers[comp]->copyDataAtDirichletBoundaries(y_idx, x_idx);
     }
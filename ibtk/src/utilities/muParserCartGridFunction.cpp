@@ -32,12 +32,17 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 #include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
@@ -45,16 +50,19 @@
 #include "CellIndex.h"
 #include "CellIterator.h"
 #include "FaceData.h"
+#include "FaceGeometry.h"
 #include "FaceIndex.h"
 #include "FaceIterator.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "NodeData.h"
+#include "NodeGeometry.h"
 #include "NodeIndex.h"
 #include "NodeIterator.h"
 #include "Patch.h"
 #include "PatchData.h"
 #include "SideData.h"
+#include "SideGeometry.h"
 #include "SideIndex.h"
 #include "SideIterator.h"
 #include "ibtk/CartGridFunction.h"
@@ -92,6 +100,16 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Minimum number of values evaluated by each thread during bulk evaluation.
+static const int MIN_BULK_SIZE_PER_THREAD = 4096;
+
+// Maximum total number of cached function values.  The cache is cleared when
+// this limit is reached, e.g., after repeated regridding.
+static const size_t MAX_CACHED_VALUES = 1 << 22;
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 muParserCartGridFunction::muParserCartGridFunction(const std::string& object_name,
@@ -102,8 +120,13 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
       d_constants(),
       d_function_strings(),
       d_parsers(),
+      d_thread_parsers(),
+      d_function_is_constant(),
+      d_function_is_time_dependent(),
       d_parser_time(),
-      d_parser_posn()
+      d_function_cache(),
+      d_num_cached_values(0),
+      d_function_values()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -275,19 +298,34 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
         {
             it->DefineConst(map_cit->first, map_cit->second);
         }
+    }
 
-        // Variables.
-        it->DefineVar("T", &d_parser_time);
-        it->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.
+    resizeParserBuffers(1);
+
+    // Determine which functions depend on position and time.
+    for (std::vector<mu::Parser>::iterator it = d_parsers.begin(); it != d_parsers.end(); ++it)
+    {
+        try
         {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            it->DefineVar("X" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x_" + postfix, &(d_parser_posn[d]));
+            const mu::varmap_type& used_vars = it->GetUsedVar();
+            d_function_is_constant.push_back(used_vars.empty());
+            d_function_is_time_dependent.push_back(used_vars.count("t") || used_vars.count("T"));
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  error: "
+                       << e.GetMsg()
+                       << "\n"
+                       << "  in:    "
+                       << e.GetExpr()
+                       << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -313,10 +351,7 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          const bool /*initial_time*/,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
-    const Index<NDIM>& patch_lower = patch_box.lower();
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
 
     const double* const XLower = pgeom->getXLower();
@@ -339,32 +374,12 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            const std::vector<double>& values =
+                evaluateFunction(function_depth, CELL_CENTERING, 0, patch_box, XLower, dx, data_time);
+            std::vector<double>::const_iterator val_it = values.begin();
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++val_it)
             {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                (*cc_data)(ic(), data_depth) = *val_it;
             }
         }
     }
@@ -399,41 +414,12 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const std::vector<double>& values =
+                    evaluateFunction(function_depth, FACE_CENTERING, axis, patch_box, XLower, dx, data_time);
+                std::vector<double>::const_iterator val_it = values.begin();
+                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++val_it)
                 {
-                    const FaceIndex<NDIM>& i = ic();
-                    const Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    (*fc_data)(ic(), data_depth) = *val_it;
                 }
             }
         }
@@ -446,32 +432,12 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
+            const std::vector<double>& values =
+                evaluateFunction(function_depth, NODE_CENTERING, 0, patch_box, XLower, dx, data_time);
+            std::vector<double>::const_iterator val_it = values.begin();
+            for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++val_it)
             {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                (*nc_data)(ic(), data_depth) = *val_it;
             }
         }
     }
@@ -506,51 +472,294 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const std::vector<double>& values =
+                    evaluateFunction(function_depth, SIDE_CENTERING, axis, patch_box, XLower, dx, data_time);
+                std::vector<double>::const_iterator val_it = values.begin();
+                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++val_it)
+                {
+                    (*sc_data)(ic(), data_depth) = *val_it;
+                }
+            }
+        }
+    }
+    else
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unsupported patch data type encountered."
+                   << std::endl);
+    }
+    return;
+} // setDataOnPatch
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+const std::vector<double>&
+muParserCartGridFunction::evaluateFunction(const int function_depth,
+                                           const DataCentering centering,
+                                           const unsigned int axis,
+                                           const Box<NDIM>& patch_box,
+                                           const double* const x_lower,
+                                           const double* const dx,
+                                           const double data_time)
+{
+    // Look up any cached values.  Time-dependent functions are only reused
+    // when they are requested at the same time.
+    FunctionCacheKey key;
+    key.function_depth = function_depth;
+    key.centering = centering;
+    key.axis = axis;
+    key.patch_box = patch_box;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        key.x_lower[d] = x_lower[d];
+        key.dx[d] = dx[d];
+    }
+    std::map<FunctionCacheKey, FunctionCacheEntry>::iterator it = d_function_cache.find(key);
+    if (it != d_function_cache.end() &&
+        (!d_function_is_time_dependent[function_depth] || it->second.time == data_time))
+    {
+        return it->second.values;
+    }
+
+    // Determine the positions at which the function is to be evaluated.
+    const Index<NDIM>& patch_lower = patch_box.lower();
+    Box<NDIM> data_box;
+    switch (centering)
+    {
+    case CELL_CENTERING:
+        data_box = patch_box;
+        break;
+    case FACE_CENTERING:
+        data_box = FaceGeometry<NDIM>::toFaceBox(patch_box, axis);
+        break;
+    case NODE_CENTERING:
+        data_box = NodeGeometry<NDIM>::toNodeBox(patch_box);
+        break;
+    case SIDE_CENTERING:
+        data_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+        break;
+    }
+    const int size = data_box.size();
+    resizeParserBuffers(size);
+    if (!d_function_is_constant[function_depth])
+    {
+        std::fill(d_parser_time.begin(), d_parser_time.begin() + size, data_time);
+        int k = 0;
+        switch (centering)
+        {
+        case CELL_CENTERING:
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++k)
+            {
+                const CellIndex<NDIM>& i = ic();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                }
+            }
+            break;
+        case FACE_CENTERING:
+            for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+            {
+                const Index<NDIM>& cell_idx = ic().toCell(1);
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                    if (d == axis)
                     {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
+                        d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
                     }
-                    try
+                    else
                     {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
+                        d_parser_posn[d][k] =
+                            x_lower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
                     }
-                    catch (mu::ParserError& e)
+                }
+            }
+            break;
+        case NODE_CENTERING:
+            for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++k)
+            {
+                const NodeIndex<NDIM>& i = ic();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                }
+            }
+            break;
+        case SIDE_CENTERING:
+            for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+            {
+                const SideIndex<NDIM>& i = ic();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    if (d == axis)
                     {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
+                        d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
                     }
-                    catch (...)
+                    else
                     {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
+                        d_parser_posn[d][k] =
+                            x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
                     }
                 }
             }
+            break;
         }
+#if !defined(NDEBUG)
+        TBOX_ASSERT(k == size);
+#endif
     }
-    else
+
+    // Select where to store the values.  Values that do not fit in the cache
+    // are stored in a scratch buffer.
+    std::vector<double>* values = &d_function_values;
+    if (it != d_function_cache.end())
     {
-        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                   << "  unsupported patch data type encountered."
-                   << std::endl);
+        values = &it->second.values;
+    }
+    else if (static_cast<size_t>(size) <= MAX_CACHED_VALUES)
+    {
+        if (d_num_cached_values + size > MAX_CACHED_VALUES)
+        {
+            d_function_cache.clear();
+            d_num_cached_values = 0;
+        }
+        it = d_function_cache.insert(std::make_pair(key, FunctionCacheEntry())).first;
+        d_num_cached_values += size;
+        values = &it->second.values;
+    }
+    values->resize(size);
+    if (it != d_function_cache.end()) it->second.time = data_time;
+
+    // Evaluate the function.
+    if (size > 0) evaluateBulk(function_depth, &(*values)[0], size);
+    return *values;
+} // evaluateFunction
+
+void
+muParserCartGridFunction::evaluateBulk(const int function_depth, double* const values, const int size)
+{
+    mu::Parser& parser = d_parsers[function_depth];
+    std::string error_msg;
+    try
+    {
+        if (d_function_is_constant[function_depth])
+        {
+            std::fill(values, values + size, parser.Eval());
+            return;
+        }
+
+        int num_threads = 1;
+#if defined(_OPENMP)
+        num_threads = std::max(1, std::min(omp_get_max_threads(), size / MIN_BULK_SIZE_PER_THREAD));
+#endif
+        if (num_threads == 1)
+        {
+            parser.Eval(values, size);
+            return;
+        }
+
+        // Split the values into contiguous chunks that are evaluated by
+        // thread-private copies of the parser.
+        if (static_cast<int>(d_thread_parsers.size()) < num_threads) d_thread_parsers.resize(num_threads);
+        std::vector<int> offsets(num_threads + 1);
+        for (int thread = 0; thread <= num_threads; ++thread)
+        {
+            offsets[thread] = static_cast<int>((static_cast<long>(size) * thread) / num_threads);
+        }
+        for (int thread = 0; thread < num_threads; ++thread)
+        {
+            d_thread_parsers[thread] = parser;
+            defineParserVariables(d_thread_parsers[thread], offsets[thread]);
+        }
+        std::vector<std::string> thread_error_msgs(num_threads);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+#endif
+        for (int thread = 0; thread < num_threads; ++thread)
+        {
+            try
+            {
+                d_thread_parsers[thread].Eval(values + offsets[thread], offsets[thread + 1] - offsets[thread]);
+            }
+            catch (mu::ParserError& e)
+            {
+                thread_error_msgs[thread] = "  error: " + e.GetMsg() + "\n" + "  in:    " + e.GetExpr() + "\n";
+            }
+            catch (...)
+            {
+                thread_error_msgs[thread] = "  unrecognized exception generated by muParser library.\n";
+            }
+        }
+        for (int thread = 0; thread < num_threads && error_msg.empty(); ++thread)
+        {
+            error_msg = thread_error_msgs[thread];
+        }
+    }
+    catch (mu::ParserError& e)
+    {
+        error_msg = "  error: " + e.GetMsg() + "\n" + "  in:    " + e.GetExpr() + "\n";
+    }
+    catch (...)
+    {
+        error_msg = "  unrecognized exception generated by muParser library.\n";
+    }
+    if (!error_msg.empty())
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n" << error_msg);
     }
     return;
-} // setDataOnPatch
+} // evaluateBulk
+
+void
+muParserCartGridFunction::resizeParserBuffers(const int size)
+{
+    if (size <= static_cast<int>(d_parser_time.size())) return;
+    const int new_size = std::max(size, static_cast<int>(2 * d_parser_time.size()));
+    d_parser_time.resize(new_size, 0.0);
+    for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d].resize(new_size, 0.0);
+
+    // Bulk evaluation reads every variable from an array, so that the parser
+    // variables must be redefined whenever the buffers are reallocated.
+    for (std::vector<mu::Parser>::iterator it = d_parsers.begin(); it != d_parsers.end(); ++it)
+    {
+        defineParserVariables(*it, 0);
+    }
+    return;
+} // resizeParserBuffers
+
+void
+muParserCartGridFunction::defineParserVariables(mu::Parser& parser, const int offset)
+{
+    parser.DefineVar("T", &d_parser_time[offset]);
+    parser.DefineVar("t", &d_parser_time[offset]);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        std::ostringstream stream;
+        stream << d;
+        const std::string postfix = stream.str();
+        parser.DefineVar("X" + postfix, &d_parser_posn[d][offset]);
+        parser.DefineVar("x" + postfix, &d_parser_posn[d][offset]);
+        parser.DefineVar("X_" + postfix, &d_parser_posn[d][offset]);
+        parser.DefineVar("x_" + postfix, &d_parser_posn[d][offset]);
+    }
+    return;
+} // defineParserVariables
+
+bool
+muParserCartGridFunction::FunctionCacheKey::operator<(const FunctionCacheKey& that) const
+{
+    if (function_depth != that.function_depth) return function_depth < that.function_depth;
+    if (centering != that.centering) return centering < that.centering;
+    if (axis != that.axis) return axis < that.axis;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (patch_box.lower()(d) != that.patch_box.lower()(d)) return patch_box.lower()(d) < that.patch_box.lower()(d);
+        if (patch_box.upper()(d) != that.patch_box.upper()(d)) return patch_box.upper()(d) < that.patch_box.upper()(d);
+        if (x_lower[d] != that.x_lower[d]) return x_lower[d] < that.x_lower[d];
+        if (dx[d] != that.dx[d]) return dx[d] < that.dx[d];
+    }
+    return false;
+} // operator<
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -411,6 +411,19 @@ public:
                                  double f_periodic_corr,
                                  const int managing_rank);
 
+    // \see CIBStrategy::applyRPYMobility() method.
+    /*!
+     * \brief Apply the RPY mobility of the rigid structures to a Lagrangian
+     * force vector at the midpoint positions of the markers.
+     */
+    void applyRPYMobility(Vec V,
+                          Vec L,
+                          const double* grid_dx,
+                          double mu,
+                          double f_periodic_corr,
+                          double opening_angle,
+                          const double scale = 1.0);
+
     // \see CIBStrategy::constructGeometricMatrix() method.
     /*!
      * \brief Generate block-diagonal geometric matrix for the prototypical structures
@@ -515,6 +515,37 @@ public:
                                          double f_periodic_corr,
                                          const int managing_rank);
 
+    /*!
+     * \brief Apply the Rotne-Prager-Yamakawa mobility of all of the rigid
+     * structures to a Lagrangian force vector without forming the mobility
+     * matrix.
+     * \note A default implementation that raises an error is provided in this
+     * class. The derived class provides the actual implementation.
+     *
+     * \param V Vector that contains the velocity \f$ V = scale * M L \f$ on
+     * return.
+     *
+     * \param L Lagrangian force vector.
+     *
+     * \param grid_dx NDIM vector of grid spacing of structure level.
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param f_periodic_corr Periodic domain correction of the mobility.
+     *
+     * \param opening_angle Opening angle of the hierarchical approximation.
+     * \see IBAMR::MobilityFunctions::applyRPYMobility().
+     *
+     * \param scale Scales the velocity vector.
+     */
+    virtual void applyRPYMobility(Vec V,
+                                  Vec L,
+                                  const double* grid_dx,
+                                  double mu,
+                                  double f_periodic_corr,
+                                  double opening_angle,
+                                  const double scale = 1.0);
+
     /*!
      * \brief Construct a geometric matrix for the prototypical structures
      * identified by their indices. A geometric matrix maps center of mass rigid
@@ -39,6 +39,7 @@
 #include <vector>
 
 #include "ibamr/ibamr_enums.h"
+#include "mpi.h"
 #include "petscmat.h"
 #include "petscvec.h"
 #include "tbox/Database.h"
@@ -65,6 +66,26 @@ namespace IBAMR
 /*!
  * \brief Class DirectMobilitySolver solves the mobility and body-mobility
  * sub-problem by employing direct solvers.
+ *
+ * By default, all of the work for a dense matrix is done by the processor
+ * that manages it.  If the input database sets
+ * <code>distribute_factorization = TRUE</code>, the matrices are instead
+ * assigned to processors by size so as to balance the cost of factorizing
+ * them, and each mobility matrix that is inverted by LAPACK_CHOLESKY is
+ * factorized in parallel by a group of processors.  The columns of the matrix
+ * are distributed among the processors of the group in blocks of
+ * <code>factorization_block_size</code> (default 64) columns in a round-robin
+ * (one-dimensional block-cyclic) fashion.  The factor is collected on the
+ * managing processor of the group, which does the subsequent solves.
+ *
+ * If the mobility matrices are recomputed every time step
+ * (<code>recompute_mob_mat_perstep = TRUE</code>) and the input database sets
+ * <code>incremental_factorization = TRUE</code>, the Cholesky factorization of
+ * a mobility matrix is updated rather than recomputed when only some of its
+ * structures have moved since the previous factorization: the structures that
+ * have not moved are ordered first, so that the leading part of the previous
+ * factor is reused and only the trailing part is recomputed.  This requires
+ * the managing processor to store two additional copies of each such matrix.
  */
 class DirectMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -102,6 +123,9 @@ public:
      * matrix. The matrix is scaled as \f$ [MM] = \alpha*[MM] + \beta*[I]. \f$
      *
      * \param managing_proc MPI processor that manages this mobility matrix.
+     * \note If the factorization is distributed, the managing processor is
+     * chosen by the solver, and this parameter must be left at its default
+     * value.
      */
     void registerMobilityMat(const std::string& mat_name,
                              const unsigned prototype_struct_id,
@@ -132,6 +156,9 @@ public:
      * matrix. The matrix is scaled as \f$ [MM] = \alpha*[MM] + \beta*[I]. \f$
      *
      * \param managing_proc MPI processor that manages this mobility matrix.
+     * \note If the factorization is distributed, the managing processor is
+     * chosen by the solver, and this parameter must be left at its default
+     * value.
      */
     void registerMobilityMat(const std::string& mat_name,
                              const std::vector<unsigned>& prototype_struct_ids,
@@ -228,6 +255,18 @@ private:
      */
     void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
 
+    /*!
+     * \brief Assign the dense matrices to processors and allocate them.
+     */
+    void allocateMobilityMatrices();
+
+    /*!
+     * \brief Assign the dense matrices to groups of processors so as to
+     * balance the cost of factorizing them, and create the communicator of the
+     * group of this processor.
+     */
+    void assignMatricesToProcessors();
+
     /*!
      * \brief Factorize mobility matrix using direct solvers.
      */
@@ -253,10 +292,41 @@ private:
                               const std::string& mat_name,
                               const std::string& err_msg);
 
+    /*!
+     * \brief Compute the Cholesky factorization of a dense matrix in parallel
+     * across the processors of the factorization communicator.
+     *
+     * \note The matrix data needs to be provided only on the first processor
+     * of the communicator, which also receives the factor.
+     */
+    void factorizeDistributedCholesky(double* mat_data, const int mat_size, const std::string& mat_name);
+
+    /*!
+     * \brief Determine which structures of a mobility matrix have moved since
+     * the previous factorization, reorder the matrix so that the structures
+     * that have not moved come first, and return the number of leading rows of
+     * the previous Cholesky factor that remain valid.
+     */
+    int reorderMobilityMatrix(const std::string& mat_name, double* mat_data);
+
+    /*!
+     * \brief Update the Cholesky factorization of a reordered mobility matrix
+     * given the number of leading rows of the previous factor that remain
+     * valid.
+     */
+    void updateCholeskyFactorization(const std::string& mat_name, double* mat_data, const int num_reused_dofs);
+
     /*!
      * \brief Compute solution and store in the rhs vector.
+     *
+     * \param dof_order Order of the unknowns in the factorized matrix, or an
+     * empty vector if the matrix has not been reordered.
      */
-    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs);
+    void computeSolution(Mat& mat,
+                         const MobilityMatrixInverseType& inv_type,
+                         int* ipiv,
+                         double* rhs,
+                         const std::vector<int>& dof_order = std::vector<int>());
 
     // Solver stuff
     std::string d_object_name;
@@ -278,6 +348,7 @@ private:
     std::map<std::string, std::pair<double, double> > d_mat_scale_map;
     std::map<std::string, std::string> d_mat_filename_map;
     std::map<std::string, std::pair<int*, int*> > d_ipiv_map; // permutation matrices for LU
+    std::map<std::string, int> d_mat_num_procs_map;
 
     // PETSc representation of matrices.
     std::map<std::string, std::pair<Mat, Mat> > d_petsc_mat_map;
@@ -293,6 +364,20 @@ private:
     bool d_recompute_mob_mat;
     double d_svd_replace_value, d_svd_eps;
 
+    // Distributed factorization of the mobility matrices.
+    bool d_mats_allocated;
+    bool d_distribute_factorization;
+    int d_factorization_block_size;
+    MPI_Comm d_factorization_comm;
+
+    // Incremental factorization of the mobility matrices.  For each matrix,
+    // the previous (unordered) matrix, the previous Cholesky factor, the order
+    // of the prototype structures in the factor and the corresponding order of
+    // the unknowns are stored.
+    bool d_incremental_factorization;
+    std::map<std::string, std::vector<double> > d_prev_mat_map, d_prev_factor_map;
+    std::map<std::string, std::vector<int> > d_mat_struct_order_map, d_mat_dof_order_map;
+
 }; // DirectMobilitySolver
 
 } // IBAMR
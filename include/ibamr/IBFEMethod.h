@@ -100,6 +100,15 @@ namespace IBAMR
  * \brief Class IBFEMethod is an implementation of the abstract base class
  * IBStrategy that provides functionality required by the IB method with finite
  * element elasticity.
+ *
+ * The elemental contributions to the interior force density may be computed
+ * concurrently by several OpenMP threads; see setNumAssemblyThreads().  The
+ * elemental right-hand-side vectors are added to the global right-hand-side
+ * vector in element order, so that the computed forces do not depend on the
+ * number of threads.  When more than one thread is used, the registered PK1
+ * stress, body force, surface pressure, and surface force functions are called
+ * concurrently and must therefore be reentrant: they must not modify global
+ * data or data that is shared through their context pointers.
  */
 class IBFEMethod : public IBStrategy
 {
@@ -147,6 +156,24 @@ public:
      */
     IBTK::FEDataManager* getFEDataManager(unsigned int part = 0) const;
 
+    /*!
+     * Set the number of OpenMP threads used to compute the elemental
+     * contributions to the interior force density.  If num_assembly_threads is
+     * not positive, the maximum number of OpenMP threads is used.  The default
+     * is to use a single thread.  This setting has no effect when IBAMR is not
+     * compiled with OpenMP support.
+     *
+     * \note When more than one thread is used, the force functions registered
+     * with this class must be reentrant.
+     */
+    void setNumAssemblyThreads(int num_assembly_threads);
+
+    /*!
+     * Return the number of OpenMP threads used to compute the elemental
+     * contributions to the interior force density.
+     */
+    int getNumAssemblyThreads() const;
+
     /*!
      * Indicate that a part should use stress normalization.
      */
@@ -212,8 +239,58 @@ public:
      */
     typedef IBTK::TensorMeshFcnPtr PK1StressFcnPtr;
 
+    /*!
+     * Typedef specifying interface for batched PK1 stress tensor function.
+     *
+     * A batched stress function is called once per element with the data at
+     * all n_qp quadrature points of the element, stored in structure-of-arrays
+     * form: component (i,j) of the deformation gradient at quadrature point qp
+     * is FF[(i*NDIM+j)*n_qp+qp], and component d of the current and reference
+     * coordinates is x[d*n_qp+qp] and X[d*n_qp+qp].  The stress tensor must be
+     * stored in PP using the same layout as FF.  system_var_data[qp] and
+     * system_grad_var_data[qp] provide the data of the requested systems at
+     * quadrature point qp.
+     */
+    typedef void (*PK1StressBatchFcnPtr)(
+        double* PP,
+        const double* FF,
+        const double* x,
+        const double* X,
+        unsigned int n_qp,
+        libMesh::Elem* elem,
+        const std::vector<std::vector<const std::vector<double>*> >& system_var_data,
+        const std::vector<std::vector<const std::vector<libMesh::VectorValue<double> >*> >& system_grad_var_data,
+        double data_time,
+        void* ctx);
+
+    /*!
+     * Struct encapsulating batched PK1 stress tensor function data.
+     */
+    struct PK1StressBatchFcnData
+    {
+        PK1StressBatchFcnData(PK1StressBatchFcnPtr fcn = NULL,
+                              const std::vector<IBTK::SystemData>& system_data = std::vector<IBTK::SystemData>(),
+                              void* const ctx = NULL,
+                              const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
+                              const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
+            : fcn(fcn), system_data(system_data), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+        {
+        }
+
+        PK1StressBatchFcnPtr fcn;
+        std::vector<IBTK::SystemData> system_data;
+        void* ctx;
+        libMesh::QuadratureType quad_type;
+        libMesh::Order quad_order;
+    };
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
+     *
+     * Either a pointwise function (fcn) or a batched function (batch_fcn) may
+     * be provided.  The evaluation routines dispatch to whichever function is
+     * set, so that pointwise functions may be used where batched data are
+     * required and vice versa.
      */
     struct PK1StressFcnData
     {
@@ -222,11 +299,62 @@ public:
                          void* const ctx = NULL,
                          const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
                          const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
-            : fcn(fcn), system_data(system_data), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+            : fcn(fcn),
+              batch_fcn(NULL),
+              system_data(system_data),
+              ctx(ctx),
+              quad_type(quad_type),
+              quad_order(quad_order)
         {
         }
 
+        explicit PK1StressFcnData(const PK1StressBatchFcnData& data)
+            : fcn(NULL),
+              batch_fcn(data.fcn),
+              system_data(data.system_data),
+              ctx(data.ctx),
+              quad_type(data.quad_type),
+              quad_order(data.quad_order)
+        {
+        }
+
+        /*!
+         * \return Whether a stress function has been provided.
+         */
+        bool isSet() const
+        {
+            return fcn || batch_fcn;
+        }
+
+        /*!
+         * Evaluate the stress tensor at a single point.
+         */
+        void evaluate(libMesh::TensorValue<double>& PP,
+                      const libMesh::TensorValue<double>& FF,
+                      const libMesh::Point& x,
+                      const libMesh::Point& X,
+                      libMesh::Elem* elem,
+                      const std::vector<const std::vector<double>*>& system_var_data,
+                      const std::vector<const std::vector<libMesh::VectorValue<double> >*>& system_grad_var_data,
+                      double data_time) const;
+
+        /*!
+         * Evaluate the stress tensor at n_qp points using the
+         * structure-of-arrays layout of PK1StressBatchFcnPtr.
+         */
+        void evaluateBatch(
+            double* PP,
+            const double* FF,
+            const double* x,
+            const double* X,
+            unsigned int n_qp,
+            libMesh::Elem* elem,
+            const std::vector<std::vector<const std::vector<double>*> >& system_var_data,
+            const std::vector<std::vector<const std::vector<libMesh::VectorValue<double> >*> >& system_grad_var_data,
+            double data_time) const;
+
         PK1StressFcnPtr fcn;
+        PK1StressBatchFcnPtr batch_fcn;
         std::vector<IBTK::SystemData> system_data;
         void* ctx;
         libMesh::QuadratureType quad_type;
@@ -241,9 +369,23 @@ public:
      * \note It is possible to register multiple PK1 stress functions with this
      * class.  This is intended to be used to implement selective reduced
      * integration.
+     *
+     * \note If more than one assembly thread is used, the stress function is
+     * evaluated concurrently at different quadrature points and must be
+     * reentrant.
      */
     void registerPK1StressFunction(const PK1StressFcnData& data, unsigned int part = 0);
 
+    /*!
+     * Register the (optional) batched function to compute the first
+     * Piola-Kirchhoff stress tensor.  The function is evaluated for all of the
+     * quadrature points of an element at once, which allows the constitutive
+     * law to be vectorized.
+     *
+     * \see registerPK1StressFunction(const PK1StressFcnData&, unsigned int)
+     */
+    void registerPK1StressFunction(const PK1StressBatchFcnData& data, unsigned int part = 0);
+
     /*!
      * Typedef specifying interface for Lagrangian body force distribution
      * function.
@@ -696,6 +838,7 @@ protected:
     std::vector<libMesh::QuadratureType> d_default_quad_type;
     std::vector<libMesh::Order> d_default_quad_order;
     bool d_use_consistent_mass_matrix;
+    int d_num_assembly_threads;
 
     /*
      * Data related to handling stress normalization.
@@ -118,10 +118,8 @@ public:
         TBOX_ASSERT(ctx);
         IBFEMethod::PK1StressFcnData* PK1_stress_fcn_data = static_cast<IBFEMethod::PK1StressFcnData*>(ctx);
         TBOX_ASSERT(PK1_stress_fcn_data);
-        IBTK::TensorMeshFcnPtr PK1_stress_fcn = PK1_stress_fcn_data->fcn;
-        void* PK1_stress_fcn_ctx = PK1_stress_fcn_data->ctx;
         libMesh::TensorValue<double> PP;
-        PK1_stress_fcn(PP, FF, X, s, elem, system_var_data, system_grad_var_data, data_time, PK1_stress_fcn_ctx);
+        PK1_stress_fcn_data->evaluate(PP, FF, X, s, elem, system_var_data, system_grad_var_data, data_time);
         sigma = PP * FF.transpose() / FF.det();
         return;
     } // cauchy_stress_from_PK1_stress_fcn
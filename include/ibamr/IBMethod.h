@@ -50,6 +50,7 @@
 #include "ibamr/IBMethodPostProcessStrategy.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -529,6 +530,9 @@ protected:
     std::string d_interp_kernel_fcn, d_spread_kernel_fcn;
     bool d_error_if_points_leave_domain;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
+    IBTK::LNodeOrderingType d_node_ordering;
+    bool d_permute_lag_data;
+    bool d_incremental_redistribution;
 
     /*
      * Lagrangian variables.
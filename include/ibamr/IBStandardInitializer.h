@@ -421,6 +421,49 @@ namespace IBAMR
  D2_x_2   D2_y_2   D2_z_2  # coordinates of director D2 associated with vertex 2
  ...
  \endverbatim
+ *
+ * <HR>
+ *
+ * <B>Binary structure file format</B>
+ *
+ * When the input database entry <TT>use_binary_structure_files</TT> is set to
+ * \a TRUE, the vertex, spring, beam, and target point data for a structure are
+ * read from a memory-mapped binary file with the extension
+ * <TT>".structure"</TT>, if one exists.  Data that are not provided by the
+ * binary file are read from the corresponding ASCII files.  Binary structure
+ * files are generated from ASCII input files by the script
+ * <TT>src/tools/convert_structure_files.pl</TT>.
+ *
+ * All values are stored in little-endian byte order.  The file begins with a
+ * 24-byte header:
+ \verbatim
+ char[8]   magic number "IBSTRUCT"
+ uint32    format version (currently 1)
+ uint32    spatial dimension NDIM
+ uint32    number of sections S
+ uint32    reserved
+ \endverbatim
+ * which is followed by a table of S 32-byte section entries:
+ \verbatim
+ uint32    section type (1 = vertex, 2 = spring, 3 = beam, 4 = target point)
+ uint32    reserved
+ uint64    number of records N in the section
+ uint64    offset of the section data from the beginning of the file
+ uint64    size of the section data in bytes
+ \endverbatim
+ * The data of each section consists of a sequence of arrays, each of which
+ * begins at an offset that is a multiple of 8 bytes:
+ \verbatim
+ vertex:        float64 X[N][NDIM]
+ spring:        int32 idx[N][2], int32 fcn_idx[N], float64 kappa_length[N][2],
+                uint64 param_offset[N+1], float64 params[param_offset[N]]
+ beam:          int32 idx[N][3] (previous, current, next), float64 bend[N],
+                float64 curvature[N][NDIM]
+ target point:  int32 idx[N], float64 kappa_eta[N][2]
+ \endverbatim
+ * The entries have the same meaning as the corresponding entries of the ASCII
+ * input files.  The additional force function parameters of spring k are
+ * params[param_offset[k]], ..., params[param_offset[k+1]-1].
 */
 class IBStandardInitializer : public IBTK::LInitStrategy
 {
@@ -551,6 +594,11 @@ public:
 
 protected:
 private:
+    /*!
+     * \brief A read-only memory map of a binary structure file.
+     */
+    class BinaryStructureFile;
+
     /*!
      * \brief Default constructor.
      *
@@ -606,6 +654,121 @@ private:
      */
     void readBeamFiles(const std::string& file_extension, bool input_uses_global_idxs);
 
+    /*!
+     * \brief Parse the vertex data from the specified input file in parallel.
+     *
+     * The file is split into contiguous byte ranges that are read and parsed
+     * in parallel, and each parsed vertex position is sent to the MPI process
+     * that initially stores it.  No process stores all of the vertex data.
+     */
+    void parseVertexFileInParallel(const std::string& vertex_filename, int ln, unsigned int j);
+
+    /*!
+     * \brief Parse the spring data from the specified input file in parallel.
+     *
+     * Each spring is sent to the MPI process that initially stores the vertex
+     * with which it is associated.
+     */
+    void parseSpringFileInParallel(const std::string& spring_filename,
+                                   int ln,
+                                   unsigned int j,
+                                   int max_idx,
+                                   bool input_uses_global_idxs);
+
+    /*!
+     * \brief Parse the beam data from the specified input file in parallel.
+     *
+     * Each beam is sent to the MPI process that initially stores the vertex
+     * with which it is associated.
+     */
+    void parseBeamFileInParallel(const std::string& beam_filename,
+                                 int ln,
+                                 unsigned int j,
+                                 int max_idx,
+                                 bool input_uses_global_idxs);
+
+    /*!
+     * \brief Set up the data for a spring read from the specified input file.
+     */
+    void addSpringSpecData(int ln,
+                           unsigned int j,
+                           std::pair<int, int> e,
+                           std::vector<double>& parameters,
+                           int force_fcn_idx,
+                           const std::string& spring_filename,
+                           bool input_uses_global_idxs,
+                           bool& warned);
+
+    /*!
+     * \brief Set up the data for a beam read from the specified input file.
+     */
+    void addBeamSpecData(int ln,
+                         unsigned int j,
+                         int prev_idx,
+                         int curr_idx,
+                         int next_idx,
+                         double bend,
+                         IBTK::Vector curv,
+                         const std::string& beam_filename,
+                         bool input_uses_global_idxs,
+                         bool& warned);
+
+    /*!
+     * \brief Discard the vertex, spring, and beam data that are not initially
+     * stored by this MPI process.
+     */
+    void distributeStructureData();
+
+    /*!
+     * \brief Send the vertex, spring, and beam data stored by this MPI process
+     * to the processes that own the patches of the specified level in which the
+     * vertices are located.
+     *
+     * \note This method must be called on all MPI processes.
+     */
+    void redistributeStructureData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                   int level_number);
+
+    /*!
+     * \brief Map the binary structure files, if any, so that each file is
+     * mapped only once while the structure data are read.
+     */
+    void openBinaryStructureFiles();
+
+    /*!
+     * \brief Release the mapped binary structure files.
+     */
+    void closeBinaryStructureFiles();
+
+    /*!
+     * \brief Read the vertex data from the binary structure file, if any.
+     *
+     * \return Whether the vertex data were read from the binary structure file.
+     */
+    bool readBinaryVertexData(int ln, unsigned int j);
+
+    /*!
+     * \brief Read the spring data from the binary structure file, if any.
+     *
+     * \return Whether the spring data were read from the binary structure file.
+     */
+    bool readBinarySpringData(int ln, unsigned int j, int max_idx, bool input_uses_global_idxs);
+
+    /*!
+     * \brief Read the beam data from the binary structure file, if any.
+     *
+     * \return Whether the beam data were read from the binary structure file.
+     */
+    bool readBinaryBeamData(int ln, unsigned int j, int max_idx, bool input_uses_global_idxs);
+
+    /*!
+     * \brief Read the target point data from the binary structure file, if any.
+     *
+     * \return Whether the target point data were read from the binary
+     * structure file.
+     */
+    bool readBinaryTargetPointData(int ln, unsigned int j, int max_idx);
+
     /*!
      * \brief Read the rod data from one or more input files.
      */
@@ -746,6 +909,30 @@ private:
      */
     bool d_use_file_batons;
 
+    /*
+     * The boolean value determines whether the vertex, spring, and beam input
+     * files are parsed in parallel, with each MPI process reading and parsing a
+     * contiguous portion of each file.  The vertex, spring, and beam data are
+     * then distributed among the MPI processes rather than stored on every
+     * process.  When each level is initialized, the data of each vertex are
+     * sent to the process that owns the patch containing the vertex, so that
+     * each process stores only the data of its own vertices and of vertices
+     * outside the patches of the level.  The remaining structure data (e.g.,
+     * target points and anchor points) are still stored on every process.  File
+     * read batons are not used for these files when they are parsed in
+     * parallel.
+     */
+    bool d_use_parallel_file_parser;
+
+    /*
+     * The boolean value determines whether structure data are read from
+     * memory-mapped binary structure files when such files are available.
+     * The binary structure file of each structure, if any, is mapped once
+     * while the structure data are read.
+     */
+    bool d_use_binary_structure_files;
+    std::vector<std::vector<BinaryStructureFile*> > d_binary_structure_files;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
@@ -786,6 +973,12 @@ private:
     std::vector<std::vector<int> > d_num_vertex, d_vertex_offset;
     std::vector<std::vector<std::vector<IBTK::Point> > > d_vertex_posn;
 
+    /*
+     * The positions of the vertices stored on this MPI process, indexed by
+     * vertex number, when the vertex data are distributed among the processes.
+     */
+    std::vector<std::vector<std::map<int, IBTK::Point> > > d_local_vertex_posn;
+
     /*
      * Edge data structures.
      */
@@ -181,6 +181,13 @@ private:
      * Weighting data.
      */
     double d_std;
+
+    /*!
+     * Seed for the counter-based random number generator.  If negative, the
+     * global seed provided to RNG::parallel_seed() is used.
+     */
+    int d_seed;
+
     int d_num_rand_vals;
     std::vector<SAMRAI::tbox::Array<double> > d_weights;
 
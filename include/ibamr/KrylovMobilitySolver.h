@@ -71,6 +71,15 @@ namespace IBAMR
  * operator, \f$ L \f$ is the Stokes operator, and \f$ S \f$ is the spreading
  * operator.
  *
+ * If the input database sets <code>use_rpy_operator = TRUE</code>, \f$ J L^{-1}
+ * S \f$ is instead approximated by the Rotne-Prager-Yamakawa mobility of the
+ * markers, which is applied matrix-free by a hierarchical method
+ * (\see IBAMR::MobilityFunctions::applyRPYMobility()).  No fluid solves are
+ * needed in this case, which makes the solver a cheap approximate inverse of
+ * the mobility for use in the preconditioner of the saddle point system.  The
+ * accuracy of the approximation is set by <code>rpy_opening_angle</code>
+ * (default 0.5; 0 evaluates the RPY mobility exactly), and a periodic
+ * correction may be specified by <code>f_periodic_correction</code>.
  */
 class KrylovMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -350,6 +359,10 @@ private:
 
     // Scaling parameters and force normalization of the problem.
     double d_scale_interp, d_scale_spread, d_reg_mob_factor, d_normalize_spread_force;
+
+    // Settings of the matrix-free RPY approximation of the mobility operator.
+    bool d_use_rpy_operator;
+    double d_rpy_opening_angle, d_f_periodic_corr;
 };
 } // namespace IBAMR
 
@@ -114,6 +114,60 @@ public:
                                            const int num_nodes,
                                            const double periodic_correction,
                                            double* mm);
+
+    /*!
+     * \brief Apply the Rotne-Prager-Yamakawa mobility to a force vector
+     * without forming the mobility matrix.
+     *
+     * The markers are sorted into a hierarchical cluster tree.  The velocity
+     * induced by a cluster that is well separated from the target marker is
+     * approximated by the RPY tensor applied to the net force of the cluster
+     * plus the Oseen-gradient contribution of its force dipole; all other
+     * interactions are summed directly.  The cost is O(N log N) for a fixed
+     * opening angle.
+     *
+     * \param kernel_name IB kernel function.
+     * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param dx Cartesian grid spacing.
+     *
+     * \param X Array of IB markers' location.
+     *
+     * \param F Array of IB markers' force.
+     *
+     * \param num_nodes Number of Lagrangian markers.
+     *
+     * \param periodic_correction Input parameter for incorporating
+     * periodic domain correction. Set it to zero if not known.
+     *
+     * \param opening_angle Ratio of the cluster radius to the distance
+     * between the target marker and the cluster centroid below which the
+     * cluster is approximated.  The error decreases as the square of the
+     * opening angle.  A zero opening angle yields the same result as the
+     * product with the matrix generated by constructRPYMobilityMatrix().
+     *
+     * \param target_begin Index of the first marker at which the velocity is
+     * computed.
+     *
+     * \param target_end One past the index of the last marker at which the
+     * velocity is computed.
+     *
+     * \param U Array of size (target_end-target_begin)*NDIM that contains
+     * the velocity of the target markers on return.
+     */
+    static void applyRPYMobility(const char* kernel_name,
+                                 const double mu,
+                                 const double dx,
+                                 const double* X,
+                                 const double* F,
+                                 const int num_nodes,
+                                 const double periodic_correction,
+                                 const double opening_angle,
+                                 const int target_begin,
+                                 const int target_end,
+                                 double* U);
 }; // MobilityFunctions
 
 } // namespace IBAMR
@@ -35,6 +35,10 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <vector>
+
+#include "Box.h"
+#include "IntVector.h"
 #include "tbox/Array.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
@@ -57,6 +61,15 @@ public:
     // parameters are passed in the double* params.
     typedef void (*NonBddForceFcnPtr)(double* D, const SAMRAI::tbox::Array<double> params, double* out_force);
 
+    // Batched Nonbonded Force Function Pointer.
+    // Takes num_pairs vectors between pairs of points, stored contiguously
+    // in D (NDIM values per pair), and sets the corresponding forces in
+    // out_force (NDIM values per pair).
+    typedef void (*NonBddBatchForceFcnPtr)(const double* D,
+                                           int num_pairs,
+                                           const SAMRAI::tbox::Array<double>& params,
+                                           double* out_force);
+
     // Class constructor.
     NonbondedForceEvaluator(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
                             SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry);
@@ -80,6 +93,10 @@ public:
     // Register the force function used
     void registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr);
 
+    // Register a batched force function.  If registered, it is used instead
+    // of the per-pair force function.
+    void registerBatchForceFcnPtr(NonBddBatchForceFcnPtr batch_force_fcn_ptr);
+
 private:
     // Default constructor, not implemented.
     NonbondedForceEvaluator();
@@ -90,6 +107,61 @@ private:
     // Assignment operator, not implemented.
     NonbondedForceEvaluator& operator=(const NonbondedForceEvaluator& that);
 
+    // Cell list for a single patch: the local PETSc and Lagrangian indices of
+    // the nodes in each cell of the patch box grown by the search width,
+    // stored in compressed row format, along with the periodic shift of each
+    // cell.
+    struct CellList
+    {
+        SAMRAI::hier::Box<NDIM> box;
+        std::vector<int> cell_start;
+        std::vector<int> petsc_idxs;
+        std::vector<int> lag_idxs;
+        std::vector<double> periodic_shifts;
+    };
+
+    // Pairs of interacting nodes: the local PETSc indices of the two nodes
+    // and the periodic shift of the second node.  When Verlet lists are
+    // used, the node positions at the time the list was built are also
+    // stored.
+    struct PairList
+    {
+        PairList() : valid(false)
+        {
+        }
+
+        std::vector<int> mstr_petsc_idxs;
+        std::vector<int> search_petsc_idxs;
+        std::vector<double> shifts;
+        std::vector<int> cell_start;
+        std::vector<int> petsc_idxs;
+        std::vector<double> X0;
+        bool valid;
+    };
+
+    // Build the cell list for a patch.
+    void buildCellList(CellList& cell_list,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& domain_box,
+                       int lag_node_idx_current_idx,
+                       const SAMRAI::hier::IntVector<NDIM>& grow_amount);
+
+    // Build the list of interacting pairs from a cell list using a half-shell
+    // traversal.  When cutoff is positive, only pairs separated by less than
+    // cutoff are retained.
+    void buildPairList(PairList& pair_list,
+                       const CellList& cell_list,
+                       const SAMRAI::hier::Box<NDIM>& patch_box,
+                       const SAMRAI::hier::IntVector<NDIM>& grow_amount,
+                       const double* X,
+                       double cutoff);
+
+    // Determine whether a Verlet list may be reused.
+    bool verletListIsValid(const PairList& pair_list, const CellList& cell_list, const double* X) const;
+
+    // Evaluate and accumulate the forces for the pairs in the list.
+    void evaluatePairForces(const PairList& pair_list, const double* X, double* F);
+
     // type of force to use:
     int d_force_type;
 
@@ -108,6 +180,20 @@ private:
     // spring force function pointer, to evaluate the force between particles:
     // TODO: Add species, make this a map from species1 x species2 -> Force Function Pointer
     NonBddForceFcnPtr d_force_fcn_ptr;
+    NonBddBatchForceFcnPtr d_batch_force_fcn_ptr;
+
+    // Verlet list settings: the distance beyond which the force vanishes and
+    // the skin distance added to it when building the lists.
+    bool d_use_verlet_lists;
+    double d_cutoff_distance, d_verlet_skin;
+
+    // cell lists and pair lists, indexed by level number and local patch
+    // number:
+    std::vector<std::vector<CellList> > d_cell_lists;
+    std::vector<std::vector<PairList> > d_pair_lists;
+
+    // scratch space for batched force evaluation:
+    std::vector<double> d_D_batch, d_F_batch;
 };
 } // namespace IBAMR
 
@@ -1,11 +1,33 @@
 #ifndef included_IBAMR_RNG
 #define included_IBAMR_RNG
 
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Box;
+} // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class ArrayData;
+} // namespace pdat
+} // namespace SAMRAI
+
 namespace IBAMR
 {
 /*!
  * \brief Class RNG organizes functions that provide random-number generator
  * functionality.
+ *
+ * In addition to a (stateful) Mersenne Twister generator, class RNG provides a
+ * stateless counter-based generator (Philox-4x32-10) that computes random
+ * numbers directly from a key and a counter.  Because the values generated for
+ * each grid index do not depend on the order in which they are generated, they
+ * are independent of the parallel decomposition and patch layout, may be
+ * generated concurrently by multiple threads, and are reproduced exactly after
+ * a restart without storing any generator state.
  */
 class RNG
 {
@@ -18,6 +40,38 @@ public:
 
     static void parallel_seed(int global_seed);
 
+    /*!
+     * \brief Return the global seed most recently provided to parallel_seed(),
+     * which is the same on all MPI processes.
+     */
+    static unsigned int global_seed();
+
+    /*!
+     * \brief Fill the specified box of the array data with standard normal
+     * random numbers generated by a counter-based generator.
+     *
+     * The value at index \a i and depth \a d is determined solely by \a seed,
+     * \a step, \a stream, \a i, and \a d.  Distinct fields (e.g., different
+     * variables, data centerings, or patch levels) must use distinct \a stream
+     * values, which must be less than 2^24.
+     */
+    static void genrandn(SAMRAI::pdat::ArrayData<NDIM, double>& data,
+                         const SAMRAI::hier::Box<NDIM>& box,
+                         unsigned int seed,
+                         unsigned int step,
+                         unsigned int stream);
+
+    /*!
+     * \brief Return the stream value to pass to genrandn() for the specified
+     * random value index \a k, patch level number, and field.
+     *
+     * The stream value packs \a k into bits 16-23, \a level_num into bits
+     * 8-15, and \a field into bits 0-7, so that each argument must be in the
+     * range [0,255].  An unrecoverable error occurs if any argument is out of
+     * range.
+     */
+    static unsigned int stream_id(int k, int level_num, int field);
+
 private:
     RNG();
     RNG(RNG&);
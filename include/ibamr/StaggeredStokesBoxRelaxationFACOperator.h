@@ -39,6 +39,7 @@
 #include <string>
 #include <vector>
 
+#include "ibamr/StaggeredStokesFACPreconditioner.h"
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
 #include "petscksp.h"
 #include "petscmat.h"
@@ -77,6 +78,21 @@ namespace IBAMR
  * \brief Class StaggeredStokesBoxRelaxationFACOperator is a concrete
  * StaggeredStokesFACPreconditionerStrategy implementing a box relaxation
  * (Vanka-type) smoother for use as a multigrid preconditioner.
+ *
+ * Each Cartesian grid cell is relaxed by solving the local
+ * (2*NDIM+1)x(2*NDIM+1) Stokes problem for the normal velocities on the faces
+ * of the cell and the pressure in the cell.  Because the problem coefficients
+ * are constant, the local operator is the same for every cell of a patch level;
+ * by default (box_solver_type = "NATIVE"), it is inverted once per level and
+ * applied by an inlined dense matrix-vector product.  Setting box_solver_type
+ * to "PETSC" instead solves each local problem with a PETSc KSP object.
+ *
+ * The cells of a patch are visited in lexicographic order by default
+ * (box_ordering = "LEXICOGRAPHIC").  With box_ordering = "MULTICOLOR", the
+ * cells are partitioned into 3^NDIM colors such that cells of the same color
+ * do not read or write each other's unknowns.  The cells of each color are
+ * then relaxed concurrently when OpenMP is enabled, and the result does not
+ * depend on the number of threads.
 */
 class StaggeredStokesBoxRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -93,6 +109,21 @@ public:
      */
     ~StaggeredStokesBoxRelaxationFACOperator();
 
+    /*!
+     * \brief Static function to construct a StaggeredStokesFACPreconditioner with a
+     * StaggeredStokesBoxRelaxationFACOperator FAC strategy.
+     */
+    static SAMRAI::tbox::Pointer<StaggeredStokesSolver>
+    allocate_solver(const std::string& object_name,
+                    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                    const std::string& default_options_prefix)
+    {
+        SAMRAI::tbox::Pointer<StaggeredStokesFACPreconditionerStrategy> fac_operator =
+            new StaggeredStokesBoxRelaxationFACOperator(
+                object_name + "::StaggeredStokesBoxRelaxationFACOperator", input_db, default_options_prefix);
+        return new StaggeredStokesFACPreconditioner(object_name, fac_operator, input_db, default_options_prefix);
+    } // allocate_solver
+
     /*!
      * \name Implementation of FACPreconditionerStrategy interface.
      */
@@ -163,6 +194,16 @@ private:
      */
     StaggeredStokesBoxRelaxationFACOperator& operator=(const StaggeredStokesBoxRelaxationFACOperator& that);
 
+    /*
+     * The local solver and the ordering in which the cells are relaxed.
+     */
+    std::string d_box_solver_type, d_box_ordering;
+
+    /*
+     * Inverses of the box operators, stored in row-major order.
+     */
+    std::vector<std::vector<double> > d_box_op_inv;
+
     /*
      * Box operator data.
      */
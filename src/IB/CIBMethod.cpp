@@ -1464,6 +1464,73 @@ CIBMethod::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBMethod::applyRPYMobility(Vec V,
+                            Vec L,
+                            const double* grid_dx,
+                            double mu,
+                            double f_periodic_corr,
+                            double opening_angle,
+                            const double scale)
+{
+    const int struct_ln = getStructuresLevelNumber();
+    const char* ib_kernel = d_l_data_manager->getDefaultInterpKernelFunction().c_str();
+
+    std::vector<Pointer<LData> >* X_half_data;
+    bool* X_half_needs_ghost_fill;
+    getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+    Vec X = (*X_half_data)[struct_ln]->getVec();
+
+    // Every process needs the positions and forces of all of the markers, but
+    // computes the velocity of only the markers that it owns.
+    PetscInt size, V_lo, V_hi;
+    VecGetSize(L, &size);
+    VecGetOwnershipRange(V, &V_lo, &V_hi);
+#if !defined(NDEBUG)
+    PetscInt X_size, V_size;
+    VecGetSize(X, &X_size);
+    VecGetSize(V, &V_size);
+    TBOX_ASSERT(X_size == size);
+    TBOX_ASSERT(V_size == size);
+    TBOX_ASSERT(V_lo % NDIM == 0 && V_hi % NDIM == 0);
+#endif
+    Vec X_all, L_all;
+    VecScatter ctx;
+    VecScatterCreateToAll(X, &ctx, &X_all);
+    VecDuplicate(X_all, &L_all);
+    VecScatterBegin(ctx, X, X_all, INSERT_VALUES, SCATTER_FORWARD);
+    VecScatterEnd(ctx, X, X_all, INSERT_VALUES, SCATTER_FORWARD);
+    VecScatterBegin(ctx, L, L_all, INSERT_VALUES, SCATTER_FORWARD);
+    VecScatterEnd(ctx, L, L_all, INSERT_VALUES, SCATTER_FORWARD);
+
+    const double *X_all_array, *L_all_array;
+    double* V_array;
+    VecGetArrayRead(X_all, &X_all_array);
+    VecGetArrayRead(L_all, &L_all_array);
+    VecGetArray(V, &V_array);
+    MobilityFunctions::applyRPYMobility(ib_kernel,
+                                        mu,
+                                        grid_dx[0],
+                                        X_all_array,
+                                        L_all_array,
+                                        size / NDIM,
+                                        f_periodic_corr,
+                                        opening_angle,
+                                        V_lo / NDIM,
+                                        V_hi / NDIM,
+                                        V_array);
+    VecRestoreArray(V, &V_array);
+    VecRestoreArrayRead(L_all, &L_all_array);
+    VecRestoreArrayRead(X_all, &X_all_array);
+    VecScale(V, scale);
+
+    VecScatterDestroy(&ctx);
+    VecDestroy(&X_all);
+    VecDestroy(&L_all);
+
+    return;
+} // applyRPYMobility
+
 void
 CIBMethod::constructGeometricMatrix(const std::string& /*mat_name*/,
                                     Mat& geometric_mat,
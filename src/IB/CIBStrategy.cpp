@@ -820,6 +820,21 @@ CIBStrategy::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBStrategy::applyRPYMobility(Vec /*V*/,
+                              Vec /*L*/,
+                              const double* /*grid_dx*/,
+                              double /*mu*/,
+                              double /*f_periodic_corr*/,
+                              double /*opening_angle*/,
+                              const double /*scale*/)
+{
+    TBOX_ERROR("CIBStrategy::applyRPYMobility(): Matrix-free RPY mobility is not implemented by this class."
+               << std::endl);
+
+    return;
+} // applyRPYMobility
+
 void
 CIBStrategy::constructGeometricMatrix(const std::string& /*mat_name*/,
                                       Mat& /*geometric_mat*/,
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <algorithm>
+#include <functional>
 #include <math.h>
 
 #include "CartesianGridGeometry.h"
@@ -99,6 +100,46 @@ void dsyevr_(const char* jobz,
              int* iwork,
              const int& liwork,
              int& info);
+
+// BLAS function to compute a matrix-matrix product.
+void dgemm_(const char* transa,
+            const char* transb,
+            const int& m,
+            const int& n,
+            const int& k,
+            const double& alpha,
+            const double* a,
+            const int& lda,
+            const double* b,
+            const int& ldb,
+            const double& beta,
+            double* c,
+            const int& ldc);
+
+// BLAS function to solve a triangular system with multiple right-hand sides.
+void dtrsm_(const char* side,
+            const char* uplo,
+            const char* transa,
+            const char* diag,
+            const int& m,
+            const int& n,
+            const double& alpha,
+            const double* a,
+            const int& lda,
+            double* b,
+            const int& ldb);
+
+// BLAS function to compute a symmetric rank-k update.
+void dsyrk_(const char* uplo,
+            const char* trans,
+            const int& n,
+            const int& k,
+            const double& alpha,
+            const double* a,
+            const int& lda,
+            const double& beta,
+            double* c,
+            const int& ldc);
 }
 
 namespace IBAMR
@@ -128,6 +169,11 @@ DirectMobilitySolver::DirectMobilitySolver(const std::string& object_name,
     d_is_initialized = false;
     d_recompute_mob_mat = false;
     d_f_periodic_corr = 0.0;
+    d_mats_allocated = false;
+    d_distribute_factorization = false;
+    d_factorization_block_size = 64;
+    d_factorization_comm = MPI_COMM_NULL;
+    d_incremental_factorization = false;
 
     // Get from input
     if (input_db) getFromInput(input_db);
@@ -183,6 +229,8 @@ DirectMobilitySolver::~DirectMobilitySolver()
         delete[](it->second).second;
     }
 
+    if (d_factorization_comm != MPI_COMM_NULL) MPI_Comm_free(&d_factorization_comm);
+
     d_is_initialized = false;
 
     return;
@@ -228,6 +276,13 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     TBOX_ASSERT(inv_type.first != UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE);
     TBOX_ASSERT(inv_type.second != UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE);
 #endif
+    if (d_distribute_factorization && managing_proc != 0)
+    {
+        TBOX_ERROR(d_object_name << "::registerMobilityMat():\n"
+                                 << "  managing_proc = " << managing_proc << " was specified for matrix " << mat_name
+                                 << ", but the managing processors are\n"
+                                 << "  chosen by the solver when distribute_factorization = TRUE." << std::endl);
+    }
 
     unsigned int num_nodes = 0;
     for (unsigned k = 0; k < prototype_struct_ids.size(); ++k)
@@ -249,44 +304,7 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     d_ipiv_map[mat_name] = std::make_pair<int*, int*>(NULL, NULL);
     d_petsc_mat_map[mat_name] = std::make_pair<Mat, Mat>(NULL, NULL);
     d_petsc_geometric_mat_map[mat_name] = NULL;
-
-    // Allocate the actual matrices.
-    const int mobility_mat_size = num_nodes * NDIM;
-    const int body_mobility_mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
-    const int rank = SAMRAI_MPI::getRank();
-
-    if (rank == managing_proc)
-    {
-        d_mat_map[mat_name].first = new double[mobility_mat_size * mobility_mat_size];
-        MatCreateSeqDense(PETSC_COMM_SELF,
-                          mobility_mat_size,
-                          mobility_mat_size,
-                          d_mat_map[mat_name].first,
-                          &d_petsc_mat_map[mat_name].first);
-
-        d_mat_map[mat_name].second = new double[body_mobility_mat_size * body_mobility_mat_size];
-        MatCreateSeqDense(PETSC_COMM_SELF,
-                          body_mobility_mat_size,
-                          body_mobility_mat_size,
-                          d_mat_map[mat_name].second,
-                          &d_petsc_mat_map[mat_name].second);
-
-        d_geometric_mat_map[mat_name] = new double[mobility_mat_size * body_mobility_mat_size];
-        MatCreateSeqDense(PETSC_COMM_SELF,
-                          mobility_mat_size,
-                          body_mobility_mat_size,
-                          d_geometric_mat_map[mat_name],
-                          &d_petsc_geometric_mat_map[mat_name]);
-
-        if (d_mat_inv_type_map[mat_name].first == LAPACK_LU)
-        {
-            d_ipiv_map[mat_name].first = new int[mobility_mat_size];
-        }
-        if (d_mat_inv_type_map[mat_name].second == LAPACK_LU)
-        {
-            d_ipiv_map[mat_name].second = new int[body_mobility_mat_size];
-        }
-    }
+    d_mat_num_procs_map[mat_name] = 1;
 
     return;
 } // registerMobilityMat
@@ -379,7 +397,10 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first, rhs);
+            if (rank == managing_proc)
+            {
+                computeSolution(mat, inv_type, d_ipiv_map[mat_name].first, rhs, d_mat_dof_order_map[mat_name]);
+            }
             if (!d_recompute_mob_mat)
             {
                 d_cib_strategy->rotateArray(rhs,
@@ -461,6 +482,9 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
 
     IBAMR_TIMER_START(t_initialize_solver_state);
 
+    // Allocate the dense matrices once all of them have been registered.
+    if (!d_mats_allocated) allocateMobilityMatrices();
+
     int rank = SAMRAI_MPI::getRank();
     unsigned managed_mats = static_cast<unsigned>(d_mat_map.size());
 
@@ -595,10 +619,149 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
     // Other parameters
     d_f_periodic_corr = input_db->getDoubleWithDefault("f_periodic_correction", d_f_periodic_corr);
     d_recompute_mob_mat = input_db->getBoolWithDefault("recompute_mob_mat_perstep", d_recompute_mob_mat);
+    d_distribute_factorization =
+        input_db->getBoolWithDefault("distribute_factorization", d_distribute_factorization);
+    d_factorization_block_size =
+        input_db->getIntegerWithDefault("factorization_block_size", d_factorization_block_size);
+    d_incremental_factorization =
+        input_db->getBoolWithDefault("incremental_factorization", d_incremental_factorization);
+    if (d_factorization_block_size <= 0)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput(): factorization_block_size must be positive." << std::endl);
+    }
 
     return;
 } // getFromInput
 
+void
+DirectMobilitySolver::allocateMobilityMatrices()
+{
+    if (d_distribute_factorization) assignMatricesToProcessors();
+
+    const int rank = SAMRAI_MPI::getRank();
+    for (std::map<std::string, std::pair<double*, double*> >::iterator it = d_mat_map.begin(); it != d_mat_map.end();
+         ++it)
+    {
+        const std::string& mat_name = it->first;
+        const int mobility_mat_size = d_mat_nodes_map[mat_name] * NDIM;
+        const int body_mobility_mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
+        const int managing_proc = d_mat_proc_map[mat_name];
+        if (rank != managing_proc) continue;
+
+        d_mat_map[mat_name].first = new double[mobility_mat_size * mobility_mat_size];
+        MatCreateSeqDense(PETSC_COMM_SELF,
+                          mobility_mat_size,
+                          mobility_mat_size,
+                          d_mat_map[mat_name].first,
+                          &d_petsc_mat_map[mat_name].first);
+
+        d_mat_map[mat_name].second = new double[body_mobility_mat_size * body_mobility_mat_size];
+        MatCreateSeqDense(PETSC_COMM_SELF,
+                          body_mobility_mat_size,
+                          body_mobility_mat_size,
+                          d_mat_map[mat_name].second,
+                          &d_petsc_mat_map[mat_name].second);
+
+        d_geometric_mat_map[mat_name] = new double[mobility_mat_size * body_mobility_mat_size];
+        MatCreateSeqDense(PETSC_COMM_SELF,
+                          mobility_mat_size,
+                          body_mobility_mat_size,
+                          d_geometric_mat_map[mat_name],
+                          &d_petsc_geometric_mat_map[mat_name]);
+
+        if (d_mat_inv_type_map[mat_name].first == LAPACK_LU)
+        {
+            d_ipiv_map[mat_name].first = new int[mobility_mat_size];
+        }
+        if (d_mat_inv_type_map[mat_name].second == LAPACK_LU)
+        {
+            d_ipiv_map[mat_name].second = new int[body_mobility_mat_size];
+        }
+    }
+    d_mats_allocated = true;
+
+    return;
+} // allocateMobilityMatrices
+
+void
+DirectMobilitySolver::assignMatricesToProcessors()
+{
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+
+    // Sort the matrices by the cost of factorizing them, largest first.
+    std::vector<std::pair<double, std::string> > mat_costs;
+    for (std::map<std::string, unsigned int>::iterator it = d_mat_nodes_map.begin(); it != d_mat_nodes_map.end();
+         ++it)
+    {
+        const double mat_size = static_cast<double>(it->second * NDIM);
+        mat_costs.push_back(std::make_pair(mat_size * mat_size * mat_size, it->first));
+    }
+    std::sort(mat_costs.begin(), mat_costs.end(), std::greater<std::pair<double, std::string> >());
+    const int num_mats = static_cast<int>(mat_costs.size());
+
+    int color = MPI_UNDEFINED;
+    if (num_mats >= nodes)
+    {
+        // Give each matrix to the least loaded processor.
+        std::vector<double> load(nodes, 0.0);
+        for (int k = 0; k < num_mats; ++k)
+        {
+            const int proc = static_cast<int>(std::min_element(load.begin(), load.end()) - load.begin());
+            d_mat_proc_map[mat_costs[k].second] = proc;
+            d_mat_num_procs_map[mat_costs[k].second] = 1;
+            load[proc] += mat_costs[k].first;
+        }
+    }
+    else
+    {
+        // Give each matrix one processor, and hand out the remaining
+        // processors one at a time to the matrix with the largest cost per
+        // processor.  Only matrices that are factorized by Cholesky
+        // factorization can make use of more than one processor.
+        std::vector<int> num_procs(num_mats, 1);
+        for (int remaining_procs = nodes - num_mats; remaining_procs > 0; --remaining_procs)
+        {
+            int max_k = -1;
+            double max_cost = 0.0;
+            for (int k = 0; k < num_mats; ++k)
+            {
+                if (d_mat_inv_type_map[mat_costs[k].second].first != LAPACK_CHOLESKY) continue;
+                const double cost = mat_costs[k].first / static_cast<double>(num_procs[k]);
+                if (cost > max_cost)
+                {
+                    max_cost = cost;
+                    max_k = k;
+                }
+            }
+            if (max_k < 0) break;
+            ++num_procs[max_k];
+        }
+
+        int first_proc = 0;
+        for (int k = 0; k < num_mats; ++k)
+        {
+            d_mat_proc_map[mat_costs[k].second] = first_proc;
+            d_mat_num_procs_map[mat_costs[k].second] = num_procs[k];
+            if (num_procs[k] > 1 && rank >= first_proc && rank < first_proc + num_procs[k]) color = k;
+            first_proc += num_procs[k];
+        }
+    }
+
+    // Create the communicators of the groups of processors.
+    if (d_factorization_comm != MPI_COMM_NULL) MPI_Comm_free(&d_factorization_comm);
+    MPI_Comm_split(SAMRAI_MPI::getCommunicator(), color, rank, &d_factorization_comm);
+
+    for (int k = 0; k < num_mats; ++k)
+    {
+        plog << d_object_name << "::assignMatricesToProcessors(): matrix " << mat_costs[k].second
+             << " is managed by processor " << d_mat_proc_map[mat_costs[k].second] << " and factorized by "
+             << d_mat_num_procs_map[mat_costs[k].second] << " processor(s)" << std::endl;
+    }
+
+    return;
+} // assignMatricesToProcessors
+
 void
 DirectMobilitySolver::factorizeMobilityMatrix()
 {
@@ -608,15 +771,44 @@ DirectMobilitySolver::factorizeMobilityMatrix()
          ++it)
     {
         const std::string& mat_name = it->first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+        const int managing_proc = d_mat_proc_map[mat_name];
+        const int num_procs = d_mat_num_procs_map[mat_name];
+        if (rank < managing_proc || rank >= managing_proc + num_procs) continue;
 
         Mat& mat = d_petsc_mat_map[mat_name].first;
         const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
         const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
+        const bool update_factorization =
+            d_incremental_factorization && d_recompute_mob_mat && inv_type == LAPACK_CHOLESKY;
         double* mat_data = NULL;
-        MatDenseGetArray(mat, &mat_data);
-        factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first, mat_name, "Mobility");
-        MatDenseRestoreArray(mat, &mat_data);
+        if (rank == managing_proc) MatDenseGetArray(mat, &mat_data);
+
+        // Determine how much of the previous factorization can be reused.
+        int num_reused_dofs = 0;
+        if (update_factorization && rank == managing_proc)
+        {
+            num_reused_dofs = reorderMobilityMatrix(mat_name, mat_data);
+        }
+        if (num_procs > 1) MPI_Bcast(&num_reused_dofs, 1, MPI_INT, 0, d_factorization_comm);
+
+        if (num_reused_dofs > 0)
+        {
+            if (rank == managing_proc) updateCholeskyFactorization(mat_name, mat_data, num_reused_dofs);
+        }
+        else if (num_procs > 1)
+        {
+            factorizeDistributedCholesky(mat_data, mat_size, mat_name);
+        }
+        else
+        {
+            factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first, mat_name, "Mobility");
+        }
+
+        if (rank == managing_proc)
+        {
+            if (update_factorization) d_prev_factor_map[mat_name].assign(mat_data, mat_data + mat_size * mat_size);
+            MatDenseRestoreArray(mat, &mat_data);
+        }
     }
     return;
 
@@ -652,7 +844,11 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
         {
             double* col_data;
             MatDenseGetArray(product_mat, &col_data);
-            computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first, &col_data[col * row_size]);
+            computeSolution(mobility_mat,
+                            mobility_inv_type,
+                            d_ipiv_map[mat_name].first,
+                            &col_data[col * row_size],
+                            d_mat_dof_order_map[mat_name]);
             MatDenseRestoreArray(product_mat, &col_data);
         }
         MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
@@ -858,7 +1054,294 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
 } // factorizeDenseMatrix
 
 void
-DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs)
+DirectMobilitySolver::factorizeDistributedCholesky(double* mat_data, const int mat_size, const std::string& mat_name)
+{
+    int comm_rank, comm_size;
+    MPI_Comm_rank(d_factorization_comm, &comm_rank);
+    MPI_Comm_size(d_factorization_comm, &comm_size);
+    const int n = mat_size;
+    const int nb = d_factorization_block_size;
+    const int num_blocks = (n + nb - 1) / nb;
+
+    // Block column b (columns b*nb, ..., b*nb+nb-1) is owned by process b %
+    // comm_size, which stores the full height of its columns.  The owned block
+    // columns are stored contiguously in order.
+    std::vector<int> counts(comm_size, 0), displs(comm_size, 0);
+    for (int b = 0; b < num_blocks; ++b)
+    {
+        counts[b % comm_size] += n * std::min(nb, n - b * nb);
+    }
+    for (int p = 1; p < comm_size; ++p) displs[p] = displs[p - 1] + counts[p - 1];
+    std::vector<double> buffer;
+    if (comm_rank == 0)
+    {
+        buffer.resize(n * n);
+        for (int p = 0; p < comm_size; ++p)
+        {
+            int offset = displs[p];
+            for (int b = p; b < num_blocks; b += comm_size)
+            {
+                const int width = std::min(nb, n - b * nb);
+                std::copy(&mat_data[b * nb * n], &mat_data[b * nb * n] + width * n, &buffer[offset]);
+                offset += width * n;
+            }
+        }
+    }
+    std::vector<double> local_data(std::max(counts[comm_rank], 1));
+    MPI_Scatterv(comm_rank == 0 ? &buffer[0] : NULL,
+                 &counts[0],
+                 &displs[0],
+                 MPI_DOUBLE,
+                 &local_data[0],
+                 counts[comm_rank],
+                 MPI_DOUBLE,
+                 0,
+                 d_factorization_comm);
+
+    // Right-looking blocked Cholesky factorization: the owner of each block
+    // column factorizes it and broadcasts it, and every process updates the
+    // trailing block columns that it owns.
+    std::vector<double> panel(n * std::min(nb, n));
+    for (int b = 0; b < num_blocks; ++b)
+    {
+        const int b0 = b * nb;
+        const int width = std::min(nb, n - b0);
+        const int height = n - b0;
+        const int owner = b % comm_size;
+        int err = 0;
+        if (comm_rank == owner)
+        {
+            double* block_data = &local_data[(b / comm_size) * nb * n];
+            dpotrf_((char*)"L", width, &block_data[b0], n, err);
+            if (!err && height > width)
+            {
+                dtrsm_((char*)"R",
+                       (char*)"L",
+                       (char*)"T",
+                       (char*)"N",
+                       height - width,
+                       width,
+                       1.0,
+                       &block_data[b0],
+                       n,
+                       &block_data[b0 + width],
+                       n);
+            }
+            for (int j = 0; j < width; ++j)
+            {
+                std::copy(&block_data[j * n + b0], &block_data[j * n + n], &panel[j * height]);
+            }
+        }
+        MPI_Bcast(&err, 1, MPI_INT, owner, d_factorization_comm);
+        if (err)
+        {
+            TBOX_ERROR("DirectMobilityMatrix::factorizeDistributedCholesky(). Mobility matrix factorization "
+                       << "failed for matrix handle "
+                       << mat_name
+                       << " with error code "
+                       << err + b0
+                       << " using distributed CHOLESKY."
+                       << std::endl);
+        }
+        MPI_Bcast(&panel[0], width * height, MPI_DOUBLE, owner, d_factorization_comm);
+
+        for (int c = b + 1; c < num_blocks; ++c)
+        {
+            if (c % comm_size != comm_rank) continue;
+            const int c0 = c * nb;
+            const int c_width = std::min(nb, n - c0);
+            double* block_data = &local_data[(c / comm_size) * nb * n];
+            dgemm_((char*)"N",
+                   (char*)"T",
+                   n - c0,
+                   c_width,
+                   width,
+                   -1.0,
+                   &panel[c0 - b0],
+                   height,
+                   &panel[c0 - b0],
+                   height,
+                   1.0,
+                   &block_data[c0],
+                   n);
+        }
+    }
+
+    // Collect the factor on the first process.
+    MPI_Gatherv(&local_data[0],
+                counts[comm_rank],
+                MPI_DOUBLE,
+                comm_rank == 0 ? &buffer[0] : NULL,
+                &counts[0],
+                &displs[0],
+                MPI_DOUBLE,
+                0,
+                d_factorization_comm);
+    if (comm_rank == 0)
+    {
+        for (int p = 0; p < comm_size; ++p)
+        {
+            int offset = displs[p];
+            for (int b = p; b < num_blocks; b += comm_size)
+            {
+                const int width = std::min(nb, n - b * nb);
+                std::copy(&buffer[offset], &buffer[offset] + width * n, &mat_data[b * nb * n]);
+                offset += width * n;
+            }
+        }
+    }
+
+    return;
+} // factorizeDistributedCholesky
+
+int
+DirectMobilitySolver::reorderMobilityMatrix(const std::string& mat_name, double* mat_data)
+{
+    const std::vector<unsigned>& struct_ids = d_mat_prototype_id_map[mat_name];
+    const int num_structs = static_cast<int>(struct_ids.size());
+    const int n = d_mat_nodes_map[mat_name] * NDIM;
+    std::vector<int> struct_offset(num_structs + 1, 0);
+    for (int s = 0; s < num_structs; ++s)
+    {
+        struct_offset[s + 1] = struct_offset[s] + d_cib_strategy->getNumberOfNodes(struct_ids[s]) * NDIM;
+    }
+
+    std::vector<double>& prev_mat = d_prev_mat_map[mat_name];
+    std::vector<int>& struct_order = d_mat_struct_order_map[mat_name];
+    const bool have_prev_factorization = static_cast<int>(prev_mat.size()) == n * n;
+
+    // A structure has moved if the block of the matrix that couples it with
+    // itself has changed.  For every other changed block, at least one of
+    // the two coupled structures is marked as moved; the structure with the
+    // most changed blocks is chosen first.
+    std::vector<bool> moved(num_structs, !have_prev_factorization);
+    if (have_prev_factorization)
+    {
+        std::vector<std::vector<bool> > changed(num_structs, std::vector<bool>(num_structs, false));
+        for (int s = 0; s < num_structs; ++s)
+        {
+            for (int t = 0; t <= s; ++t)
+            {
+                bool block_changed = false;
+                for (int j = struct_offset[t]; j < struct_offset[t + 1] && !block_changed; ++j)
+                {
+                    for (int i = struct_offset[s]; i < struct_offset[s + 1] && !block_changed; ++i)
+                    {
+                        block_changed = mat_data[j * n + i] != prev_mat[j * n + i];
+                    }
+                }
+                changed[s][t] = changed[t][s] = block_changed;
+            }
+            if (changed[s][s]) moved[s] = true;
+        }
+        while (true)
+        {
+            int max_s = -1, max_count = 0;
+            for (int s = 0; s < num_structs; ++s)
+            {
+                if (moved[s]) continue;
+                int count = 0;
+                for (int t = 0; t < num_structs; ++t)
+                {
+                    if (changed[s][t] && !moved[t]) ++count;
+                }
+                if (count > max_count)
+                {
+                    max_count = count;
+                    max_s = s;
+                }
+            }
+            if (max_s < 0) break;
+            moved[max_s] = true;
+        }
+    }
+    prev_mat.assign(mat_data, mat_data + n * n);
+
+    // Keep the longest leading sequence of structures that have not moved,
+    // followed by the other structures that have not moved, followed by the
+    // structures that have moved.
+    if (static_cast<int>(struct_order.size()) != num_structs)
+    {
+        struct_order.resize(num_structs);
+        for (int s = 0; s < num_structs; ++s) struct_order[s] = s;
+    }
+    int num_reused_structs = 0;
+    while (num_reused_structs < num_structs && !moved[struct_order[num_reused_structs]]) ++num_reused_structs;
+    std::vector<int> new_struct_order(struct_order.begin(), struct_order.begin() + num_reused_structs);
+    for (int k = num_reused_structs; k < num_structs; ++k)
+    {
+        if (!moved[struct_order[k]]) new_struct_order.push_back(struct_order[k]);
+    }
+    for (int k = num_reused_structs; k < num_structs; ++k)
+    {
+        if (moved[struct_order[k]]) new_struct_order.push_back(struct_order[k]);
+    }
+    struct_order = new_struct_order;
+
+    std::vector<int>& dof_order = d_mat_dof_order_map[mat_name];
+    dof_order.clear();
+    int num_reused_dofs = 0;
+    for (int k = 0; k < num_structs; ++k)
+    {
+        const int s = struct_order[k];
+        for (int i = struct_offset[s]; i < struct_offset[s + 1]; ++i) dof_order.push_back(i);
+        if (k < num_reused_structs) num_reused_dofs = static_cast<int>(dof_order.size());
+    }
+
+    // Reorder the matrix.
+    for (int j = 0; j < n; ++j)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            mat_data[j * n + i] = prev_mat[dof_order[j] * n + dof_order[i]];
+        }
+    }
+
+    return num_reused_dofs;
+} // reorderMobilityMatrix
+
+void
+DirectMobilitySolver::updateCholeskyFactorization(const std::string& mat_name,
+                                                  double* mat_data,
+                                                  const int num_reused_dofs)
+{
+    const int n = d_mat_nodes_map[mat_name] * NDIM;
+    const int k = num_reused_dofs;
+    const int m = n - k;
+    const std::vector<double>& prev_factor = d_prev_factor_map[mat_name];
+
+    // The leading k x k block of the factor is unchanged.
+    for (int j = 0; j < k; ++j)
+    {
+        std::copy(&prev_factor[j * n + j], &prev_factor[j * n + k], &mat_data[j * n + j]);
+    }
+    if (m == 0) return;
+
+    // L21 = A21 inv(L11)^T, A22 := A22 - L21 L21^T, and factorize A22.
+    dtrsm_((char*)"R", (char*)"L", (char*)"T", (char*)"N", m, k, 1.0, mat_data, n, &mat_data[k], n);
+    dsyrk_((char*)"L", (char*)"N", m, k, -1.0, &mat_data[k], n, 1.0, &mat_data[k * n + k], n);
+    int err = 0;
+    dpotrf_((char*)"L", m, &mat_data[k * n + k], n, err);
+    if (err)
+    {
+        TBOX_ERROR("DirectMobilityMatrix::updateCholeskyFactorization(). Mobility matrix factorization "
+                   << "failed for matrix handle "
+                   << mat_name
+                   << " with error code "
+                   << err + k
+                   << " using LAPACK CHOLESKY."
+                   << std::endl);
+    }
+
+    return;
+} // updateCholeskyFactorization
+
+void
+DirectMobilitySolver::computeSolution(Mat& mat,
+                                      const MobilityMatrixInverseType& inv_type,
+                                      int* ipiv,
+                                      double* rhs,
+                                      const std::vector<int>& dof_order)
 {
     // Get pointer to matrix.
     int mat_size;
@@ -866,6 +1349,14 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     MatGetSize(mat, &mat_size, NULL);
     MatDenseGetArray(mat, &mat_data);
 
+    // Reorder the right-hand side to match the factorized matrix.
+    std::vector<double> rhs_unordered;
+    if (!dof_order.empty())
+    {
+        rhs_unordered.assign(rhs, rhs + mat_size);
+        for (int i = 0; i < mat_size; ++i) rhs[i] = rhs_unordered[dof_order[i]];
+    }
+
     int err = 0;
     if (inv_type == LAPACK_CHOLESKY)
     {
@@ -916,6 +1407,12 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
         TBOX_ERROR("DirectMobilitySolver::computeSolution(). Inverse method not supported." << std::endl);
     }
 
+    if (!dof_order.empty())
+    {
+        rhs_unordered.assign(rhs, rhs + mat_size);
+        for (int i = 0; i < mat_size; ++i) rhs[dof_order[i]] = rhs_unordered[i];
+    }
+
     MatDenseRestoreArray(mat, &mat_data);
 
     return;
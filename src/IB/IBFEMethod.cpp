@@ -43,6 +43,10 @@
 #include <utility>
 #include <vector>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "Box.h"
@@ -223,6 +227,59 @@ get_x_and_FF(libMesh::VectorValue<double>& x,
 
 static const Real PENALTY = 1.e10;
 
+// The number of elements per thread whose elemental right-hand-side vectors
+// are computed before they are added to the global right-hand-side vector, and
+// the number of elements that are assigned to a thread at a time.
+static const int ASSEMBLY_BLOCK_SIZE = 256;
+static const int ASSEMBLY_CHUNK_SIZE = 8;
+
+inline int
+get_num_assembly_threads(const int num_assembly_threads)
+{
+#if defined(_OPENMP)
+    if (omp_in_parallel()) return 1;
+    return num_assembly_threads > 0 ? num_assembly_threads : omp_get_max_threads();
+#else
+    NULL_USE(num_assembly_threads);
+    return 1;
+#endif
+}
+
+inline int
+get_assembly_thread_num()
+{
+#if defined(_OPENMP)
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+// Elemental right-hand-side vectors and the corresponding DOF indices.
+struct ElemRHSData
+{
+    DenseVector<double> G_rhs_e[NDIM];
+    std::vector<unsigned int> G_dof_indices[NDIM];
+};
+
+inline void
+add_elem_rhs_data(NumericVector<double>& G_rhs_vec,
+                  const DofMap& G_dof_map,
+                  std::vector<ElemRHSData>& elem_rhs_data,
+                  const int num_elems)
+{
+    for (int e = 0; e < num_elems; ++e)
+    {
+        ElemRHSData& data = elem_rhs_data[e];
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            G_dof_map.constrain_element_vector(data.G_rhs_e[i], data.G_dof_indices[i]);
+            G_rhs_vec.add_vector(data.G_rhs_e[i], data.G_dof_indices[i]);
+        }
+    }
+    return;
+}
+
 void
 assemble_poisson(EquationSystems& es, const std::string& /*system_name*/)
 {
@@ -376,6 +433,19 @@ IBFEMethod::getFEDataManager(const unsigned int part) const
     return d_fe_data_managers[part];
 } // getFEDataManager
 
+void
+IBFEMethod::setNumAssemblyThreads(const int num_assembly_threads)
+{
+    d_num_assembly_threads = num_assembly_threads;
+    return;
+} // setNumAssemblyThreads
+
+int
+IBFEMethod::getNumAssemblyThreads() const
+{
+    return d_num_assembly_threads;
+} // getNumAssemblyThreads
+
 void
 IBFEMethod::registerStressNormalizationPart(unsigned int part)
 {
@@ -423,6 +493,97 @@ IBFEMethod::registerPK1StressFunction(const PK1StressFcnData& data, const unsign
     return;
 } // registerPK1StressFunction
 
+void
+IBFEMethod::registerPK1StressFunction(const PK1StressBatchFcnData& data, const unsigned int part)
+{
+    registerPK1StressFunction(PK1StressFcnData(data), part);
+    return;
+} // registerPK1StressFunction
+
+void
+IBFEMethod::PK1StressFcnData::evaluate(
+    TensorValue<double>& PP,
+    const TensorValue<double>& FF,
+    const libMesh::Point& x,
+    const libMesh::Point& X,
+    Elem* const elem,
+    const std::vector<const std::vector<double>*>& system_var_data,
+    const std::vector<const std::vector<VectorValue<double> >*>& system_grad_var_data,
+    const double data_time) const
+{
+    if (fcn)
+    {
+        fcn(PP, FF, x, X, elem, system_var_data, system_grad_var_data, data_time, ctx);
+        return;
+    }
+    TBOX_ASSERT(batch_fcn);
+    double PP_data[NDIM * NDIM], FF_data[NDIM * NDIM], x_data[NDIM], X_data[NDIM];
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            FF_data[i * NDIM + j] = FF(i, j);
+        }
+        x_data[i] = x(i);
+        X_data[i] = X(i);
+    }
+    const std::vector<std::vector<const std::vector<double>*> > batch_var_data(1, system_var_data);
+    const std::vector<std::vector<const std::vector<VectorValue<double> >*> > batch_grad_var_data(
+        1, system_grad_var_data);
+    batch_fcn(PP_data, FF_data, x_data, X_data, 1, elem, batch_var_data, batch_grad_var_data, data_time, ctx);
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            PP(i, j) = PP_data[i * NDIM + j];
+        }
+    }
+    return;
+} // evaluate
+
+void
+IBFEMethod::PK1StressFcnData::evaluateBatch(
+    double* const PP,
+    const double* const FF,
+    const double* const x,
+    const double* const X,
+    const unsigned int n_qp,
+    Elem* const elem,
+    const std::vector<std::vector<const std::vector<double>*> >& system_var_data,
+    const std::vector<std::vector<const std::vector<VectorValue<double> >*> >& system_grad_var_data,
+    const double data_time) const
+{
+    if (batch_fcn)
+    {
+        batch_fcn(PP, FF, x, X, n_qp, elem, system_var_data, system_grad_var_data, data_time, ctx);
+        return;
+    }
+    TBOX_ASSERT(fcn);
+    TensorValue<double> PP_qp, FF_qp;
+    libMesh::Point x_qp, X_qp;
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                FF_qp(i, j) = FF[(i * NDIM + j) * n_qp + qp];
+            }
+            x_qp(i) = x[i * n_qp + qp];
+            X_qp(i) = X[i * n_qp + qp];
+        }
+        fcn(PP_qp, FF_qp, x_qp, X_qp, elem, system_var_data[qp], system_grad_var_data[qp], data_time, ctx);
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                PP[(i * NDIM + j) * n_qp + qp] = PP_qp(i, j);
+            }
+        }
+    }
+    return;
+} // evaluateBatch
+
 void
 IBFEMethod::registerLagBodyForceFunction(const LagBodyForceFcnData& data, const unsigned int part)
 {
@@ -658,6 +819,10 @@ IBFEMethod::postprocessIntegrateData(double /*current_time*/, double /*new_time*
     d_Phi_systems.clear();
     d_Phi_half_vecs.clear();
 
+    // Report the memory used by the FE data managers.  Scratch patch data are
+    // shared by all of the managers, so it suffices to query one of them.
+    if (d_do_log && d_num_parts > 0) d_fe_data_managers[0]->printMemoryStatistics(plog);
+
     // Reset the current time step interval.
     d_current_time = std::numeric_limits<double>::quiet_NaN();
     d_new_time = std::numeric_limits<double>::quiet_NaN();
@@ -1429,22 +1594,21 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
                 double Phi = 0.0;
                 for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                 {
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (d_PK1_stress_fcn_data[part][k].isSet())
                     {
                         // Compute the value of the first Piola-Kirchhoff stress
                         // tensor at the quadrature point and add the corresponding
                         // traction force to the right-hand-side vector.
                         fe.setInterpolatedDataPointers(
                             PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data[k],
-                                                           PK1_grad_var_data[k],
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
+                        d_PK1_stress_fcn_data[part][k].evaluate(PP,
+                                                                FF,
+                                                                x,
+                                                                X,
+                                                                elem,
+                                                                PK1_var_data[k],
+                                                                PK1_grad_var_data[k],
+                                                                data_time);
                         Phi += n * ((PP * FF_trans) * n) / J;
                     }
                 }
@@ -1529,18 +1693,34 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
     const BoundaryInfo& boundary_info = *mesh.boundary_info;
     const unsigned int dim = mesh.mesh_dimension();
 
-    // Setup global and elemental right-hand-side vectors.
+    // Setup the global right-hand-side vector.
     UniquePtr<NumericVector<double> > G_rhs_vec = G_vec.zero_clone();
-    DenseVector<double> G_rhs_e[NDIM];
+
+    // Collect the local active elements.  The elemental right-hand-side
+    // vectors are computed for blocks of elements, possibly concurrently, and
+    // are then added to the global right-hand-side vector in element order, so
+    // that the result does not depend on the number of threads.
+    std::vector<Elem*> local_elems;
+    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        local_elems.push_back(*el_it);
+    }
+    const int num_local_elems = static_cast<int>(local_elems.size());
+    const int num_threads = get_num_assembly_threads(d_num_assembly_threads);
+    const int elem_block_size = ASSEMBLY_BLOCK_SIZE * num_threads;
+    std::vector<ElemRHSData> elem_rhs_data(std::min(elem_block_size, num_local_elems));
 
     // First handle the stress contributions.  These are handled separately because
     // each stress function may use a different quadrature rule.
     const size_t num_PK1_fcns = d_PK1_stress_fcn_data[part].size();
     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        if (!d_PK1_stress_fcn_data[part][k].isSet()) continue;
 
-        // Extract the FE systems and DOF maps, and setup the FE object.
+        // Extract the FE systems and DOF maps, and setup the FE objects.  Each
+        // thread uses its own FE objects and quadrature rules.
         System& G_system = equation_systems->get_system(FORCE_SYSTEM_NAME);
         const DofMap& G_dof_map = G_system.get_dof_map();
         FEDataManager::SystemDofMapCache& G_dof_map_cache =
@@ -1550,45 +1730,40 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
         {
             TBOX_ASSERT(G_dof_map.variable_type(d) == G_fe_type);
         }
-        std::vector<std::vector<unsigned int> > G_dof_indices(NDIM);
         System& X_system = equation_systems->get_system(COORDS_SYSTEM_NAME);
         std::vector<int> vars(NDIM);
         for (unsigned int d = 0; d < NDIM; ++d) vars[d] = d;
 
-        FEDataInterpolation fe(dim, d_fe_data_managers[part]);
-        UniquePtr<QBase> qrule =
-            QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order);
-        UniquePtr<QBase> qrule_face =
-            QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim - 1, d_PK1_stress_fcn_data[part][k].quad_order);
-        fe.attachQuadratureRule(qrule.get());
-        fe.attachQuadratureRuleFace(qrule_face.get());
-        fe.evalNormalsFace();
-        fe.evalQuadraturePoints();
-        fe.evalQuadraturePointsFace();
-        fe.evalQuadratureWeights();
-        fe.evalQuadratureWeightsFace();
-        fe.registerSystem(G_system, std::vector<int>(), vars); // compute dphi for the force system
-        const size_t X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+        std::vector<Pointer<FEDataInterpolation> > fe_data(num_threads);
+        std::vector<Pointer<QBase> > qrules(num_threads), qrules_face(num_threads);
+        size_t X_sys_idx = 0;
         std::vector<size_t> PK1_fcn_system_idxs;
-        fe.setupInterpolatedSystemDataIndexes(
-            PK1_fcn_system_idxs, d_PK1_stress_fcn_data[part][k].system_data, equation_systems);
-        fe.init(/*use_IB_ghosted_vecs*/ false);
-
-        const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
-        const std::vector<double>& JxW = fe.getQuadratureWeights();
-        const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(G_fe_type);
-
-        const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
-        const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
-        const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
-        const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(G_fe_type);
-
-        const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
-        const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
-            fe.getGradVarInterpolation();
-
-        std::vector<const std::vector<double>*> PK1_var_data;
-        std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
+        for (int thread_num = 0; thread_num < num_threads; ++thread_num)
+        {
+            Pointer<FEDataInterpolation> fe = new FEDataInterpolation(dim, d_fe_data_managers[part]);
+            Pointer<QBase> qrule =
+                QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order)
+                    .release();
+            Pointer<QBase> qrule_face = QBase::build(d_PK1_stress_fcn_data[part][k].quad_type,
+                                                     dim - 1,
+                                                     d_PK1_stress_fcn_data[part][k].quad_order)
+                                            .release();
+            fe->attachQuadratureRule(qrule.getPointer());
+            fe->attachQuadratureRuleFace(qrule_face.getPointer());
+            fe->evalNormalsFace();
+            fe->evalQuadraturePoints();
+            fe->evalQuadraturePointsFace();
+            fe->evalQuadratureWeights();
+            fe->evalQuadratureWeightsFace();
+            fe->registerSystem(G_system, std::vector<int>(), vars); // compute dphi for the force system
+            X_sys_idx = fe->registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+            fe->setupInterpolatedSystemDataIndexes(
+                PK1_fcn_system_idxs, d_PK1_stress_fcn_data[part][k].system_data, equation_systems);
+            fe->init(/*use_IB_ghosted_vecs*/ false);
+            fe_data[thread_num] = fe;
+            qrules[thread_num] = qrule;
+            qrules_face[thread_num] = qrule_face;
+        }
 
         // Loop over the elements to compute the right-hand side vector.  This
         // is computed via
@@ -1597,112 +1772,198 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
         //
         // This right-hand side vector is used to solve for the nodal values of
         // the interior elastic force density.
-        TensorValue<double> PP, FF, FF_inv_trans;
-        VectorValue<double> F, F_qp, n, x;
-        const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+        for (int block_begin = 0; block_begin < num_local_elems; block_begin += elem_block_size)
         {
-            Elem* const elem = *el_it;
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                G_dof_map_cache.dof_indices(elem, G_dof_indices[d], d);
-                G_rhs_e[d].resize(static_cast<int>(G_dof_indices[d].size()));
-            }
-            fe.reinit(elem);
-            fe.collectDataForInterpolation(elem);
-            fe.interpolate(elem);
-            const unsigned int n_qp = qrule->n_points();
-            const size_t n_basis = dphi.size();
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            const int block_size = std::min(elem_block_size, num_local_elems - block_begin);
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(num_threads)
+#endif
             {
-                const libMesh::Point& X = q_point[qp];
-                const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                get_x_and_FF(x, FF, x_data, grad_x_data);
-
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, d_PK1_stress_fcn_data[part][k].ctx);
-                for (unsigned int k = 0; k < n_basis; ++k)
+                const int thread_num = get_assembly_thread_num();
+                FEDataInterpolation& fe = *fe_data[thread_num];
+                const QBase& qrule = *qrules[thread_num];
+                const QBase& qrule_face = *qrules_face[thread_num];
+
+                const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
+                const std::vector<double>& JxW = fe.getQuadratureWeights();
+                const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(G_fe_type);
+
+                const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
+                const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
+                const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
+                const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(G_fe_type);
+
+                const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
+                const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
+                    fe.getGradVarInterpolation();
+
+                std::vector<const std::vector<double>*> PK1_var_data;
+                std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
+                std::vector<std::vector<const std::vector<double>*> > PK1_var_data_qp;
+                std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data_qp;
+                std::vector<double> PP_qp, FF_qp, x_qp, X_qp;
+
+                TensorValue<double> PP, FF, FF_inv_trans;
+                VectorValue<double> F, F_qp, n, x;
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic, ASSEMBLY_CHUNK_SIZE)
+#endif
+                for (int e = 0; e < block_size; ++e)
                 {
-                    F_qp = -PP * dphi[k][qp] * JxW[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
+                    Elem* const elem = local_elems[block_begin + e];
+                    DenseVector<double>* const G_rhs_e = elem_rhs_data[e].G_rhs_e;
+                    std::vector<unsigned int>* const G_dof_indices = elem_rhs_data[e].G_dof_indices;
+                    fe.reinit(elem);
+#if defined(_OPENMP)
+#pragma omp critical(IBFEMethod_collectElemData)
+#endif
                     {
-                        G_rhs_e[i](k) += F_qp(i);
+                        for (unsigned int d = 0; d < NDIM; ++d)
+                        {
+                            G_dof_map_cache.dof_indices(elem, G_dof_indices[d], d);
+                        }
+                        fe.collectDataForInterpolation(elem);
                     }
-                }
-            }
-
-            // Loop over the element boundaries.
-            for (unsigned short int side = 0; side < elem->n_sides(); ++side)
-            {
-                // Skip non-physical boundaries.
-                if (!is_physical_bdry(elem, side, boundary_info, G_dof_map)) continue;
-
-                // Determine if we need to integrate surface forces along this
-                // part of the physical boundary; if not, skip the present side.
-                const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, G_dof_map);
-                const bool integrate_normal_force =
-                    (d_split_normal_force && !at_dirichlet_bdry) || (!d_split_normal_force && at_dirichlet_bdry);
-                const bool integrate_tangential_force = (d_split_tangential_force && !at_dirichlet_bdry) ||
-                                                        (!d_split_tangential_force && at_dirichlet_bdry);
-                if (!integrate_normal_force && !integrate_tangential_force) continue;
-
-                fe.reinit(elem, side);
-                fe.interpolate(elem, side);
-                const unsigned int n_qp = qrule_face->n_points();
-                const size_t n_basis = phi_face.size();
-                for (unsigned int qp = 0; qp < n_qp; ++qp)
-                {
-                    const libMesh::Point& X = q_point_face[qp];
-                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                    get_x_and_FF(x, FF, x_data, grad_x_data);
-                    tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-
-                    F.zero();
-
-                    // Compute the value of the first Piola-Kirchhoff stress
-                    // tensor at the quadrature point and add the corresponding
-                    // traction force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data,
-                                                           PK1_grad_var_data,
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
+                        G_rhs_e[d].resize(static_cast<int>(G_dof_indices[d].size()));
                     }
-
-                    n = (FF_inv_trans * normal_face[qp]).unit();
-
-                    if (!integrate_normal_force)
+                    fe.interpolate(elem);
+                    const unsigned int n_qp = qrule.n_points();
+                    const size_t n_basis = dphi.size();
+
+                    // Gather the deformation gradients and the current and
+                    // reference coordinates at all of the quadrature points of
+                    // the element in structure-of-arrays form and evaluate the
+                    // first Piola-Kirchhoff stress tensor for all of the
+                    // quadrature points at once.
+                    PP_qp.resize(NDIM * NDIM * n_qp);
+                    FF_qp.resize(NDIM * NDIM * n_qp);
+                    x_qp.resize(NDIM * n_qp);
+                    X_qp.resize(NDIM * n_qp);
+                    PK1_var_data_qp.resize(n_qp);
+                    PK1_grad_var_data_qp.resize(n_qp);
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
                     {
-                        F -= (F * n) * n; // remove the normal component.
+                        const libMesh::Point& X = q_point[qp];
+                        const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                        const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                        get_x_and_FF(x, FF, x_data, grad_x_data);
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            for (unsigned int j = 0; j < NDIM; ++j)
+                            {
+                                FF_qp[(i * NDIM + j) * n_qp + qp] = FF(i, j);
+                            }
+                            x_qp[i * n_qp + qp] = x(i);
+                            X_qp[i * n_qp + qp] = X(i);
+                        }
+                        fe.setInterpolatedDataPointers(
+                            PK1_var_data_qp[qp], PK1_grad_var_data_qp[qp], PK1_fcn_system_idxs, elem, qp);
                     }
-
-                    if (!integrate_tangential_force)
+                    d_PK1_stress_fcn_data[part][k].evaluateBatch(&PP_qp[0],
+                                                                 &FF_qp[0],
+                                                                 &x_qp[0],
+                                                                 &X_qp[0],
+                                                                 n_qp,
+                                                                 elem,
+                                                                 PK1_var_data_qp,
+                                                                 PK1_grad_var_data_qp,
+                                                                 data_time);
+
+                    // Add the corresponding forces to the right-hand-side
+                    // vector.
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
                     {
-                        F -= (F - (F * n) * n); // remove the tangential component.
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            for (unsigned int j = 0; j < NDIM; ++j)
+                            {
+                                PP(i, j) = PP_qp[(i * NDIM + j) * n_qp + qp];
+                            }
+                        }
+                        for (unsigned int k = 0; k < n_basis; ++k)
+                        {
+                            F_qp = -PP * dphi[k][qp] * JxW[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                G_rhs_e[i](k) += F_qp(i);
+                            }
+                        }
                     }
 
-                    // Add the boundary forces to the right-hand-side vector.
-                    for (unsigned int k = 0; k < n_basis; ++k)
+                    // Loop over the element boundaries.
+                    for (unsigned short int side = 0; side < elem->n_sides(); ++side)
                     {
-                        F_qp = F * phi_face[k][qp] * JxW_face[qp];
-                        for (unsigned int i = 0; i < NDIM; ++i)
+                        // Skip non-physical boundaries.
+                        if (!is_physical_bdry(elem, side, boundary_info, G_dof_map)) continue;
+
+                        // Determine if we need to integrate surface forces
+                        // along this part of the physical boundary; if not,
+                        // skip the present side.
+                        const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, G_dof_map);
+                        const bool integrate_normal_force = (d_split_normal_force && !at_dirichlet_bdry) ||
+                                                            (!d_split_normal_force && at_dirichlet_bdry);
+                        const bool integrate_tangential_force = (d_split_tangential_force && !at_dirichlet_bdry) ||
+                                                                (!d_split_tangential_force && at_dirichlet_bdry);
+                        if (!integrate_normal_force && !integrate_tangential_force) continue;
+
+                        fe.reinit(elem, side);
+                        fe.interpolate(elem, side);
+                        const unsigned int n_qp = qrule_face.n_points();
+                        const size_t n_basis = phi_face.size();
+                        for (unsigned int qp = 0; qp < n_qp; ++qp)
                         {
-                            G_rhs_e[i](k) += F_qp(i);
+                            const libMesh::Point& X = q_point_face[qp];
+                            const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                            const std::vector<VectorValue<double> >& grad_x_data =
+                                fe_interp_grad_var_data[qp][X_sys_idx];
+                            get_x_and_FF(x, FF, x_data, grad_x_data);
+                            tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+
+                            F.zero();
+
+                            // Compute the value of the first Piola-Kirchhoff
+                            // stress tensor at the quadrature point and add the
+                            // corresponding traction force to the
+                            // right-hand-side vector.
+                            if (d_PK1_stress_fcn_data[part][k].isSet())
+                            {
+                                fe.setInterpolatedDataPointers(
+                                    PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                                d_PK1_stress_fcn_data[part][k].evaluate(PP,
+                                                                        FF,
+                                                                        x,
+                                                                        X,
+                                                                        elem,
+                                                                        PK1_var_data,
+                                                                        PK1_grad_var_data,
+                                                                        data_time);
+                                F += PP * normal_face[qp];
+                            }
+
+                            n = (FF_inv_trans * normal_face[qp]).unit();
+
+                            if (!integrate_normal_force)
+                            {
+                                F -= (F * n) * n; // remove the normal component.
+                            }
+
+                            if (!integrate_tangential_force)
+                            {
+                                F -= (F - (F * n) * n); // remove the tangential component.
+                            }
+
+                            // Add the boundary forces to the right-hand-side
+                            // vector.
+                            for (unsigned int k = 0; k < n_basis; ++k)
+                            {
+                                F_qp = F * phi_face[k][qp] * JxW_face[qp];
+                                for (unsigned int i = 0; i < NDIM; ++i)
+                                {
+                                    G_rhs_e[i](k) += F_qp(i);
+                                }
+                            }
                         }
                     }
                 }
@@ -1710,11 +1971,7 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
 
             // Apply constraints (e.g., enforce periodic boundary conditions)
             // and add the elemental contributions to the global vector.
-            for (unsigned int i = 0; i < NDIM; ++i)
-            {
-                G_dof_map.constrain_element_vector(G_rhs_e[i], G_dof_indices[i]);
-                G_rhs_vec->add_vector(G_rhs_e[i], G_dof_indices[i]);
-            }
+            add_elem_rhs_data(*G_rhs_vec, G_dof_map, elem_rhs_data, block_size);
         }
     }
 
@@ -1729,7 +1986,6 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
     {
         TBOX_ASSERT(G_dof_map.variable_type(d) == G_fe_type);
     }
-    std::vector<std::vector<unsigned int> > G_dof_indices(NDIM);
     System& X_system = equation_systems->get_system(COORDS_SYSTEM_NAME);
     System* Phi_system = Phi_vec ? &equation_systems->get_system(PHI_SYSTEM_NAME) : NULL;
     std::vector<int> vars(NDIM);
@@ -1737,209 +1993,247 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
     std::vector<int> Phi_vars(1, 0);
     std::vector<int> no_vars;
 
-    FEDataInterpolation fe(dim, d_fe_data_managers[part]);
-    UniquePtr<QBase> qrule = QBase::build(d_default_quad_type[part], dim, d_default_quad_order[part]);
-    UniquePtr<QBase> qrule_face = QBase::build(d_default_quad_type[part], dim - 1, d_default_quad_order[part]);
-    fe.attachQuadratureRule(qrule.get());
-    fe.attachQuadratureRuleFace(qrule_face.get());
-    fe.evalNormalsFace();
-    fe.evalQuadraturePoints();
-    fe.evalQuadraturePointsFace();
-    fe.evalQuadratureWeights();
-    fe.evalQuadratureWeightsFace();
-    fe.registerSystem(G_system, vars, vars); // compute phi and dphi for the force system
-    const size_t X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
-    const size_t Phi_sys_idx = Phi_vec ? fe.registerInterpolatedSystem(*Phi_system, Phi_vars, no_vars, Phi_vec) :
-                                         std::numeric_limits<size_t>::max();
+    std::vector<Pointer<FEDataInterpolation> > fe_data(num_threads);
+    std::vector<Pointer<QBase> > qrules(num_threads), qrules_face(num_threads);
+    size_t X_sys_idx = 0;
+    size_t Phi_sys_idx = std::numeric_limits<size_t>::max();
     std::vector<size_t> body_force_fcn_system_idxs;
-    fe.setupInterpolatedSystemDataIndexes(
-        body_force_fcn_system_idxs, d_lag_body_force_fcn_data[part].system_data, equation_systems);
     std::vector<size_t> surface_force_fcn_system_idxs;
-    fe.setupInterpolatedSystemDataIndexes(
-        surface_force_fcn_system_idxs, d_lag_surface_force_fcn_data[part].system_data, equation_systems);
     std::vector<size_t> surface_pressure_fcn_system_idxs;
-    fe.setupInterpolatedSystemDataIndexes(
-        surface_pressure_fcn_system_idxs, d_lag_surface_pressure_fcn_data[part].system_data, equation_systems);
-    fe.init(/*use_IB_ghosted_vecs*/ false);
-
-    const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
-    const std::vector<double>& JxW = fe.getQuadratureWeights();
-    const std::vector<std::vector<double> >& phi = fe.getPhi(G_fe_type);
-    const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(G_fe_type);
-
-    const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
-    const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
-    const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
-    const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(G_fe_type);
-
-    const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
-    const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
-        fe.getGradVarInterpolation();
-
-    std::vector<const std::vector<double> *> body_force_var_data, surface_force_var_data, surface_pressure_var_data;
-    std::vector<const std::vector<VectorValue<double> > *> body_force_grad_var_data, surface_force_grad_var_data,
-        surface_pressure_grad_var_data;
+    for (int thread_num = 0; thread_num < num_threads; ++thread_num)
+    {
+        Pointer<FEDataInterpolation> fe = new FEDataInterpolation(dim, d_fe_data_managers[part]);
+        Pointer<QBase> qrule = QBase::build(d_default_quad_type[part], dim, d_default_quad_order[part]).release();
+        Pointer<QBase> qrule_face =
+            QBase::build(d_default_quad_type[part], dim - 1, d_default_quad_order[part]).release();
+        fe->attachQuadratureRule(qrule.getPointer());
+        fe->attachQuadratureRuleFace(qrule_face.getPointer());
+        fe->evalNormalsFace();
+        fe->evalQuadraturePoints();
+        fe->evalQuadraturePointsFace();
+        fe->evalQuadratureWeights();
+        fe->evalQuadratureWeightsFace();
+        fe->registerSystem(G_system, vars, vars); // compute phi and dphi for the force system
+        X_sys_idx = fe->registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+        if (Phi_vec) Phi_sys_idx = fe->registerInterpolatedSystem(*Phi_system, Phi_vars, no_vars, Phi_vec);
+        fe->setupInterpolatedSystemDataIndexes(
+            body_force_fcn_system_idxs, d_lag_body_force_fcn_data[part].system_data, equation_systems);
+        fe->setupInterpolatedSystemDataIndexes(
+            surface_force_fcn_system_idxs, d_lag_surface_force_fcn_data[part].system_data, equation_systems);
+        fe->setupInterpolatedSystemDataIndexes(
+            surface_pressure_fcn_system_idxs, d_lag_surface_pressure_fcn_data[part].system_data, equation_systems);
+        fe->init(/*use_IB_ghosted_vecs*/ false);
+        fe_data[thread_num] = fe;
+        qrules[thread_num] = qrule;
+        qrules_face[thread_num] = qrule_face;
+    }
 
     // Loop over the elements to compute the right-hand side vector.
-    TensorValue<double> PP, FF, FF_inv_trans;
-    VectorValue<double> F, F_b, F_s, F_qp, n, x;
-    boost::multi_array<double, 2> X_node;
-    boost::multi_array<double, 1> Phi_node;
-    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    for (int block_begin = 0; block_begin < num_local_elems; block_begin += elem_block_size)
     {
-        Elem* const elem = *el_it;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            G_dof_map_cache.dof_indices(elem, G_dof_indices[d], d);
-            G_rhs_e[d].resize(static_cast<int>(G_dof_indices[d].size()));
-        }
-        fe.reinit(elem);
-        fe.collectDataForInterpolation(elem);
-        fe.interpolate(elem);
-        const unsigned int n_qp = qrule->n_points();
-        const size_t n_basis = phi.size();
-        for (unsigned int qp = 0; qp < n_qp; ++qp)
+        const int block_size = std::min(elem_block_size, num_local_elems - block_begin);
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(num_threads)
+#endif
         {
-            const libMesh::Point& X = q_point[qp];
-            const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-            const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-            get_x_and_FF(x, FF, x_data, grad_x_data);
-            const double J = std::abs(FF.det());
-            tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-            const double Phi =
-                Phi_vec ? fe_interp_var_data[qp][Phi_sys_idx][0] : std::numeric_limits<double>::quiet_NaN();
-
-            if (Phi_vec)
+            const int thread_num = get_assembly_thread_num();
+            FEDataInterpolation& fe = *fe_data[thread_num];
+            const QBase& qrule = *qrules[thread_num];
+            const QBase& qrule_face = *qrules_face[thread_num];
+
+            const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
+            const std::vector<double>& JxW = fe.getQuadratureWeights();
+            const std::vector<std::vector<double> >& phi = fe.getPhi(G_fe_type);
+            const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(G_fe_type);
+
+            const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
+            const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
+            const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
+            const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(G_fe_type);
+
+            const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
+            const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
+                fe.getGradVarInterpolation();
+
+            std::vector<const std::vector<double> *> body_force_var_data, surface_force_var_data,
+                surface_pressure_var_data;
+            std::vector<const std::vector<VectorValue<double> > *> body_force_grad_var_data,
+                surface_force_grad_var_data, surface_pressure_grad_var_data;
+
+            TensorValue<double> PP, FF, FF_inv_trans;
+            VectorValue<double> F, F_b, F_s, F_qp, n, x;
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic, ASSEMBLY_CHUNK_SIZE)
+#endif
+            for (int e = 0; e < block_size; ++e)
             {
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                PP = -J * Phi * FF_inv_trans;
-                for (unsigned int k = 0; k < n_basis; ++k)
+                Elem* const elem = local_elems[block_begin + e];
+                DenseVector<double>* const G_rhs_e = elem_rhs_data[e].G_rhs_e;
+                std::vector<unsigned int>* const G_dof_indices = elem_rhs_data[e].G_dof_indices;
+                fe.reinit(elem);
+#if defined(_OPENMP)
+#pragma omp critical(IBFEMethod_collectElemData)
+#endif
                 {
-                    F_qp = -PP * dphi[k][qp] * JxW[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
+                    for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        G_rhs_e[i](k) += F_qp(i);
+                        G_dof_map_cache.dof_indices(elem, G_dof_indices[d], d);
                     }
+                    fe.collectDataForInterpolation(elem);
                 }
-            }
-
-            if (d_lag_body_force_fcn_data[part].fcn)
-            {
-                // Compute the value of the body force at the quadrature
-                // point and add the corresponding forces to the
-                // right-hand-side vector.
-                fe.setInterpolatedDataPointers(
-                    body_force_var_data, body_force_grad_var_data, body_force_fcn_system_idxs, elem, qp);
-                d_lag_body_force_fcn_data[part].fcn(F_b,
-                                                    FF,
-                                                    x,
-                                                    X,
-                                                    elem,
-                                                    body_force_var_data,
-                                                    body_force_grad_var_data,
-                                                    data_time,
-                                                    d_lag_body_force_fcn_data[part].ctx);
-                for (unsigned int k = 0; k < n_basis; ++k)
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    F_qp = F_b * phi[k][qp] * JxW[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        G_rhs_e[i](k) += F_qp(i);
-                    }
+                    G_rhs_e[d].resize(static_cast<int>(G_dof_indices[d].size()));
                 }
-            }
-        }
-
-        // Loop over the element boundaries.
-        for (unsigned short int side = 0; side < elem->n_sides(); ++side)
-        {
-            // Skip non-physical boundaries.
-            if (!is_physical_bdry(elem, side, boundary_info, G_dof_map)) continue;
-
-            // Determine if we need to compute surface forces along this
-            // part of the physical boundary; if not, skip the present side.
-            const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, G_dof_map);
-            const bool integrate_normal_force = !d_split_normal_force && !at_dirichlet_bdry;
-            const bool integrate_tangential_force = !d_split_tangential_force && !at_dirichlet_bdry;
-            if (!integrate_normal_force && !integrate_tangential_force) continue;
-
-            fe.reinit(elem, side);
-            fe.interpolate(elem, side);
-            const unsigned int n_qp = qrule_face->n_points();
-            const size_t n_basis = phi_face.size();
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
-            {
-                const libMesh::Point& X = q_point_face[qp];
-                const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                get_x_and_FF(x, FF, x_data, grad_x_data);
-                const double J = std::abs(FF.det());
-                tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-                n = (FF_inv_trans * normal_face[qp]).unit();
+                fe.interpolate(elem);
+                const unsigned int n_qp = qrule.n_points();
+                const size_t n_basis = phi.size();
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    const libMesh::Point& X = q_point[qp];
+                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                    get_x_and_FF(x, FF, x_data, grad_x_data);
+                    const double J = std::abs(FF.det());
+                    tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                    const double Phi =
+                        Phi_vec ? fe_interp_var_data[qp][Phi_sys_idx][0] : std::numeric_limits<double>::quiet_NaN();
 
-                F.zero();
+                    if (Phi_vec)
+                    {
+                        // Compute the value of the first Piola-Kirchhoff stress
+                        // tensor at the quadrature point and add the
+                        // corresponding forces to the right-hand-side vector.
+                        PP = -J * Phi * FF_inv_trans;
+                        for (unsigned int k = 0; k < n_basis; ++k)
+                        {
+                            F_qp = -PP * dphi[k][qp] * JxW[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                G_rhs_e[i](k) += F_qp(i);
+                            }
+                        }
+                    }
 
-                if (d_lag_surface_pressure_fcn_data[part].fcn)
-                {
-                    // Compute the value of the pressure at the quadrature
-                    // point and add the corresponding force to the
-                    // right-hand-side vector.
-                    double P = 0;
-                    fe.setInterpolatedDataPointers(surface_pressure_var_data,
-                                                   surface_pressure_grad_var_data,
-                                                   surface_pressure_fcn_system_idxs,
-                                                   elem,
-                                                   qp);
-                    d_lag_surface_pressure_fcn_data[part].fcn(P,
-                                                              FF,
-                                                              x,
-                                                              X,
-                                                              elem,
-                                                              side,
-                                                              surface_pressure_var_data,
-                                                              surface_pressure_grad_var_data,
-                                                              data_time,
-                                                              d_lag_surface_pressure_fcn_data[part].ctx);
-                    F -= P * J * FF_inv_trans * normal_face[qp];
+                    if (d_lag_body_force_fcn_data[part].fcn)
+                    {
+                        // Compute the value of the body force at the quadrature
+                        // point and add the corresponding forces to the
+                        // right-hand-side vector.
+                        fe.setInterpolatedDataPointers(
+                            body_force_var_data, body_force_grad_var_data, body_force_fcn_system_idxs, elem, qp);
+                        d_lag_body_force_fcn_data[part].fcn(F_b,
+                                                            FF,
+                                                            x,
+                                                            X,
+                                                            elem,
+                                                            body_force_var_data,
+                                                            body_force_grad_var_data,
+                                                            data_time,
+                                                            d_lag_body_force_fcn_data[part].ctx);
+                        for (unsigned int k = 0; k < n_basis; ++k)
+                        {
+                            F_qp = F_b * phi[k][qp] * JxW[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                G_rhs_e[i](k) += F_qp(i);
+                            }
+                        }
+                    }
                 }
 
-                if (d_lag_surface_force_fcn_data[part].fcn)
+                // Loop over the element boundaries.
+                for (unsigned short int side = 0; side < elem->n_sides(); ++side)
                 {
-                    // Compute the value of the surface force at the
-                    // quadrature point and add the corresponding force to
-                    // the right-hand-side vector.
-                    fe.setInterpolatedDataPointers(
-                        surface_force_var_data, surface_force_grad_var_data, surface_force_fcn_system_idxs, elem, qp);
-                    d_lag_surface_force_fcn_data[part].fcn(F_s,
-                                                           FF,
-                                                           x,
-                                                           X,
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, G_dof_map)) continue;
+
+                    // Determine if we need to compute surface forces along this
+                    // part of the physical boundary; if not, skip the present
+                    // side.
+                    const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, G_dof_map);
+                    const bool integrate_normal_force = !d_split_normal_force && !at_dirichlet_bdry;
+                    const bool integrate_tangential_force = !d_split_tangential_force && !at_dirichlet_bdry;
+                    if (!integrate_normal_force && !integrate_tangential_force) continue;
+
+                    fe.reinit(elem, side);
+                    fe.interpolate(elem, side);
+                    const unsigned int n_qp = qrule_face.n_points();
+                    const size_t n_basis = phi_face.size();
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        const libMesh::Point& X = q_point_face[qp];
+                        const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                        const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                        get_x_and_FF(x, FF, x_data, grad_x_data);
+                        const double J = std::abs(FF.det());
+                        tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                        n = (FF_inv_trans * normal_face[qp]).unit();
+
+                        F.zero();
+
+                        if (d_lag_surface_pressure_fcn_data[part].fcn)
+                        {
+                            // Compute the value of the pressure at the
+                            // quadrature point and add the corresponding force
+                            // to the right-hand-side vector.
+                            double P = 0;
+                            fe.setInterpolatedDataPointers(surface_pressure_var_data,
+                                                           surface_pressure_grad_var_data,
+                                                           surface_pressure_fcn_system_idxs,
                                                            elem,
-                                                           side,
-                                                           surface_force_var_data,
+                                                           qp);
+                            d_lag_surface_pressure_fcn_data[part].fcn(P,
+                                                                      FF,
+                                                                      x,
+                                                                      X,
+                                                                      elem,
+                                                                      side,
+                                                                      surface_pressure_var_data,
+                                                                      surface_pressure_grad_var_data,
+                                                                      data_time,
+                                                                      d_lag_surface_pressure_fcn_data[part].ctx);
+                            F -= P * J * FF_inv_trans * normal_face[qp];
+                        }
+
+                        if (d_lag_surface_force_fcn_data[part].fcn)
+                        {
+                            // Compute the value of the surface force at the
+                            // quadrature point and add the corresponding force
+                            // to the right-hand-side vector.
+                            fe.setInterpolatedDataPointers(surface_force_var_data,
                                                            surface_force_grad_var_data,
-                                                           data_time,
-                                                           d_lag_surface_force_fcn_data[part].ctx);
-                    F += F_s;
-                }
+                                                           surface_force_fcn_system_idxs,
+                                                           elem,
+                                                           qp);
+                            d_lag_surface_force_fcn_data[part].fcn(F_s,
+                                                                   FF,
+                                                                   x,
+                                                                   X,
+                                                                   elem,
+                                                                   side,
+                                                                   surface_force_var_data,
+                                                                   surface_force_grad_var_data,
+                                                                   data_time,
+                                                                   d_lag_surface_force_fcn_data[part].ctx);
+                            F += F_s;
+                        }
 
-                // Remote the normal component of the boundary force when needed.
-                if (!integrate_normal_force) F -= (F * n) * n;
+                        // Remote the normal component of the boundary force when needed.
+                        if (!integrate_normal_force) F -= (F * n) * n;
 
-                // Remote the tangential component of the boundary force when needed.
-                if (!integrate_tangential_force) F -= (F - (F * n) * n);
+                        // Remote the tangential component of the boundary force when needed.
+                        if (!integrate_tangential_force) F -= (F - (F * n) * n);
 
-                // Add the boundary forces to the right-hand-side vector.
-                for (unsigned int k = 0; k < n_basis; ++k)
-                {
-                    F_qp = F * phi_face[k][qp] * JxW_face[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        G_rhs_e[i](k) += F_qp(i);
+                        // Add the boundary forces to the right-hand-side vector.
+                        for (unsigned int k = 0; k < n_basis; ++k)
+                        {
+                            F_qp = F * phi_face[k][qp] * JxW_face[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                G_rhs_e[i](k) += F_qp(i);
+                            }
+                        }
                     }
                 }
             }
@@ -1947,11 +2241,7 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
 
         // Apply constraints (e.g., enforce periodic boundary conditions)
         // and add the elemental contributions to the global vector.
-        for (unsigned int i = 0; i < NDIM; ++i)
-        {
-            G_dof_map.constrain_element_vector(G_rhs_e[i], G_dof_indices[i]);
-            G_rhs_vec->add_vector(G_rhs_e[i], G_dof_indices[i]);
-        }
+        add_elem_rhs_data(*G_rhs_vec, G_dof_map, elem_rhs_data, block_size);
     }
 
     // Solve for G.
@@ -2122,22 +2412,21 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].isSet())
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            d_PK1_stress_fcn_data[part][k].evaluate(PP,
+                                                                    FF,
+                                                                    x,
+                                                                    X,
+                                                                    elem,
+                                                                    PK1_var_data[k],
+                                                                    PK1_grad_var_data[k],
+                                                                    data_time);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -2490,22 +2779,21 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].isSet())
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            d_PK1_stress_fcn_data[part][k].evaluate(PP,
+                                                                    FF,
+                                                                    x,
+                                                                    X,
+                                                                    elem,
+                                                                    PK1_var_data[k],
+                                                                    PK1_grad_var_data[k],
+                                                                    data_time);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -2726,6 +3014,7 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     d_split_tangential_force = false;
     d_use_jump_conditions = false;
     d_use_consistent_mass_matrix = true;
+    d_num_assembly_threads = 1;
     d_do_log = false;
 
     d_fe_family.resize(d_num_parts, INVALID_FE);
@@ -2885,6 +3174,22 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     else if (db->isDouble("IB_point_density"))
         d_default_spread_spec.point_density = db->getDouble("IB_point_density");
 
+    if (db->isString("spread_mode") || db->isString("IB_spread_mode"))
+    {
+        const std::string spread_mode =
+            db->isString("spread_mode") ? db->getString("spread_mode") : db->getString("IB_spread_mode");
+        d_default_spread_spec.spread_mode = IBTK::string_to_enum<SpreadingMode>(spread_mode);
+        if (d_default_spread_spec.spread_mode == UNKNOWN_SPREADING_MODE)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  unknown spreading mode: "
+                                     << spread_mode
+                                     << "\n"
+                                     << "  valid choices are: SERIAL, COLORED, REPLICATED"
+                                     << std::endl);
+        }
+    }
+
     // Force computation settings.
     if (db->isBool("split_normal_force"))
         d_split_normal_force = db->getBool("split_normal_force");
@@ -2897,6 +3202,7 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     if (db->isBool("use_jump_conditions")) d_use_jump_conditions = db->getBool("use_jump_conditions");
     if (db->isBool("use_consistent_mass_matrix"))
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
+    if (db->keyExists("num_assembly_threads")) d_num_assembly_threads = db->getInteger("num_assembly_threads");
 
     // Restart settings.
     if (db->isString("libmesh_restart_file_extension"))
@@ -1224,37 +1224,32 @@ IBHydrodynamicForceEvaluator::fillPatchData(const int u_src_idx,
         if (!level->checkAllocated(d_p_idx) && fill_pressure) level->allocatePatchData(d_p_idx);
     }
 
+    // Velocity and pressure ghost cell values are filled together, so that a
+    // single aggregated message is exchanged with each neighboring processor.
+    typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+    std::vector<InterpolationTransactionComponent> transaction_comps;
+    HierarchyDataOpsManager<NDIM>* hier_data_ops_manager = HierarchyDataOpsManager<NDIM>::getManager();
     if (fill_velocity)
     {
         // Fill velocity data from integrator index.
-        HierarchyDataOpsManager<NDIM>* hier_data_ops_manager = HierarchyDataOpsManager<NDIM>::getManager();
         Pointer<HierarchyDataOpsReal<NDIM, double> > hier_sc_data_ops =
             hier_data_ops_manager->getOperationsDouble(d_u_var, patch_hierarchy, true);
         hier_sc_data_ops->copyData(d_u_idx, u_src_idx, true);
 
-        typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
-        std::vector<InterpolationTransactionComponent> transaction_comp(1);
-        transaction_comp[0] = InterpolationTransactionComponent(d_u_idx,
-                                                                u_src_idx,
-                                                                /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
-                                                                /*USE_CF_INTERPOLATION*/ true,
-                                                                /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
-                                                                /*BDRY_EXTRAP_TYPE*/ "LINEAR",
-                                                                /*CONSISTENT_TYPE_2_BDRY*/ false,
-                                                                u_src_bc_coef,
-                                                                Pointer<VariableFillPattern<NDIM> >(NULL));
-
-        Pointer<HierarchyGhostCellInterpolation> hier_bdry_fill = new HierarchyGhostCellInterpolation();
-        hier_bdry_fill->initializeOperatorState(transaction_comp, patch_hierarchy);
-        hier_bdry_fill->setHomogeneousBc(false);
-        hier_bdry_fill->fillData(fill_time);
+        transaction_comps.push_back(InterpolationTransactionComponent(d_u_idx,
+                                                                      u_src_idx,
+                                                                      /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
+                                                                      /*USE_CF_INTERPOLATION*/ true,
+                                                                      /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
+                                                                      /*BDRY_EXTRAP_TYPE*/ "LINEAR",
+                                                                      /*CONSISTENT_TYPE_2_BDRY*/ false,
+                                                                      u_src_bc_coef,
+                                                                      Pointer<VariableFillPattern<NDIM> >(NULL)));
     }
 
     if (fill_pressure)
     {
-        // Fill pressure data from integrator index
-        HierarchyDataOpsManager<NDIM>* hier_data_ops_manager = HierarchyDataOpsManager<NDIM>::getManager();
-
+        // Fill pressure data from integrator index.
         Pointer<HierarchyDataOpsReal<NDIM, double> > hier_cc_data_ops =
             hier_data_ops_manager->getOperationsDouble(d_p_var, patch_hierarchy, true);
         hier_cc_data_ops->copyData(d_p_idx, p_src_idx, true);
@@ -1265,19 +1260,24 @@ IBHydrodynamicForceEvaluator::fillPatchData(const int u_src_idx,
 #endif
         p_ins_bc_coef->setTargetVelocityPatchDataIndex(d_u_idx);
 
-        typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
-        std::vector<InterpolationTransactionComponent> transaction_comp(1);
-        transaction_comp[0] = InterpolationTransactionComponent(d_p_idx,
-                                                                p_src_idx,
-                                                                /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
-                                                                /*USE_CF_INTERPOLATION*/ true,
-                                                                /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
-                                                                /*BDRY_EXTRAP_TYPE*/ "LINEAR",
-                                                                /*CONSISTENT_TYPE_2_BDRY*/ false,
-                                                                p_ins_bc_coef,
-                                                                Pointer<VariableFillPattern<NDIM> >(NULL));
+        // NOTE: The pressure component is registered after the velocity
+        // component, so that velocity boundary conditions are set on each patch
+        // before the pressure boundary conditions that depend on them.
+        transaction_comps.push_back(InterpolationTransactionComponent(d_p_idx,
+                                                                      p_src_idx,
+                                                                      /*DATA_REFINE_TYPE*/ "CONSERVATIVE_LINEAR_REFINE",
+                                                                      /*USE_CF_INTERPOLATION*/ true,
+                                                                      /*DATA_COARSEN_TYPE*/ "CUBIC_COARSEN",
+                                                                      /*BDRY_EXTRAP_TYPE*/ "LINEAR",
+                                                                      /*CONSISTENT_TYPE_2_BDRY*/ false,
+                                                                      p_ins_bc_coef,
+                                                                      Pointer<VariableFillPattern<NDIM> >(NULL)));
+    }
+
+    if (!transaction_comps.empty())
+    {
         Pointer<HierarchyGhostCellInterpolation> hier_bdry_fill = new HierarchyGhostCellInterpolation();
-        hier_bdry_fill->initializeOperatorState(transaction_comp, patch_hierarchy);
+        hier_bdry_fill->initializeOperatorState(transaction_comps, patch_hierarchy);
         hier_bdry_fill->setHomogeneousBc(false);
         hier_bdry_fill->fillData(fill_time);
     }
@@ -166,6 +166,9 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_interp_kernel_fcn = "IB_4";
     d_spread_kernel_fcn = "IB_4";
     d_error_if_points_leave_domain = false;
+    d_node_ordering = NATURAL_NODE_ORDERING;
+    d_permute_lag_data = false;
+    d_incremental_redistribution = false;
     d_ghosts = std::max(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn),
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_force_jac_mffd = false;
@@ -194,6 +197,8 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setNodeOrdering(d_node_ordering, d_permute_lag_data);
+    d_l_data_manager->setIncrementalRedistribution(d_incremental_redistribution);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -493,6 +498,10 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
     d_F_half_data.clear();
     d_F_jac_data.clear();
 
+    // Deallocate the interpolation and spreading weights that were computed
+    // during the timestep.
+    if (LEInteractor::getUseWeightCache()) LEInteractor::clearWeightCache();
+
     // Reset the current time step interval.
     d_current_time = std::numeric_limits<double>::quiet_NaN();
     d_new_time = std::numeric_limits<double>::quiet_NaN();
@@ -1534,6 +1543,7 @@ IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
                                 Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
     d_l_data_manager->endDataRedistribution();
+    LEInteractor::clearWeightCache();
 
     // Look up the re-distributed Lagrangian position data.
     std::vector<Pointer<LData> > X_data(hierarchy->getFinestLevelNumber() + 1);
@@ -2067,8 +2077,35 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
         if (db->isBool("normalize_source_strength"))
             d_normalize_source_strength = db->getBool("normalize_source_strength");
     }
+    if (db->isString("spread_mode"))
+    {
+        const std::string spread_mode = db->getString("spread_mode");
+        if (IBTK::string_to_enum<SpreadingMode>(spread_mode) == UNKNOWN_SPREADING_MODE)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  unknown spreading mode: "
+                                     << spread_mode
+                                     << "\n"
+                                     << "  valid choices are: SERIAL, COLORED, REPLICATED"
+                                     << std::endl);
+        }
+        LEInteractor::setSpreadingMode(IBTK::string_to_enum<SpreadingMode>(spread_mode));
+    }
+    if (db->isDatabase("LEInteractor"))
+    {
+        LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
+    }
+    if (db->isBool("use_weight_cache"))
+    {
+        LEInteractor::setUseWeightCache(db->getBool("use_weight_cache"));
+    }
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
+    if (db->isString("node_ordering"))
+        d_node_ordering = IBTK::string_to_enum<LNodeOrderingType>(db->getString("node_ordering"));
+    if (db->keyExists("permute_lag_data")) d_permute_lag_data = db->getBool("permute_lag_data");
+    if (db->keyExists("incremental_redistribution"))
+        d_incremental_redistribution = db->getBool("incremental_redistribution");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
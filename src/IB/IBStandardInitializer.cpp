@@ -32,9 +32,16 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <fcntl.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <ios>
 #include <iosfwd>
 #include <istream>
@@ -48,6 +55,7 @@
 #include <vector>
 
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -56,6 +64,7 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "boost/array.hpp"
 #include "boost/math/special_functions/round.hpp"
 #include "boost/multi_array.hpp"
@@ -78,6 +87,7 @@
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/ibtk_utilities.h"
+#include "mpi.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
@@ -123,13 +133,406 @@ discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// Collectively read the lines of an ASCII input file.  The file is split into
+// contiguous byte ranges of (nearly) equal size, one per MPI process, that are
+// read with MPI-IO, and each line is assigned to the process whose range
+// contains its first character.  On return, lines contains the NUL-terminated
+// text of the lines assigned to this process with any comments discarded,
+// line_offsets the offset of each of these lines in lines, first_line the
+// (zero-based) index of the first of these lines in the file, and num_lines the
+// total number of lines in the file.  Returns false on all processes if the
+// file cannot be opened.
+bool
+read_lines_collectively(const std::string& filename,
+                        std::vector<char>& lines,
+                        std::vector<size_t>& line_offsets,
+                        int& first_line,
+                        int& num_lines)
+{
+    MPI_Comm comm = SAMRAI_MPI::getCommunicator();
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    lines.clear();
+    line_offsets.clear();
+    first_line = 0;
+    num_lines = 0;
+
+    MPI_File fh;
+    const bool opened =
+        MPI_File_open(comm, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh) == MPI_SUCCESS;
+    if (SAMRAI_MPI::minReduction(opened ? 1 : 0) == 0)
+    {
+        if (opened) MPI_File_close(&fh);
+        return false;
+    }
+
+    // Read the byte range assigned to this process along with the preceding
+    // character, which determines whether the first character of the range
+    // starts a new line.  Large ranges are read in several collective calls to
+    // keep the count of each call representable by an int.
+    static const MPI_Offset MAX_READ_SIZE = 1 << 30;
+    MPI_Offset file_size = 0;
+    MPI_File_get_size(fh, &file_size);
+    const MPI_Offset range_begin = (file_size * rank) / nodes;
+    const MPI_Offset range_end = (file_size * (rank + 1)) / nodes;
+    const MPI_Offset read_begin = (range_begin > 0 ? range_begin - 1 : 0);
+    lines.resize(static_cast<size_t>(range_end - read_begin));
+    const int num_reads = static_cast<int>((range_end - read_begin + MAX_READ_SIZE - 1) / MAX_READ_SIZE);
+    const int max_num_reads = SAMRAI_MPI::maxReduction(num_reads);
+    char dummy;
+    MPI_Status status;
+    for (int k = 0; k < max_num_reads; ++k)
+    {
+        const MPI_Offset offset = std::min(k * MAX_READ_SIZE, range_end - read_begin);
+        const int count = static_cast<int>(std::min(MAX_READ_SIZE, range_end - read_begin - offset));
+        MPI_File_read_at_all(
+            fh, read_begin + offset, count > 0 ? &lines[offset] : &dummy, count, MPI_CHAR, &status);
+    }
+
+    // Extend the range to the end of the last line that starts within it.
+    if (range_begin < range_end)
+    {
+        static const int TAIL_READ_SIZE = 4096;
+        MPI_Offset pos = range_end;
+        while (pos < file_size && lines.back() != '\n')
+        {
+            const int count = static_cast<int>(std::min(static_cast<MPI_Offset>(TAIL_READ_SIZE), file_size - pos));
+            const size_t old_size = lines.size();
+            lines.resize(old_size + count);
+            MPI_File_read_at(fh, pos, &lines[old_size], count, MPI_CHAR, &status);
+            pos += count;
+        }
+    }
+    MPI_File_close(&fh);
+
+    // Determine the lines that start within the range.  The text of each line is
+    // terminated at its newline character or at the first comment character,
+    // whichever comes first.
+    const size_t range_offset = static_cast<size_t>(range_begin - read_begin);
+    const size_t range_size = static_cast<size_t>(range_end - range_begin);
+    for (size_t i = range_offset; i < range_offset + range_size; ++i)
+    {
+        if ((read_begin + static_cast<MPI_Offset>(i) == 0) || lines[i - 1] == '\n') line_offsets.push_back(i);
+    }
+    for (size_t l = 0; l < line_offsets.size(); ++l)
+    {
+        size_t i = line_offsets[l];
+        while (i < lines.size() && lines[i] != '\n' && lines[i] != '!' && lines[i] != '#' && lines[i] != '%') ++i;
+        if (i == lines.size())
+        {
+            lines.push_back('\0');
+        }
+        else
+        {
+            lines[i] = '\0';
+        }
+    }
+
+    // Determine the global line numbering.
+    int num_local_lines = static_cast<int>(line_offsets.size());
+    int num_lines_upto = 0;
+    MPI_Scan(&num_local_lines, &num_lines_upto, 1, MPI_INT, MPI_SUM, comm);
+    first_line = num_lines_upto - num_local_lines;
+    num_lines = SAMRAI_MPI::sumReduction(num_local_lines);
+    return true;
+} // read_lines_collectively
+
+// Extract the next integer or floating point value from a NUL-terminated
+// string, advancing the string past the value.  Returns false if no value can
+// be extracted.
+inline bool
+parse_value(const char*& str, int& val)
+{
+    char* end;
+    const long l = std::strtol(str, &end, 10);
+    if (end == str || l < std::numeric_limits<int>::min() || l > std::numeric_limits<int>::max()) return false;
+    val = static_cast<int>(l);
+    str = end;
+    return true;
+} // parse_value
+
+inline bool
+parse_value(const char*& str, double& val)
+{
+    char* end;
+    const double d = std::strtod(str, &end);
+    if (end == str) return false;
+    val = d;
+    str = end;
+    return true;
+} // parse_value
+
+// Determine the number of entries specified on the first line of a file that
+// has been read by read_lines_collectively(), ensuring that the file contains
+// a line for each entry.
+int
+get_num_entries_collectively(const std::string& object_name,
+                             const std::string& filename,
+                             const std::vector<char>& lines,
+                             const std::vector<size_t>& line_offsets,
+                             const int first_line,
+                             const int num_lines)
+{
+    if (num_lines == 0)
+    {
+        TBOX_ERROR(object_name << ":\n  Premature end to input file encountered before line 1 of file " << filename
+                               << std::endl);
+    }
+    int num_entries = -1;
+    if (first_line == 0 && !line_offsets.empty())
+    {
+        const char* str = &lines[line_offsets[0]];
+        if (!parse_value(str, num_entries) || num_entries <= 0)
+        {
+            TBOX_ERROR(object_name << ":\n  Invalid entry in input file encountered on line 1 of file " << filename
+                                   << std::endl);
+        }
+    }
+    num_entries = SAMRAI_MPI::maxReduction(num_entries);
+    if (num_lines < num_entries + 1)
+    {
+        TBOX_ERROR(object_name << ":\n  Premature end to input file encountered before line " << num_lines + 1
+                               << " of file "
+                               << filename
+                               << std::endl);
+    }
+    return num_entries;
+} // get_num_entries_collectively
+
+// Gather the values provided by all MPI processes, ordered by rank.
+void
+allgather_values(const std::vector<double>& local_values, std::vector<double>& values)
+{
+    const int nodes = SAMRAI_MPI::getNodes();
+    int num_local_values = static_cast<int>(local_values.size());
+    std::vector<int> num_values(nodes), offsets(nodes, 0);
+    MPI_Allgather(&num_local_values, 1, MPI_INT, &num_values[0], 1, MPI_INT, SAMRAI_MPI::getCommunicator());
+    for (int k = 1; k < nodes; ++k) offsets[k] = offsets[k - 1] + num_values[k - 1];
+    values.resize(offsets[nodes - 1] + num_values[nodes - 1]);
+    double dummy;
+    MPI_Allgatherv(local_values.empty() ? &dummy : const_cast<double*>(&local_values[0]),
+                   num_local_values,
+                   MPI_DOUBLE,
+                   values.empty() ? &dummy : &values[0],
+                   &num_values[0],
+                   &offsets[0],
+                   MPI_DOUBLE,
+                   SAMRAI_MPI::getCommunicator());
+    return;
+} // allgather_values
+
+// Send the values in send_values[k] to MPI process k and gather the values sent
+// to this process, ordered by the rank of the sending process.  The values in
+// send_values are released as they are copied into the send buffer.
+void
+exchange_values(std::vector<std::vector<double> >& send_values, std::vector<double>& recv_values)
+{
+    const int nodes = SAMRAI_MPI::getNodes();
+    std::vector<int> send_counts(nodes), send_offsets(nodes, 0), recv_counts(nodes), recv_offsets(nodes, 0);
+    for (int k = 0; k < nodes; ++k) send_counts[k] = static_cast<int>(send_values[k].size());
+    MPI_Alltoall(&send_counts[0], 1, MPI_INT, &recv_counts[0], 1, MPI_INT, SAMRAI_MPI::getCommunicator());
+    for (int k = 1; k < nodes; ++k)
+    {
+        send_offsets[k] = send_offsets[k - 1] + send_counts[k - 1];
+        recv_offsets[k] = recv_offsets[k - 1] + recv_counts[k - 1];
+    }
+    std::vector<double> send_buffer;
+    send_buffer.reserve(send_offsets[nodes - 1] + send_counts[nodes - 1]);
+    for (int k = 0; k < nodes; ++k)
+    {
+        send_buffer.insert(send_buffer.end(), send_values[k].begin(), send_values[k].end());
+        std::vector<double>().swap(send_values[k]);
+    }
+    recv_values.resize(recv_offsets[nodes - 1] + recv_counts[nodes - 1]);
+    double dummy;
+    MPI_Alltoallv(send_buffer.empty() ? &dummy : &send_buffer[0],
+                  &send_counts[0],
+                  &send_offsets[0],
+                  MPI_DOUBLE,
+                  recv_values.empty() ? &dummy : &recv_values[0],
+                  &recv_counts[0],
+                  &recv_offsets[0],
+                  MPI_DOUBLE,
+                  SAMRAI_MPI::getCommunicator());
+    return;
+} // exchange_values
+
+// Determine the MPI process that initially stores the data associated with
+// vertex k of a structure with num_vertex vertices when the structure data are
+// distributed among the processes.  Data associated with vertices that are not
+// part of the structure are stored by the first process.
+inline int
+get_initial_vertex_owner(const int k, const int num_vertex)
+{
+    if (k < 0 || k >= num_vertex) return 0;
+    return static_cast<int>((static_cast<uint64_t>(k) * SAMRAI_MPI::getNodes()) / num_vertex);
+} // get_initial_vertex_owner
+
+// Binary structure files consist of a header, a table of sections, and the
+// section data.  All values are stored in little-endian byte order, and each
+// section and each array within a section begins at an offset that is a
+// multiple of 8 bytes.  See the IBStandardInitializer class documentation for
+// the layout of the sections.
+static const std::string BINARY_STRUCTURE_FILE_EXTENSION = ".structure";
+static const char BINARY_STRUCTURE_FILE_MAGIC[8] = { 'I', 'B', 'S', 'T', 'R', 'U', 'C', 'T' };
+static const uint32_t BINARY_STRUCTURE_FILE_VERSION = 1;
+static const size_t BINARY_STRUCTURE_FILE_HEADER_SIZE = 24;
+static const size_t BINARY_STRUCTURE_FILE_SECTION_ENTRY_SIZE = 32;
+enum BinaryStructureSectionType
+{
+    VERTEX_SECTION = 1,
+    SPRING_SECTION = 2,
+    BEAM_SECTION = 3,
+    TARGET_POINT_SECTION = 4
+};
+
+inline bool
+is_little_endian()
+{
+    const uint32_t one = 1;
+    return *reinterpret_cast<const unsigned char*>(&one) == 1;
+} // is_little_endian
+
+// Return a pointer to the array of the specified number of values that begins
+// at the specified offset within a section and advance the offset to the
+// beginning of the next array.
+template <class T>
+inline const T*
+next_section_array(const char* section_data, uint64_t& offset, const uint64_t num_values)
+{
+    const T* const values = reinterpret_cast<const T*>(section_data + offset);
+    offset += (num_values * sizeof(T) + 7) / 8 * 8;
+    return values;
+} // next_section_array
 }
 
+// A read-only memory map of a binary structure file.
+class IBStandardInitializer::BinaryStructureFile
+{
+public:
+    BinaryStructureFile() : d_data(NULL), d_size(0)
+    {
+        // intentionally blank
+        return;
+    } // BinaryStructureFile
+
+    ~BinaryStructureFile()
+    {
+        if (d_data) munmap(const_cast<char*>(d_data), d_size);
+        return;
+    } // ~BinaryStructureFile
+
+    // Map the specified file and validate its header and section table.
+    // Returns false if the file cannot be opened.
+    bool open(const std::string& object_name, const std::string& filename)
+    {
+        d_filename = filename;
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0 || file_stat.st_size < static_cast<off_t>(BINARY_STRUCTURE_FILE_HEADER_SIZE))
+        {
+            ::close(fd);
+            TBOX_ERROR(object_name << ":\n  Invalid binary structure file: " << filename << std::endl);
+        }
+        d_size = static_cast<size_t>(file_stat.st_size);
+        void* data = mmap(NULL, d_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED)
+        {
+            d_size = 0;
+            TBOX_ERROR(object_name << ":\n  Cannot map binary structure file: " << filename << std::endl);
+        }
+        d_data = static_cast<const char*>(data);
+
+        if (std::memcmp(d_data, BINARY_STRUCTURE_FILE_MAGIC, sizeof(BINARY_STRUCTURE_FILE_MAGIC)) != 0)
+        {
+            TBOX_ERROR(object_name << ":\n  Invalid binary structure file: " << filename << std::endl);
+        }
+        if (!is_little_endian())
+        {
+            TBOX_ERROR(object_name << ":\n  Binary structure files are only supported on little-endian systems."
+                                   << std::endl);
+        }
+        if (getValue<uint32_t>(8) != BINARY_STRUCTURE_FILE_VERSION)
+        {
+            TBOX_ERROR(object_name << ":\n  Unsupported version " << getValue<uint32_t>(8)
+                                   << " of binary structure file: "
+                                   << filename
+                                   << std::endl);
+        }
+        if (getValue<uint32_t>(12) != NDIM)
+        {
+            TBOX_ERROR(object_name << ":\n  Binary structure file " << filename << " contains "
+                                   << getValue<uint32_t>(12)
+                                   << "-dimensional data"
+                                   << std::endl);
+        }
+        const uint64_t num_sections = getValue<uint32_t>(16);
+        if (BINARY_STRUCTURE_FILE_HEADER_SIZE + num_sections * BINARY_STRUCTURE_FILE_SECTION_ENTRY_SIZE > d_size)
+        {
+            TBOX_ERROR(object_name << ":\n  Invalid binary structure file: " << filename << std::endl);
+        }
+        for (uint64_t k = 0; k < num_sections; ++k)
+        {
+            const size_t entry = BINARY_STRUCTURE_FILE_HEADER_SIZE + k * BINARY_STRUCTURE_FILE_SECTION_ENTRY_SIZE;
+            const uint64_t offset = getValue<uint64_t>(entry + 16), size = getValue<uint64_t>(entry + 24);
+            if (offset % 8 != 0 || offset > d_size || size > d_size - offset)
+            {
+                TBOX_ERROR(object_name << ":\n  Invalid section table in binary structure file: " << filename
+                                       << std::endl);
+            }
+        }
+        return true;
+    } // open
+
+    // Return a pointer to the data of the section of the specified type, or
+    // NULL if the file does not contain such a section.
+    const char* getSection(const uint32_t type, uint64_t& num_records, uint64_t& size) const
+    {
+        const uint32_t num_sections = getValue<uint32_t>(16);
+        for (uint32_t k = 0; k < num_sections; ++k)
+        {
+            const size_t entry = BINARY_STRUCTURE_FILE_HEADER_SIZE + k * BINARY_STRUCTURE_FILE_SECTION_ENTRY_SIZE;
+            if (getValue<uint32_t>(entry) != type) continue;
+            num_records = getValue<uint64_t>(entry + 8);
+            size = getValue<uint64_t>(entry + 24);
+            return d_data + getValue<uint64_t>(entry + 16);
+        }
+        return NULL;
+    } // getSection
+
+    const std::string& getFilename() const
+    {
+        return d_filename;
+    } // getFilename
+
+private:
+    BinaryStructureFile(const BinaryStructureFile& from);
+    BinaryStructureFile& operator=(const BinaryStructureFile& that);
+
+    template <class T>
+    T getValue(const size_t offset) const
+    {
+        T val;
+        std::memcpy(&val, d_data + offset, sizeof(T));
+        return val;
+    } // getValue
+
+    std::string d_filename;
+    const char* d_data;
+    size_t d_size;
+};
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBStandardInitializer::IBStandardInitializer(const std::string& object_name, Pointer<Database> input_db)
     : d_object_name(object_name),
       d_use_file_batons(true),
+      d_use_parallel_file_parser(false),
+      d_use_binary_structure_files(false),
+      d_binary_structure_files(),
       d_max_levels(-1),
       d_level_is_initialized(),
       d_silo_writer(NULL),
@@ -139,6 +542,7 @@ IBStandardInitializer::IBStandardInitializer(const std::string& object_name, Poi
       d_num_vertex(),
       d_vertex_offset(),
       d_vertex_posn(),
+      d_local_vertex_posn(),
       d_enable_springs(),
       d_spring_edge_map(),
       d_spring_spec_data(),
@@ -213,6 +617,9 @@ IBStandardInitializer::IBStandardInitializer(const std::string& object_name, Poi
     // Process the input files only if we are not starting from a restart file.
     if (!is_from_restart)
     {
+        // Map the binary structure files, if any.
+        openBinaryStructureFiles();
+
         // Process the vertex information.
         readVertexFiles(".vertex");
 
@@ -231,6 +638,12 @@ IBStandardInitializer::IBStandardInitializer(const std::string& object_name, Poi
         // Process the target point information.
         readTargetPointFiles(".target");
 
+        // Release the binary structure files.
+        closeBinaryStructureFiles();
+
+        // Distribute the vertex, spring, and beam data among the processes.
+        if (d_use_parallel_file_parser) distributeStructureData();
+
         // Process the anchor point information.
         readAnchorPointFiles(".anchor");
 
@@ -252,6 +665,7 @@ IBStandardInitializer::IBStandardInitializer(const std::string& object_name, Poi
 IBStandardInitializer::~IBStandardInitializer()
 {
     pout << d_object_name << ":  Deallocating initialization data.\n";
+    closeBinaryStructureFiles();
     return;
 } // ~IBStandardInitializer
 
@@ -307,6 +721,10 @@ IBStandardInitializer::computeLocalNodeCountOnPatchLevel(const Pointer<PatchHier
                                                          const bool /*can_be_refined*/,
                                                          const bool /*initial_time*/)
 {
+    // Send the structure data to the processes that own the patches of the
+    // specified level.
+    if (d_use_parallel_file_parser) redistributeStructureData(hierarchy, level_number);
+
     // Determine the extents of the physical domain.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
 
@@ -605,6 +1023,10 @@ IBStandardInitializer::tagCellsForInitialRefinement(const Pointer<PatchHierarchy
                                                     const double /*error_data_time*/,
                                                     const int tag_index)
 {
+    // Send the structure data to the processes that own the patches of the
+    // specified level.
+    if (d_use_parallel_file_parser) redistributeStructureData(hierarchy, level_number);
+
     // Determine the extents of the physical domain.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     const double* const domain_x_lower = grid_geom->getXLower();
@@ -692,12 +1114,35 @@ IBStandardInitializer::initializeLSiloDataWriter(const int level_number)
         bool registered_spring_edge_map = false;
         for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
         {
-            if (d_spring_edge_map[level_number][j].size() > 0)
+            // When the spring data are distributed among the processes, the
+            // complete mesh is gathered for the data writer.
+            std::multimap<int, Edge> gathered_spring_edge_map;
+            if (d_use_parallel_file_parser)
+            {
+                std::vector<double> local_edge_data, edge_data;
+                local_edge_data.reserve(2 * d_spring_edge_map[level_number][j].size());
+                for (std::multimap<int, Edge>::const_iterator it = d_spring_edge_map[level_number][j].begin();
+                     it != d_spring_edge_map[level_number][j].end();
+                     ++it)
+                {
+                    local_edge_data.push_back(it->second.first);
+                    local_edge_data.push_back(it->second.second);
+                }
+                allgather_values(local_edge_data, edge_data);
+                for (size_t offset = 0; offset < edge_data.size(); offset += 2)
+                {
+                    const Edge e(static_cast<int>(edge_data[offset]), static_cast<int>(edge_data[offset + 1]));
+                    gathered_spring_edge_map.insert(std::make_pair(e.first, e));
+                }
+            }
+            const std::multimap<int, Edge>& spring_edge_map =
+                d_use_parallel_file_parser ? gathered_spring_edge_map : d_spring_edge_map[level_number][j];
+            if (spring_edge_map.size() > 0)
             {
                 registered_spring_edge_map = true;
                 const std::string postfix = "_mesh";
                 d_silo_writer->registerUnstructuredMesh(
-                    d_base_filename[level_number][j] + postfix, d_spring_edge_map[level_number][j], level_number);
+                    d_base_filename[level_number][j] + postfix, spring_edge_map, level_number);
             }
         }
 
@@ -732,6 +1177,7 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
     const int nodes = SAMRAI_MPI::getNodes();
     int flag = 1;
     int sz = 1;
+    const bool use_file_batons = d_use_file_batons && !d_use_parallel_file_parser;
 
     for (int ln = 0; ln < d_max_levels; ++ln)
     {
@@ -739,11 +1185,9 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
         d_num_vertex[ln].resize(num_base_filename, 0);
         d_vertex_offset[ln].resize(num_base_filename, std::numeric_limits<int>::max());
         d_vertex_posn[ln].resize(num_base_filename);
+        d_local_vertex_posn[ln].resize(num_base_filename);
         for (unsigned int j = 0; j < num_base_filename; ++j)
         {
-            // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
-
             if (j == 0)
             {
                 d_vertex_offset[ln][j] = 0;
@@ -753,10 +1197,21 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
                 d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
             }
 
+            // Use the binary structure file if it provides the vertex data.
+            const bool read_binary = d_use_binary_structure_files && readBinaryVertexData(ln, j);
+
+            // Wait for the previous MPI process to finish reading the current file.
+            if (use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+
             // Ensure that the file exists.
             const std::string vertex_filename = d_base_filename[ln][j] + extension;
+            if (d_use_parallel_file_parser && !read_binary)
+            {
+                parseVertexFileInParallel(vertex_filename, ln, j);
+                continue;
+            }
             std::ifstream file_stream;
-            file_stream.open(vertex_filename.c_str(), std::ios::in);
+            if (!read_binary) file_stream.open(vertex_filename.c_str(), std::ios::in);
             if (file_stream.is_open())
             {
                 plog << d_object_name << ":  "
@@ -831,18 +1286,18 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
                      << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
-            else
+            else if (!read_binary)
             {
                 TBOX_ERROR(d_object_name << ":\n  Cannot find required vertex file: " << vertex_filename << std::endl);
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
     // Synchronize the processes.
-    if (d_use_file_batons) SAMRAI_MPI::barrier();
+    if (use_file_batons) SAMRAI_MPI::barrier();
     return;
 } // readVertexFiles
 
@@ -854,6 +1309,7 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
     const int nodes = SAMRAI_MPI::getNodes();
     int flag = 1;
     int sz = 1;
+    const bool use_file_batons = d_use_file_batons && !d_use_parallel_file_parser;
 
     for (int ln = 0; ln < d_max_levels; ++ln)
     {
@@ -870,13 +1326,22 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                 (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
                                           d_num_vertex[ln][j]);
 
+            // Use the binary structure file if it provides the spring data.
+            const bool read_binary =
+                d_use_binary_structure_files && readBinarySpringData(ln, j, max_idx, input_uses_global_idxs);
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
             // Ensure that the file exists.
             const std::string spring_filename = d_base_filename[ln][j] + extension;
+            if (d_use_parallel_file_parser && !read_binary)
+            {
+                parseSpringFileInParallel(spring_filename, ln, j, max_idx, input_uses_global_idxs);
+                continue;
+            }
             std::ifstream file_stream;
-            file_stream.open(spring_filename.c_str(), std::ios::in);
+            if (!read_binary) file_stream.open(spring_filename.c_str(), std::ios::in);
             if (file_stream.is_open())
             {
                 plog << d_object_name << ":  "
@@ -1016,74 +1481,8 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                         }
                     }
 
-                    // Modify kappa and length according to whether uniform
-                    // values are to be employed for this particular structure.
-                    if (d_using_uniform_spring_stiffness[ln][j])
-                    {
-                        parameters[0] = d_uniform_spring_stiffness[ln][j];
-                    }
-                    if (d_using_uniform_spring_rest_length[ln][j])
-                    {
-                        parameters[1] = d_uniform_spring_rest_length[ln][j];
-                    }
-                    if (d_using_uniform_spring_force_fcn_idx[ln][j])
-                    {
-                        force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
-                    }
-
-                    // Check to see if the spring constant is zero and, if so,
-                    // emit a warning.
-                    if (!warned && d_enable_springs[ln][j] &&
-                        (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
-                    {
-                        TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
-                                                      "encountered in ASCII input file named "
-                                                   << spring_filename
-                                                   << "."
-                                                   << std::endl);
-                        warned = true;
-                    }
-
-                    // Correct the edge numbers to be in the global Lagrangian indexing
-                    // scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        e.first += d_vertex_offset[ln][j];
-                        e.second += d_vertex_offset[ln][j];
-                    }
-
-                    // Initialize the map data corresponding to the present edge.
-                    //
-                    // Note that in the edge map, each edge is associated with only the
-                    // first vertex.
-                    if (e.first > e.second)
-                    {
-                        std::swap<int>(e.first, e.second);
-                    }
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
-                        d_spring_edge_map[ln][j].equal_range(e.first);
-                    for (std::multimap<int, Edge>::iterator it = range.first; it != range.second; ++it)
-                    {
-                        if (it->second == e) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate spring connection between nodes "
-                                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
-                                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << spring_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
-                        SpringSpec spec_data;
-                        spec_data.parameters = parameters;
-                        spec_data.force_fcn_idx = force_fcn_idx;
-                        d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
-                    }
+                    addSpringSpecData(
+                        ln, j, e, parameters, force_fcn_idx, spring_filename, input_uses_global_idxs, warned);
                 }
 
                 // Close the input file.
@@ -1095,12 +1494,12 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
     // Synchronize the processes.
-    if (d_use_file_batons) SAMRAI_MPI::barrier();
+    if (use_file_batons) SAMRAI_MPI::barrier();
     return;
 } // readSpringFiles
 
@@ -1371,6 +1770,7 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
     const int nodes = SAMRAI_MPI::getNodes();
     int flag = 1;
     int sz = 1;
+    const bool use_file_batons = d_use_file_batons && !d_use_parallel_file_parser;
 
     for (int ln = 0; ln < d_max_levels; ++ln)
     {
@@ -1386,12 +1786,21 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
                 (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
                                           d_num_vertex[ln][j]);
 
+            // Use the binary structure file if it provides the beam data.
+            const bool read_binary =
+                d_use_binary_structure_files && readBinaryBeamData(ln, j, max_idx, input_uses_global_idxs);
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
             const std::string beam_filename = d_base_filename[ln][j] + extension;
+            if (d_use_parallel_file_parser && !read_binary)
+            {
+                parseBeamFileInParallel(beam_filename, ln, j, max_idx, input_uses_global_idxs);
+                continue;
+            }
             std::ifstream file_stream;
-            file_stream.open(beam_filename.c_str(), std::ios::in);
+            if (!read_binary) file_stream.open(beam_filename.c_str(), std::ios::in);
             if (file_stream.is_open())
             {
                 plog << d_object_name << ":  "
@@ -1547,69 +1956,8 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
                         }
                     }
 
-                    // Modify bend and curvature according to whether uniform
-                    // values are to be employed for this particular structure.
-                    if (d_using_uniform_beam_bend_rigidity[ln][j])
-                    {
-                        bend = d_uniform_beam_bend_rigidity[ln][j];
-                    }
-                    if (d_using_uniform_beam_curvature[ln][j])
-                    {
-                        curv = d_uniform_beam_curvature[ln][j];
-                    }
-
-                    // Check to see if the bending rigidity is zero and, if so,
-                    // emit a warning.
-                    if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || MathUtilities<double>::equalEps(bend, 0.0)))
-                    {
-                        TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity "
-                                                      "encountered in ASCII input file named "
-                                                   << beam_filename
-                                                   << "."
-                                                   << std::endl);
-                        warned = true;
-                    }
-
-                    // Correct the node numbers to be in the global Lagrangian
-                    // indexing scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        prev_idx += d_vertex_offset[ln][j];
-                        curr_idx += d_vertex_offset[ln][j];
-                        next_idx += d_vertex_offset[ln][j];
-                    }
-
-                    // Initialize the map data corresponding to the present
-                    // beam.
-                    //
-                    // Note that in the beam property map, each edge is
-                    // associated with only the "current" vertex.
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, BeamSpec>::iterator, std::multimap<int, BeamSpec>::iterator> range =
-                        d_beam_spec_data[ln][j].equal_range(curr_idx);
-                    for (std::multimap<int, BeamSpec>::iterator it = range.first; it != range.second; ++it)
-                    {
-                        const BeamSpec& spec_data = it->second;
-                        if (spec_data.neighbor_idxs == std::make_pair(next_idx, prev_idx)) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate beam connection between nodes "
-                                     << (prev_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ",  "
-                                     << (curr_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ", and "
-                                     << (next_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << beam_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        BeamSpec spec_data;
-                        spec_data.neighbor_idxs = std::make_pair(next_idx, prev_idx);
-                        spec_data.bend_rigidity = bend;
-                        spec_data.curvature = curv;
-                        d_beam_spec_data[ln][j].insert(std::make_pair(curr_idx, spec_data));
-                    }
+                    addBeamSpecData(
+                        ln, j, prev_idx, curr_idx, next_idx, bend, curv, beam_filename, input_uses_global_idxs, warned);
                 }
 
                 // Close the input file.
@@ -1621,15 +1969,1003 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
     // Synchronize the processes.
-    if (d_use_file_batons) SAMRAI_MPI::barrier();
+    if (use_file_batons) SAMRAI_MPI::barrier();
     return;
 } // readBeamFiles
 
+void
+IBStandardInitializer::parseVertexFileInParallel(const std::string& vertex_filename,
+                                                 const int ln,
+                                                 const unsigned int j)
+{
+    std::vector<char> lines;
+    std::vector<size_t> line_offsets;
+    int first_line, num_lines;
+    if (!read_lines_collectively(vertex_filename, lines, line_offsets, first_line, num_lines))
+    {
+        TBOX_ERROR(d_object_name << ":\n  Cannot find required vertex file: " << vertex_filename << std::endl);
+    }
+    plog << d_object_name << ":  "
+         << "processing vertex data from ASCII input file named " << vertex_filename << std::endl
+         << "  in parallel on " << SAMRAI_MPI::getNodes() << " MPI processes" << std::endl;
+
+    // The first entry in the file is the number of vertices.
+    const int num_vertex =
+        get_num_entries_collectively(d_object_name, vertex_filename, lines, line_offsets, first_line, num_lines);
+
+    // Each successive line provides the initial position of each vertex in the
+    // input file.  Each process parses the lines that it has read and sends
+    // each vertex position to the process that initially stores it.
+    std::vector<std::vector<double> > send_posn_data(SAMRAI_MPI::getNodes());
+    for (size_t l = 0; l < line_offsets.size(); ++l)
+    {
+        const int line = first_line + static_cast<int>(l);
+        if (line == 0 || line > num_vertex) continue;
+        const char* str = &lines[line_offsets[l]];
+        std::vector<double>& posn_data = send_posn_data[get_initial_vertex_owner(line - 1, num_vertex)];
+        posn_data.push_back(line - 1);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            double X;
+            if (!parse_value(str, X))
+            {
+                TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << line + 1
+                                         << " of file "
+                                         << vertex_filename
+                                         << std::endl);
+            }
+            posn_data.push_back(d_length_scale_factor * (X + d_posn_shift[d]));
+        }
+    }
+    std::vector<char>().swap(lines);
+
+    // Store the vertex positions sent to this process.
+    std::vector<double> posn_data;
+    exchange_values(send_posn_data, posn_data);
+    d_num_vertex[ln][j] = num_vertex;
+    for (size_t offset = 0; offset < posn_data.size(); offset += NDIM + 1)
+    {
+        Point& X = d_local_vertex_posn[ln][j][static_cast<int>(posn_data[offset])];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[d] = posn_data[offset + 1 + d];
+        }
+    }
+
+    plog << d_object_name << ":  "
+         << "read " << num_vertex << " vertices from ASCII input file named " << vertex_filename << std::endl
+         << "  in parallel on " << SAMRAI_MPI::getNodes() << " MPI processes" << std::endl;
+    return;
+} // parseVertexFileInParallel
+
+void
+IBStandardInitializer::parseSpringFileInParallel(const std::string& spring_filename,
+                                                 const int ln,
+                                                 const unsigned int j,
+                                                 const int max_idx,
+                                                 const bool input_uses_global_idxs)
+{
+    std::vector<char> lines;
+    std::vector<size_t> line_offsets;
+    int first_line, num_lines;
+    if (!read_lines_collectively(spring_filename, lines, line_offsets, first_line, num_lines)) return;
+    plog << d_object_name << ":  "
+         << "processing spring data from ASCII input file named " << spring_filename << std::endl
+         << "  in parallel on " << SAMRAI_MPI::getNodes() << " MPI processes" << std::endl;
+
+    // The first line in the file indicates the number of edges in the input
+    // file.
+    const int num_edges =
+        get_num_entries_collectively(d_object_name, spring_filename, lines, line_offsets, first_line, num_lines);
+
+    // Each successive line provides the connectivity and material parameter
+    // information for each spring in the structure.  Each process parses the
+    // lines that it has read, storing for each spring the vertex indices, the
+    // force function index, the number of parameters, and the parameters.  The
+    // data for each spring are sent to the process that initially stores the
+    // vertex with which the spring is associated.
+    std::vector<std::vector<double> > send_spring_data(SAMRAI_MPI::getNodes());
+    for (size_t l = 0; l < line_offsets.size(); ++l)
+    {
+        const int line = first_line + static_cast<int>(l);
+        if (line == 0 || line > num_edges) continue;
+        const char* str = &lines[line_offsets[l]];
+        Edge e;
+        double kappa, length;
+        int force_fcn_idx = 0;
+        if (!parse_value(str, e.first) || !parse_value(str, e.second))
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << line + 1
+                                     << " of file "
+                                     << spring_filename
+                                     << std::endl);
+        }
+        else if ((e.first < 0) || (e.first >= max_idx) || (e.second < 0) || (e.second >= max_idx))
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << line + 1
+                                     << " of file "
+                                     << spring_filename
+                                     << std::endl
+                                     << "  vertex index "
+                                     << ((e.first < 0) || (e.first >= max_idx) ? e.first : e.second)
+                                     << " is out of range"
+                                     << std::endl);
+        }
+        if (!parse_value(str, kappa) || !parse_value(str, length))
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << line + 1
+                                     << " of file "
+                                     << spring_filename
+                                     << std::endl);
+        }
+        else if (kappa < 0.0 || length < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << line + 1
+                                     << " of file "
+                                     << spring_filename
+                                     << std::endl
+                                     << (kappa < 0.0 ? "  spring constant is negative" :
+                                                       "  spring resting length is negative")
+                                     << std::endl);
+        }
+        if (!parse_value(str, force_fcn_idx))
+        {
+            force_fcn_idx = 0; // default force function specification.
+        }
+        const int mastr_idx = std::min(e.first, e.second) - (input_uses_global_idxs ? d_vertex_offset[ln][j] : 0);
+        const int owner = get_initial_vertex_owner(mastr_idx, d_num_vertex[ln][j]);
+        std::vector<double>& spring_data = send_spring_data[owner];
+        spring_data.push_back(e.first);
+        spring_data.push_back(e.second);
+        spring_data.push_back(force_fcn_idx);
+        const size_t num_params_idx = spring_data.size();
+        spring_data.push_back(2.0);
+        spring_data.push_back(kappa);
+        spring_data.push_back(d_length_scale_factor * length);
+        double param;
+        while (parse_value(str, param))
+        {
+            spring_data.push_back(param);
+            spring_data[num_params_idx] += 1.0;
+        }
+    }
+    std::vector<char>().swap(lines);
+
+    // Set up the springs sent to this process in the order in which they appear
+    // in the input file.
+    std::vector<double> spring_data;
+    exchange_values(send_spring_data, spring_data);
+    bool warned = false;
+    for (size_t offset = 0; offset < spring_data.size();)
+    {
+        Edge e(static_cast<int>(spring_data[offset]), static_cast<int>(spring_data[offset + 1]));
+        const int force_fcn_idx = static_cast<int>(spring_data[offset + 2]);
+        const size_t num_params = static_cast<size_t>(spring_data[offset + 3]);
+        std::vector<double> parameters(spring_data.begin() + offset + 4,
+                                       spring_data.begin() + offset + 4 + num_params);
+        addSpringSpecData(ln, j, e, parameters, force_fcn_idx, spring_filename, input_uses_global_idxs, warned);
+        offset += 4 + num_params;
+    }
+
+    plog << d_object_name << ":  "
+         << "read " << num_edges << " edges from ASCII input file named " << spring_filename << std::endl
+         << "  in parallel on " << SAMRAI_MPI::getNodes() << " MPI processes" << std::endl;
+    return;
+} // parseSpringFileInParallel
+
+void
+IBStandardInitializer::parseBeamFileInParallel(const std::string& beam_filename,
+                                               const int ln,
+                                               const unsigned int j,
+                                               const int max_idx,
+                                               const bool input_uses_global_idxs)
+{
+    std::vector<char> lines;
+    std::vector<size_t> line_offsets;
+    int first_line, num_lines;
+    if (!read_lines_collectively(beam_filename, lines, line_offsets, first_line, num_lines)) return;
+    plog << d_object_name << ":  "
+         << "processing beam data from ASCII input file named " << beam_filename << std::endl
+         << "  in parallel on " << SAMRAI_MPI::getNodes() << " MPI processes" << std::endl;
+
+    // The first line in the file indicates the number of beams in the input
+    // file.
+    const int num_beams =
+        get_num_entries_collectively(d_object_name, beam_filename, lines, line_offsets, first_line, num_lines);
+
+    // Each successive line provides the connectivity and material parameter
+    // information for each beam in the structure.  Each process parses the
+    // lines that it has read, storing for each beam the vertex indices, the
+    // bending rigidity, and the curvature.  The data for each beam are sent to
+    // the process that initially stores the vertex with which the beam is
+    // associated.
+    static const int BEAM_DATA_SIZE = 4 + NDIM;
+    std::vector<std::vector<double> > send_beam_data(SAMRAI_MPI::getNodes());
+    std::vector<double> local_beam_data;
+    local_beam_data.reserve(BEAM_DATA_SIZE);
+    for (size_t l = 0; l < line_offsets.size(); ++l)
+    {
+        const int line = first_line + static_cast<int>(l);
+        if (line == 0 || line > num_beams) continue;
+        const char* str = &lines[line_offsets[l]];
+        local_beam_data.clear();
+        int idxs[3];
+        for (int k = 0; k < 3; ++k)
+        {
+            if (!parse_value(str, idxs[k]))
+            {
+                TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << line + 1
+                                         << " of file "
+                                         << beam_filename
+                                         << std::endl);
+            }
+            else if ((idxs[k] < 0) || (idxs[k] >= max_idx))
+            {
+                TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << line + 1
+                                         << " of file "
+                                         << beam_filename
+                                         << std::endl
+                                         << "  vertex index "
+                                         << idxs[k]
+                                         << " is out of range"
+                                         << std::endl);
+            }
+            local_beam_data.push_back(idxs[k]);
+        }
+        double bend;
+        if (!parse_value(str, bend))
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << line + 1
+                                     << " of file "
+                                     << beam_filename
+                                     << std::endl);
+        }
+        else if (bend < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << line + 1
+                                     << " of file "
+                                     << beam_filename
+                                     << std::endl
+                                     << "  beam constant is negative"
+                                     << std::endl);
+        }
+        local_beam_data.push_back(bend);
+        unsigned int num_curv_entries = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            double c = 0.0;
+            if (parse_value(str, c)) ++num_curv_entries;
+            local_beam_data.push_back(c);
+        }
+        if (num_curv_entries != 0 && num_curv_entries != NDIM)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << line + 1
+                                     << " of file "
+                                     << beam_filename
+                                     << std::endl
+                                     << "  incomplete beam curvature specification"
+                                     << std::endl);
+        }
+        const int mastr_idx = idxs[1] - (input_uses_global_idxs ? d_vertex_offset[ln][j] : 0);
+        const int owner = get_initial_vertex_owner(mastr_idx, d_num_vertex[ln][j]);
+        std::vector<double>& beam_data = send_beam_data[owner];
+        beam_data.insert(beam_data.end(), local_beam_data.begin(), local_beam_data.end());
+    }
+    std::vector<char>().swap(lines);
+
+    // Set up the beams sent to this process in the order in which they appear
+    // in the input file.
+    std::vector<double> beam_data;
+    exchange_values(send_beam_data, beam_data);
+    bool warned = false;
+    for (size_t offset = 0; offset < beam_data.size(); offset += BEAM_DATA_SIZE)
+    {
+        Vector curv;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            curv[d] = beam_data[offset + 4 + d];
+        }
+        addBeamSpecData(ln,
+                        j,
+                        static_cast<int>(beam_data[offset]),
+                        static_cast<int>(beam_data[offset + 1]),
+                        static_cast<int>(beam_data[offset + 2]),
+                        beam_data[offset + 3],
+                        curv,
+                        beam_filename,
+                        input_uses_global_idxs,
+                        warned);
+    }
+
+    plog << d_object_name << ":  "
+         << "read " << num_beams << " beams from ASCII input file named " << beam_filename << std::endl
+         << "  in parallel on " << SAMRAI_MPI::getNodes() << " MPI processes" << std::endl;
+    return;
+} // parseBeamFileInParallel
+
+void
+IBStandardInitializer::addSpringSpecData(const int ln,
+                                         const unsigned int j,
+                                         Edge e,
+                                         std::vector<double>& parameters,
+                                         int force_fcn_idx,
+                                         const std::string& spring_filename,
+                                         const bool input_uses_global_idxs,
+                                         bool& warned)
+{
+    // Modify kappa and length according to whether uniform
+    // values are to be employed for this particular structure.
+    if (d_using_uniform_spring_stiffness[ln][j])
+    {
+        parameters[0] = d_uniform_spring_stiffness[ln][j];
+    }
+    if (d_using_uniform_spring_rest_length[ln][j])
+    {
+        parameters[1] = d_uniform_spring_rest_length[ln][j];
+    }
+    if (d_using_uniform_spring_force_fcn_idx[ln][j])
+    {
+        force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
+    }
+
+    // Check to see if the spring constant is zero and, if so,
+    // emit a warning.
+    if (!warned && d_enable_springs[ln][j] &&
+        (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
+    {
+        TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
+                                      "encountered in ASCII input file named "
+                                   << spring_filename
+                                   << "."
+                                   << std::endl);
+        warned = true;
+    }
+
+    // Correct the edge numbers to be in the global Lagrangian indexing
+    // scheme.
+    if (!input_uses_global_idxs)
+    {
+        e.first += d_vertex_offset[ln][j];
+        e.second += d_vertex_offset[ln][j];
+    }
+
+    // Initialize the map data corresponding to the present edge.
+    //
+    // Note that in the edge map, each edge is associated with only the
+    // first vertex.
+    if (e.first > e.second)
+    {
+        std::swap<int>(e.first, e.second);
+    }
+    bool found_connection = false;
+    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
+        d_spring_edge_map[ln][j].equal_range(e.first);
+    for (std::multimap<int, Edge>::iterator it = range.first; it != range.second; ++it)
+    {
+        if (it->second == e) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate spring connection between nodes "
+                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
+                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in ASCII input file named " << spring_filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+    }
+    else
+    {
+        d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
+        SpringSpec spec_data;
+        spec_data.parameters = parameters;
+        spec_data.force_fcn_idx = force_fcn_idx;
+        d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // addSpringSpecData
+
+void
+IBStandardInitializer::addBeamSpecData(const int ln,
+                                       const unsigned int j,
+                                       int prev_idx,
+                                       int curr_idx,
+                                       int next_idx,
+                                       double bend,
+                                       Vector curv,
+                                       const std::string& beam_filename,
+                                       const bool input_uses_global_idxs,
+                                       bool& warned)
+{
+    // Modify bend and curvature according to whether uniform
+    // values are to be employed for this particular structure.
+    if (d_using_uniform_beam_bend_rigidity[ln][j])
+    {
+        bend = d_uniform_beam_bend_rigidity[ln][j];
+    }
+    if (d_using_uniform_beam_curvature[ln][j])
+    {
+        curv = d_uniform_beam_curvature[ln][j];
+    }
+
+    // Check to see if the bending rigidity is zero and, if so,
+    // emit a warning.
+    if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || MathUtilities<double>::equalEps(bend, 0.0)))
+    {
+        TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity "
+                                      "encountered in ASCII input file named "
+                                   << beam_filename
+                                   << "."
+                                   << std::endl);
+        warned = true;
+    }
+
+    // Correct the node numbers to be in the global Lagrangian
+    // indexing scheme.
+    if (!input_uses_global_idxs)
+    {
+        prev_idx += d_vertex_offset[ln][j];
+        curr_idx += d_vertex_offset[ln][j];
+        next_idx += d_vertex_offset[ln][j];
+    }
+
+    // Initialize the map data corresponding to the present
+    // beam.
+    //
+    // Note that in the beam property map, each edge is
+    // associated with only the "current" vertex.
+    bool found_connection = false;
+    std::pair<std::multimap<int, BeamSpec>::iterator, std::multimap<int, BeamSpec>::iterator> range =
+        d_beam_spec_data[ln][j].equal_range(curr_idx);
+    for (std::multimap<int, BeamSpec>::iterator it = range.first; it != range.second; ++it)
+    {
+        const BeamSpec& spec_data = it->second;
+        if (spec_data.neighbor_idxs == std::make_pair(next_idx, prev_idx)) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate beam connection between nodes "
+                     << (prev_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ",  "
+                     << (curr_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ", and "
+                     << (next_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in ASCII input file named " << beam_filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+    }
+    else
+    {
+        BeamSpec spec_data;
+        spec_data.neighbor_idxs = std::make_pair(next_idx, prev_idx);
+        spec_data.bend_rigidity = bend;
+        spec_data.curvature = curv;
+        d_beam_spec_data[ln][j].insert(std::make_pair(curr_idx, spec_data));
+    }
+    return;
+} // addBeamSpecData
+
+void
+IBStandardInitializer::distributeStructureData()
+{
+    // Vertex data that were read by every process are stored only by the
+    // process that initially stores each vertex, and the spring and beam data
+    // are stored only by the process that stores the vertex with which they are
+    // associated.
+    const int rank = SAMRAI_MPI::getRank();
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        for (unsigned int j = 0; j < d_num_vertex[ln].size(); ++j)
+        {
+            const int num_vertex = d_num_vertex[ln][j];
+            if (!d_vertex_posn[ln][j].empty())
+            {
+                for (int k = 0; k < num_vertex; ++k)
+                {
+                    if (get_initial_vertex_owner(k, num_vertex) == rank)
+                    {
+                        d_local_vertex_posn[ln][j][k] = d_vertex_posn[ln][j][k];
+                    }
+                }
+                std::vector<Point>().swap(d_vertex_posn[ln][j]);
+            }
+            const std::map<int, Point>& local_vertex_posn = d_local_vertex_posn[ln][j];
+            for (std::multimap<int, Edge>::iterator it = d_spring_edge_map[ln][j].begin();
+                 it != d_spring_edge_map[ln][j].end();)
+            {
+                const int k = it->first - d_vertex_offset[ln][j];
+                if (k >= 0 && k < num_vertex && !local_vertex_posn.count(k))
+                {
+                    d_spring_spec_data[ln][j].erase(it->second);
+                    d_spring_edge_map[ln][j].erase(it++);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            for (std::multimap<int, BeamSpec>::iterator it = d_beam_spec_data[ln][j].begin();
+                 it != d_beam_spec_data[ln][j].end();)
+            {
+                const int k = it->first - d_vertex_offset[ln][j];
+                if (k >= 0 && k < num_vertex && !local_vertex_posn.count(k))
+                {
+                    d_beam_spec_data[ln][j].erase(it++);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+    }
+    return;
+} // distributeStructureData
+
+void
+IBStandardInitializer::redistributeStructureData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                 const int level_number)
+{
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const domain_x_lower = grid_geom->getXLower();
+    const double* const domain_x_upper = grid_geom->getXUpper();
+    const Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(ratio);
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    const ProcessorMapping& mapping = level->getProcessorMapping();
+
+    // Pack the data of each vertex stored on this process that is located
+    // within a patch of the specified level that is assigned to another
+    // process.  The data of each vertex consist of its level, structure, and
+    // vertex numbers, its position, and the springs and beams associated with
+    // it.  Vertices that are not located within any patch of the level remain
+    // on this process.
+    //
+    // NOTE: The patch containing each vertex is found by a linear search over
+    // the boxes of the level.
+    std::vector<std::vector<double> > send_data(nodes);
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        for (unsigned int j = 0; j < d_num_vertex[ln].size(); ++j)
+        {
+            std::map<int, Point>& local_vertex_posn = d_local_vertex_posn[ln][j];
+            for (std::map<int, Point>::iterator it = local_vertex_posn.begin(); it != local_vertex_posn.end();)
+            {
+                const std::pair<int, int> point_index(j, it->first);
+                const Point X =
+                    getShiftedVertexPosn(point_index, ln, domain_x_lower, domain_x_upper, periodic_shift);
+                const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
+                int owner = rank;
+                for (int p = 0; p < boxes.getNumberOfBoxes(); ++p)
+                {
+                    if (boxes[p].contains(idx))
+                    {
+                        owner = mapping.getProcessorAssignment(p);
+                        break;
+                    }
+                }
+                if (owner == rank)
+                {
+                    ++it;
+                    continue;
+                }
+                std::vector<double>& data = send_data[owner];
+                data.push_back(ln);
+                data.push_back(j);
+                data.push_back(it->first);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    data.push_back(it->second[d]);
+                }
+                const int mastr_idx = getCanonicalLagrangianIndex(point_index, ln);
+                std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> spring_range =
+                    d_spring_edge_map[ln][j].equal_range(mastr_idx);
+                data.push_back(std::distance(spring_range.first, spring_range.second));
+                for (std::multimap<int, Edge>::iterator e_it = spring_range.first; e_it != spring_range.second; ++e_it)
+                {
+                    const Edge& e = e_it->second;
+                    const SpringSpec& spec_data = d_spring_spec_data[ln][j].find(e)->second;
+                    data.push_back(e.first);
+                    data.push_back(e.second);
+                    data.push_back(spec_data.force_fcn_idx);
+                    data.push_back(spec_data.parameters.size());
+                    data.insert(data.end(), spec_data.parameters.begin(), spec_data.parameters.end());
+                    d_spring_spec_data[ln][j].erase(e);
+                }
+                d_spring_edge_map[ln][j].erase(spring_range.first, spring_range.second);
+                std::pair<std::multimap<int, BeamSpec>::iterator, std::multimap<int, BeamSpec>::iterator> beam_range =
+                    d_beam_spec_data[ln][j].equal_range(mastr_idx);
+                data.push_back(std::distance(beam_range.first, beam_range.second));
+                for (std::multimap<int, BeamSpec>::iterator b_it = beam_range.first; b_it != beam_range.second; ++b_it)
+                {
+                    const BeamSpec& spec_data = b_it->second;
+                    data.push_back(spec_data.neighbor_idxs.first);
+                    data.push_back(spec_data.neighbor_idxs.second);
+                    data.push_back(spec_data.bend_rigidity);
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        data.push_back(spec_data.curvature[d]);
+                    }
+                }
+                d_beam_spec_data[ln][j].erase(beam_range.first, beam_range.second);
+                local_vertex_posn.erase(it++);
+            }
+        }
+    }
+
+    // Exchange the data and store the vertices sent to this process.
+    std::vector<double> recv_data;
+    exchange_values(send_data, recv_data);
+    for (size_t offset = 0; offset < recv_data.size();)
+    {
+        const int ln = static_cast<int>(recv_data[offset++]);
+        const int j = static_cast<int>(recv_data[offset++]);
+        const int k = static_cast<int>(recv_data[offset++]);
+        Point& X = d_local_vertex_posn[ln][j][k];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[d] = recv_data[offset++];
+        }
+        const int mastr_idx = getCanonicalLagrangianIndex(std::make_pair(j, k), ln);
+        const int num_springs = static_cast<int>(recv_data[offset++]);
+        for (int s = 0; s < num_springs; ++s)
+        {
+            Edge e;
+            e.first = static_cast<int>(recv_data[offset++]);
+            e.second = static_cast<int>(recv_data[offset++]);
+            SpringSpec spec_data;
+            spec_data.force_fcn_idx = static_cast<int>(recv_data[offset++]);
+            const size_t num_params = static_cast<size_t>(recv_data[offset++]);
+            spec_data.parameters.assign(recv_data.begin() + offset, recv_data.begin() + offset + num_params);
+            offset += num_params;
+            d_spring_edge_map[ln][j].insert(std::make_pair(mastr_idx, e));
+            d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
+        }
+        const int num_beams = static_cast<int>(recv_data[offset++]);
+        for (int b = 0; b < num_beams; ++b)
+        {
+            BeamSpec spec_data;
+            spec_data.neighbor_idxs.first = static_cast<int>(recv_data[offset++]);
+            spec_data.neighbor_idxs.second = static_cast<int>(recv_data[offset++]);
+            spec_data.bend_rigidity = recv_data[offset++];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                spec_data.curvature[d] = recv_data[offset++];
+            }
+            d_beam_spec_data[ln][j].insert(std::make_pair(mastr_idx, spec_data));
+        }
+    }
+    return;
+} // redistributeStructureData
+
+void
+IBStandardInitializer::openBinaryStructureFiles()
+{
+    closeBinaryStructureFiles();
+    if (!d_use_binary_structure_files) return;
+    d_binary_structure_files.resize(d_max_levels);
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        const size_t num_base_filename = d_base_filename[ln].size();
+        d_binary_structure_files[ln].resize(num_base_filename, NULL);
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            BinaryStructureFile* structure_file = new BinaryStructureFile();
+            if (structure_file->open(d_object_name, d_base_filename[ln][j] + BINARY_STRUCTURE_FILE_EXTENSION))
+            {
+                d_binary_structure_files[ln][j] = structure_file;
+            }
+            else
+            {
+                delete structure_file;
+            }
+        }
+    }
+    return;
+} // openBinaryStructureFiles
+
+void
+IBStandardInitializer::closeBinaryStructureFiles()
+{
+    for (unsigned int ln = 0; ln < d_binary_structure_files.size(); ++ln)
+    {
+        for (unsigned int j = 0; j < d_binary_structure_files[ln].size(); ++j)
+        {
+            delete d_binary_structure_files[ln][j];
+        }
+    }
+    d_binary_structure_files.clear();
+    return;
+} // closeBinaryStructureFiles
+
+bool
+IBStandardInitializer::readBinaryVertexData(const int ln, const unsigned int j)
+{
+    const BinaryStructureFile* const structure_file = d_binary_structure_files[ln][j];
+    if (!structure_file) return false;
+    uint64_t num_records, size;
+    const char* const section_data = structure_file->getSection(VERTEX_SECTION, num_records, size);
+    if (!section_data) return false;
+    const std::string& filename = structure_file->getFilename();
+    plog << d_object_name << ":  "
+         << "processing vertex data from binary input file named " << filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+    if (num_records == 0 || num_records > static_cast<uint64_t>(std::numeric_limits<int>::max()) ||
+        num_records > size / (NDIM * sizeof(double)))
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid vertex section in binary structure file " << filename << std::endl);
+    }
+    uint64_t offset = 0;
+    const double* const X_data = next_section_array<double>(section_data, offset, NDIM * num_records);
+    d_num_vertex[ln][j] = static_cast<int>(num_records);
+    d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
+    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+    {
+        Point& X = d_vertex_posn[ln][j][k];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[d] = d_length_scale_factor * (X_data[NDIM * k + d] + d_posn_shift[d]);
+        }
+    }
+
+    plog << d_object_name << ":  "
+         << "read " << d_num_vertex[ln][j] << " vertices from binary input file named " << filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+    return true;
+} // readBinaryVertexData
+
+bool
+IBStandardInitializer::readBinarySpringData(const int ln,
+                                            const unsigned int j,
+                                            const int max_idx,
+                                            const bool input_uses_global_idxs)
+{
+    const BinaryStructureFile* const structure_file = d_binary_structure_files[ln][j];
+    if (!structure_file) return false;
+    uint64_t num_records, size;
+    const char* const section_data = structure_file->getSection(SPRING_SECTION, num_records, size);
+    if (!section_data) return false;
+    const std::string& filename = structure_file->getFilename();
+    plog << d_object_name << ":  "
+         << "processing spring data from binary input file named " << filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+    // Each spring record consists of two vertex indices, a force function
+    // index, two parameters, and the offset of its extra parameters, and the
+    // section also contains the offset that ends the extra parameters.
+    static const size_t spring_record_size = 3 * sizeof(int32_t) + 2 * sizeof(double) + sizeof(uint64_t);
+    if (size < sizeof(uint64_t) || num_records > (size - sizeof(uint64_t)) / spring_record_size)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid spring section in binary structure file " << filename << std::endl);
+    }
+    uint64_t offset = 0;
+    const int32_t* const idx_data = next_section_array<int32_t>(section_data, offset, 2 * num_records);
+    const int32_t* const force_fcn_idx_data = next_section_array<int32_t>(section_data, offset, num_records);
+    const double* const param_data = next_section_array<double>(section_data, offset, 2 * num_records);
+    const uint64_t* const extra_param_offsets = next_section_array<uint64_t>(section_data, offset, num_records + 1);
+    if (offset > size || extra_param_offsets[num_records] > (size - offset) / sizeof(double))
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid spring section in binary structure file " << filename << std::endl);
+    }
+    const double* const extra_param_data =
+        next_section_array<double>(section_data, offset, extra_param_offsets[num_records]);
+
+    bool warned = false;
+    for (uint64_t k = 0; k < num_records; ++k)
+    {
+        Edge e(idx_data[2 * k], idx_data[2 * k + 1]);
+        if ((e.first < 0) || (e.first >= max_idx) || (e.second < 0) || (e.second >= max_idx))
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry for spring " << k << " in binary structure file "
+                                     << filename
+                                     << std::endl
+                                     << "  vertex index "
+                                     << ((e.first < 0) || (e.first >= max_idx) ? e.first : e.second)
+                                     << " is out of range"
+                                     << std::endl);
+        }
+        if (param_data[2 * k] < 0.0 || param_data[2 * k + 1] < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry for spring " << k << " in binary structure file "
+                                     << filename
+                                     << std::endl
+                                     << (param_data[2 * k] < 0.0 ? "  spring constant is negative" :
+                                                                   "  spring resting length is negative")
+                                     << std::endl);
+        }
+        if (extra_param_offsets[k] > extra_param_offsets[k + 1])
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid spring section in binary structure file " << filename
+                                     << std::endl);
+        }
+        std::vector<double> parameters(2);
+        parameters[0] = param_data[2 * k];
+        parameters[1] = d_length_scale_factor * param_data[2 * k + 1];
+        parameters.insert(parameters.end(),
+                          extra_param_data + extra_param_offsets[k],
+                          extra_param_data + extra_param_offsets[k + 1]);
+        addSpringSpecData(ln, j, e, parameters, force_fcn_idx_data[k], filename, input_uses_global_idxs, warned);
+    }
+
+    plog << d_object_name << ":  "
+         << "read " << num_records << " edges from binary input file named " << filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+    return true;
+} // readBinarySpringData
+
+bool
+IBStandardInitializer::readBinaryBeamData(const int ln,
+                                          const unsigned int j,
+                                          const int max_idx,
+                                          const bool input_uses_global_idxs)
+{
+    const BinaryStructureFile* const structure_file = d_binary_structure_files[ln][j];
+    if (!structure_file) return false;
+    uint64_t num_records, size;
+    const char* const section_data = structure_file->getSection(BEAM_SECTION, num_records, size);
+    if (!section_data) return false;
+    const std::string& filename = structure_file->getFilename();
+    plog << d_object_name << ":  "
+         << "processing beam data from binary input file named " << filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+    // Each beam record consists of three vertex indices, a bending rigidity,
+    // and a curvature.
+    static const size_t beam_record_size = 3 * sizeof(int32_t) + (1 + NDIM) * sizeof(double);
+    if (num_records > size / beam_record_size)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid beam section in binary structure file " << filename << std::endl);
+    }
+    uint64_t offset = 0;
+    const int32_t* const idx_data = next_section_array<int32_t>(section_data, offset, 3 * num_records);
+    const double* const bend_data = next_section_array<double>(section_data, offset, num_records);
+    const double* const curv_data = next_section_array<double>(section_data, offset, NDIM * num_records);
+    if (offset > size)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid beam section in binary structure file " << filename << std::endl);
+    }
+
+    bool warned = false;
+    for (uint64_t k = 0; k < num_records; ++k)
+    {
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            if ((idx_data[3 * k + i] < 0) || (idx_data[3 * k + i] >= max_idx))
+            {
+                TBOX_ERROR(d_object_name << ":\n  Invalid entry for beam " << k << " in binary structure file "
+                                         << filename
+                                         << std::endl
+                                         << "  vertex index "
+                                         << idx_data[3 * k + i]
+                                         << " is out of range"
+                                         << std::endl);
+            }
+        }
+        if (bend_data[k] < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry for beam " << k << " in binary structure file "
+                                     << filename
+                                     << std::endl
+                                     << "  beam constant is negative"
+                                     << std::endl);
+        }
+        Vector curv;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            curv[d] = curv_data[NDIM * k + d];
+        }
+        addBeamSpecData(ln,
+                        j,
+                        idx_data[3 * k],
+                        idx_data[3 * k + 1],
+                        idx_data[3 * k + 2],
+                        bend_data[k],
+                        curv,
+                        filename,
+                        input_uses_global_idxs,
+                        warned);
+    }
+
+    plog << d_object_name << ":  "
+         << "read " << num_records << " beams from binary input file named " << filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+    return true;
+} // readBinaryBeamData
+
+bool
+IBStandardInitializer::readBinaryTargetPointData(const int ln, const unsigned int j, const int max_idx)
+{
+    const BinaryStructureFile* const structure_file = d_binary_structure_files[ln][j];
+    if (!structure_file) return false;
+    uint64_t num_records, size;
+    const char* const section_data = structure_file->getSection(TARGET_POINT_SECTION, num_records, size);
+    if (!section_data) return false;
+    const std::string& filename = structure_file->getFilename();
+    plog << d_object_name << ":  "
+         << "processing target point data from binary input file named " << filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+    // Each target point record consists of a vertex index, a stiffness, and a
+    // damping coefficient.
+    static const size_t target_point_record_size = sizeof(int32_t) + 2 * sizeof(double);
+    if (num_records > size / target_point_record_size)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid target point section in binary structure file " << filename
+                                 << std::endl);
+    }
+    uint64_t offset = 0;
+    const int32_t* const idx_data = next_section_array<int32_t>(section_data, offset, num_records);
+    const double* const param_data = next_section_array<double>(section_data, offset, 2 * num_records);
+    if (offset > size)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid target point section in binary structure file " << filename
+                                 << std::endl);
+    }
+
+    bool warned = false;
+    std::vector<bool> is_target_point(max_idx, false);
+    for (uint64_t k = 0; k < num_records; ++k)
+    {
+        const int n = idx_data[k];
+        if ((n < 0) || (n >= max_idx))
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry for target point " << k << " in binary structure file "
+                                     << filename
+                                     << std::endl
+                                     << "  vertex index "
+                                     << n
+                                     << " is out of range"
+                                     << std::endl);
+        }
+        if (is_target_point[n])
+        {
+            TBOX_WARNING(d_object_name << ":\n  Duplicate target point node " << n
+                                       << " encountered in binary input file named "
+                                       << filename
+                                       << ".\n"
+                                       << "  Skipping duplicated point."
+                                       << std::endl);
+            continue;
+        }
+        is_target_point[n] = true;
+        const double kappa = param_data[2 * k], eta = param_data[2 * k + 1];
+        if (kappa < 0.0 || eta < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry for target point " << k << " in binary structure file "
+                                     << filename
+                                     << std::endl
+                                     << (kappa < 0.0 ? "  target point spring constant is negative" :
+                                                       "  target point damping coefficient is negative")
+                                     << std::endl);
+        }
+        d_target_spec_data[ln][j][n].stiffness = kappa;
+        d_target_spec_data[ln][j][n].damping = eta;
+
+        // Check to see if the penalty spring constant is zero and, if so, emit
+        // a warning.
+        if (!warned && d_enable_target_points[ln][j] && (kappa == 0.0 || MathUtilities<double>::equalEps(kappa, 0.0)))
+        {
+            TBOX_WARNING(d_object_name << ":\n  Target point with zero penalty spring constant encountered in "
+                                          "binary input file named "
+                                       << filename
+                                       << "."
+                                       << std::endl);
+            warned = true;
+        }
+    }
+
+    plog << d_object_name << ":  "
+         << "read " << num_records << " target points from binary input file named " << filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+    return true;
+} // readBinaryTargetPointData
+
 void
 IBStandardInitializer::readRodFiles(const std::string& extension, const bool input_uses_global_idxs)
 {
@@ -2021,18 +3357,21 @@ IBStandardInitializer::readTargetPointFiles(const std::string& extension)
             const int min_idx = 0;
             const int max_idx = d_num_vertex[ln][j];
 
-            // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
-
             std::set<int> target_point_idxs;
             TargetSpec default_spec;
             default_spec.stiffness = 0.0;
             default_spec.damping = 0.0;
             d_target_spec_data[ln][j].resize(d_num_vertex[ln][j], default_spec);
 
+            // Use the binary structure file if it provides the target point data.
+            const bool read_binary = d_use_binary_structure_files && readBinaryTargetPointData(ln, j, max_idx);
+
+            // Wait for the previous MPI process to finish reading the current file.
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+
             const std::string target_point_stiffness_filename = d_base_filename[ln][j] + extension;
             std::ifstream file_stream;
-            file_stream.open(target_point_stiffness_filename.c_str(), std::ios::in);
+            if (!read_binary) file_stream.open(target_point_stiffness_filename.c_str(), std::ios::in);
             if (file_stream.is_open())
             {
                 plog << d_object_name << ":  "
@@ -2196,7 +3535,7 @@ IBStandardInitializer::readTargetPointFiles(const std::string& extension)
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
@@ -3213,6 +4552,21 @@ IBStandardInitializer::getPatchVerticesAtLevel(std::vector<std::pair<int, int> >
     const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
     for (unsigned int j = 0; j < d_num_vertex[vertex_level_number].size(); ++j)
     {
+        if (d_use_parallel_file_parser)
+        {
+            // Only the vertices stored on this process are considered.
+            const std::map<int, Point>& local_vertex_posn = d_local_vertex_posn[vertex_level_number][j];
+            for (std::map<int, Point>::const_iterator it = local_vertex_posn.begin(); it != local_vertex_posn.end();
+                 ++it)
+            {
+                std::pair<int, int> point_index(j, it->first);
+                const Point& X = getShiftedVertexPosn(
+                    point_index, vertex_level_number, domain_x_lower, domain_x_upper, periodic_shift);
+                const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
+                if (patch_box.contains(idx)) patch_vertices.push_back(point_index);
+            }
+            continue;
+        }
         for (int k = 0; k < d_num_vertex[vertex_level_number][j]; ++k)
         {
             std::pair<int, int> point_index(j, k);
@@ -3234,6 +4588,15 @@ IBStandardInitializer::getCanonicalLagrangianIndex(const std::pair<int, int>& po
 Point
 IBStandardInitializer::getVertexPosn(const std::pair<int, int>& point_index, const int level_number) const
 {
+    if (d_use_parallel_file_parser)
+    {
+        const std::map<int, Point>::const_iterator it =
+            d_local_vertex_posn[level_number][point_index.first].find(point_index.second);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(it != d_local_vertex_posn[level_number][point_index.first].end());
+#endif
+        return it->second;
+    }
     return d_vertex_posn[level_number][point_index.first][point_index.second];
 } // getVertexPosn
 
@@ -3503,6 +4866,14 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
 
+    // Determine whether to parse the vertex, spring, and beam files in parallel.
+    if (db->keyExists("use_parallel_file_parser"))
+        d_use_parallel_file_parser = db->getBool("use_parallel_file_parser");
+
+    // Determine whether to read structure data from binary structure files.
+    if (db->keyExists("use_binary_structure_files"))
+        d_use_binary_structure_files = db->getBool("use_binary_structure_files");
+
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
     // particular level of the grid.
@@ -3530,6 +4901,7 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     d_num_vertex.resize(d_max_levels);
     d_vertex_offset.resize(d_max_levels);
     d_vertex_posn.resize(d_max_levels);
+    d_local_vertex_posn.resize(d_max_levels);
 
     d_enable_springs.resize(d_max_levels);
     d_spring_edge_map.resize(d_max_levels);
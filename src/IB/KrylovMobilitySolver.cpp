@@ -34,6 +34,9 @@
 
 #include <limits>
 
+#include "CartesianGridGeometry.h"
+#include "IntVector.h"
+#include "PatchLevel.h"
 #include "ibamr/CIBStrategy.h"
 #include "ibamr/IBStrategy.h"
 #include "ibamr/INSStaggeredHierarchyIntegrator.h"
@@ -41,6 +44,7 @@
 #include "ibamr/StaggeredStokesBlockPreconditioner.h"
 #include "ibamr/StaggeredStokesSolver.h"
 #include "ibamr/StaggeredStokesSolverManager.h"
+#include "ibamr/StokesSpecifications.h"
 #include "ibamr/namespaces.h"
 #include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/LinearSolver.h"
@@ -107,6 +111,9 @@ KrylovMobilitySolver::KrylovMobilitySolver(const std::string& object_name,
     d_scale_interp = 1.0;
     d_scale_spread = 1.0;
     d_reg_mob_factor = 0.0;
+    d_use_rpy_operator = false;
+    d_rpy_opening_angle = 0.5;
+    d_f_periodic_corr = 0.0;
     d_max_iterations = 10000;
     d_abs_residual_tol = 1.0e-50;
     d_rel_residual_tol = 1.0e-5;
@@ -570,6 +577,10 @@ KrylovMobilitySolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("normalize_pressure")) d_normalize_pressure = input_db->getBool("normalize_pressure");
     if (input_db->keyExists("normalize_velocity")) d_normalize_velocity = input_db->getBool("normalize_velocity");
     if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    if (input_db->keyExists("use_rpy_operator")) d_use_rpy_operator = input_db->getBool("use_rpy_operator");
+    if (input_db->keyExists("rpy_opening_angle")) d_rpy_opening_angle = input_db->getDouble("rpy_opening_angle");
+    if (input_db->keyExists("f_periodic_correction"))
+        d_f_periodic_corr = input_db->getDouble("f_periodic_correction");
 } // getFromInput
 
 void
@@ -929,6 +940,31 @@ KrylovMobilitySolver::MatVecMult_KMInv(Mat A, Vec x, Vec y)
     static const double delta = solver->d_reg_mob_factor;
     const double half_time = 0.5 * (solver->d_new_time + solver->d_current_time);
 
+    // Set y:= [M_rpy + \delta]x when the RPY approximation of the mobility is
+    // used.
+    if (solver->d_use_rpy_operator)
+    {
+        Pointer<PatchLevel<NDIM> > struct_patch_level =
+            solver->d_hierarchy->getPatchLevel(solver->d_hierarchy->getFinestLevelNumber());
+        const IntVector<NDIM>& ratio = struct_patch_level->getRatio();
+        Pointer<CartesianGridGeometry<NDIM> > grid_geom = solver->d_hierarchy->getGridGeometry();
+        const double* dx0 = grid_geom->getDx();
+        double dx[NDIM];
+        for (int d = 0; d < NDIM; ++d) dx[d] = dx0[d] / ratio(d);
+        const double mu = solver->d_ins_integrator->getStokesSpecifications()->getMu();
+        solver->d_cib_strategy->applyRPYMobility(
+            y, x, dx, mu, solver->d_f_periodic_corr, solver->d_rpy_opening_angle, beta * gamma);
+        if (!MathUtilities<double>::equalEps(delta, 0.0))
+        {
+            Vec D;
+            VecDuplicate(x, &D);
+            solver->d_cib_strategy->computeMobilityRegularization(D, x, delta);
+            VecAXPY(y, beta, D);
+            VecDestroy(&D);
+        }
+        PetscFunctionReturn(0);
+    }
+
     // Use homogeneous BCs with Stokes solver in the preconditioner.
     dynamic_cast<IBTK::LinearSolver*>(solver->d_LInv.getPointer())->setHomogeneousBc(true);
 
@@ -36,6 +36,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <algorithm>
+#include <vector>
 
 #include "ibamr/MobilityFunctions.h"
 
@@ -115,6 +117,181 @@ get_sqnorm(const double* a_vec)
     return -1.0;
 } // get_sqnorm
 
+// Parameters of the cluster tree used by the matrix-free RPY mobility.
+const int RPY_TREE_LEAF_SIZE = 32;
+const int RPY_TREE_MAX_DEPTH = 32;
+const int RPY_TREE_NUM_CHILDREN = 1 << NDIM;
+const int RPY_TARGET_CHUNK_SIZE = 64;
+
+// Node of the cluster tree.  The markers of the node are perm[begin], ...,
+// perm[end-1].  The force moments are taken about the centroid of the markers.
+struct RPYTreeNode
+{
+    int begin, end;
+    int child[RPY_TREE_NUM_CHILDREN];
+    bool is_leaf;
+    double center[NDIM];
+    double radius;
+    double force[NDIM];
+    double dipole[NDIM][NDIM]; // dipole[k][j] = sum (X_k - center_k) F_j
+};
+
+// Recursively builds the cluster tree over perm[begin], ..., perm[end-1] and
+// returns the index of the root of the subtree.
+int
+buildRPYTree(std::vector<RPYTreeNode>& tree,
+             std::vector<int>& perm,
+             std::vector<int>& perm_scratch,
+             const double* X,
+             const double* F,
+             const int begin,
+             const int end,
+             const double* lower,
+             const double* upper,
+             const int depth)
+{
+    const int node_idx = static_cast<int>(tree.size());
+    tree.push_back(RPYTreeNode());
+    RPYTreeNode node;
+    node.begin = begin;
+    node.end = end;
+    node.radius = 0.0;
+    for (int c = 0; c < RPY_TREE_NUM_CHILDREN; ++c) node.child[c] = -1;
+    for (int d = 0; d < NDIM; ++d)
+    {
+        node.center[d] = 0.0;
+        node.force[d] = 0.0;
+        for (int e = 0; e < NDIM; ++e) node.dipole[d][e] = 0.0;
+    }
+
+    // Compute the centroid, radius, and force moments of the cluster.
+    for (int n = begin; n < end; ++n)
+    {
+        for (int d = 0; d < NDIM; ++d) node.center[d] += X[perm[n] * NDIM + d];
+    }
+    for (int d = 0; d < NDIM; ++d) node.center[d] /= static_cast<double>(end - begin);
+    for (int n = begin; n < end; ++n)
+    {
+        const double* x = &X[perm[n] * NDIM];
+        const double* f = &F[perm[n] * NDIM];
+        double r_vec[NDIM];
+        for (int d = 0; d < NDIM; ++d) r_vec[d] = x[d] - node.center[d];
+        node.radius = std::max(node.radius, sqrt(get_sqnorm(r_vec)));
+        for (int d = 0; d < NDIM; ++d)
+        {
+            node.force[d] += f[d];
+            for (int e = 0; e < NDIM; ++e) node.dipole[d][e] += r_vec[d] * f[e];
+        }
+    }
+    node.is_leaf = (end - begin <= RPY_TREE_LEAF_SIZE) || (depth >= RPY_TREE_MAX_DEPTH);
+    tree[node_idx] = node;
+    if (node.is_leaf) return node_idx;
+
+    // Sort the markers into the 2^NDIM subboxes of the bounding box.
+    double mid[NDIM];
+    for (int d = 0; d < NDIM; ++d) mid[d] = 0.5 * (lower[d] + upper[d]);
+    int child_count[RPY_TREE_NUM_CHILDREN + 1];
+    for (int c = 0; c <= RPY_TREE_NUM_CHILDREN; ++c) child_count[c] = 0;
+    for (int n = begin; n < end; ++n)
+    {
+        int c = 0;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            if (X[perm[n] * NDIM + d] >= mid[d]) c |= (1 << d);
+        }
+        perm_scratch[n] = c;
+        ++child_count[c + 1];
+    }
+    for (int c = 0; c < RPY_TREE_NUM_CHILDREN; ++c) child_count[c + 1] += child_count[c];
+    std::vector<int> sorted(end - begin);
+    int child_offset[RPY_TREE_NUM_CHILDREN];
+    for (int c = 0; c < RPY_TREE_NUM_CHILDREN; ++c) child_offset[c] = child_count[c];
+    for (int n = begin; n < end; ++n)
+    {
+        sorted[child_offset[perm_scratch[n]]++] = perm[n];
+    }
+    std::copy(sorted.begin(), sorted.end(), perm.begin() + begin);
+
+    for (int c = 0; c < RPY_TREE_NUM_CHILDREN; ++c)
+    {
+        const int child_begin = begin + child_count[c];
+        const int child_end = begin + child_count[c + 1];
+        if (child_begin == child_end) continue;
+        double child_lower[NDIM], child_upper[NDIM];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            child_lower[d] = (c & (1 << d)) ? mid[d] : lower[d];
+            child_upper[d] = (c & (1 << d)) ? upper[d] : mid[d];
+        }
+        const int child_idx = buildRPYTree(
+            tree, perm, perm_scratch, X, F, child_begin, child_end, child_lower, child_upper, depth + 1);
+        tree[node_idx].child[c] = child_idx;
+    }
+    return node_idx;
+} // buildRPYTree
+
+// Adds the velocity induced at separation r_vec by the force f according to
+// the RPY tensor (without periodic correction).
+inline void
+addRPYPairVelocity(const double* r_vec, const double* f, const double mu_tt, const double hrad, double* u)
+{
+    const double rsq = get_sqnorm(r_vec);
+    if (rsq == 0.0)
+    {
+        for (int d = 0; d < NDIM; ++d) u[d] += mu_tt * f[d];
+        return;
+    }
+    const double r = sqrt(rsq);
+    double c_iso, c_dyad;
+    if (r <= 2.0 * hrad)
+    {
+        c_iso = mu_tt * (1.0 - 9.0 / 32.0 * r / hrad);
+        c_dyad = mu_tt * 3.0 * r / 32. / hrad;
+    }
+    else
+    {
+        const double cube = hrad * hrad * hrad / r / r / r;
+        c_iso = mu_tt * (3.0 / 4.0 * hrad / r + 1.0 / 2.0 * cube);
+        c_dyad = mu_tt * (3.0 / 4.0 * hrad / r - 3.0 / 2.0 * cube);
+    }
+    double r_dot_f = 0.0;
+    for (int d = 0; d < NDIM; ++d) r_dot_f += r_vec[d] * f[d];
+    for (int d = 0; d < NDIM; ++d) u[d] += c_iso * f[d] + c_dyad * r_dot_f * r_vec[d] / rsq;
+    return;
+} // addRPYPairVelocity
+
+// Adds the velocity induced at separation r_vec from the centroid of a well
+// separated cluster: the RPY tensor applied to the net force plus the
+// Oseen-gradient correction due to the force dipole of the cluster.
+inline void
+addRPYClusterVelocity(const double* r_vec, const RPYTreeNode& node, const double mu_tt, const double hrad, double* u)
+{
+    addRPYPairVelocity(r_vec, node.force, mu_tt, hrad, u);
+
+    const double rsq = get_sqnorm(r_vec);
+    const double r = sqrt(rsq);
+    const double oseen_fac = 3.0 / 4.0 * hrad * mu_tt / (rsq * r); // 1/(8 pi mu r^3)
+    double trace = 0.0, r_D_r = 0.0;
+    double D_r[NDIM], DT_r[NDIM];
+    for (int i = 0; i < NDIM; ++i)
+    {
+        trace += node.dipole[i][i];
+        D_r[i] = 0.0;
+        DT_r[i] = 0.0;
+        for (int j = 0; j < NDIM; ++j)
+        {
+            D_r[i] += node.dipole[i][j] * r_vec[j];
+            DT_r[i] += node.dipole[j][i] * r_vec[j];
+        }
+        r_D_r += r_vec[i] * D_r[i];
+    }
+    for (int i = 0; i < NDIM; ++i)
+    {
+        u[i] -= oseen_fac * (D_r[i] - DT_r[i] + r_vec[i] * (trace - 3.0 * r_D_r / rsq));
+    }
+    return;
+} // addRPYClusterVelocity
+
 // Returns a value based on linear interpolation of array.
 double
 InterpolateLinear(const double* Xin, const double* Yin, const int N, double X0)
@@ -697,6 +874,109 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
     return;
 } // constructRPYMobilityMatrix
 
+void
+MobilityFunctions::applyRPYMobility(const char* IBKernelName,
+                                    const double MU,
+                                    const double DX,
+                                    const double* X,
+                                    const double* F,
+                                    const int N,
+                                    const double PERIODIC_CORRECTION,
+                                    const double OPENING_ANGLE,
+                                    const int TARGET_BEGIN,
+                                    const int TARGET_END,
+                                    double* U)
+{
+    const double hrad = getHydroRadius(IBKernelName) * DX;
+    const double mu_tt = 1. / (6.0 * M_PI * MU * hrad);
+    const int num_targets = TARGET_END - TARGET_BEGIN;
+    for (int k = 0; k < num_targets * NDIM; ++k) U[k] = 0.0;
+    if (N == 0 || num_targets <= 0) return;
+
+    // Build the cluster tree over all of the markers.
+    double lower[NDIM], upper[NDIM];
+    for (int d = 0; d < NDIM; ++d)
+    {
+        lower[d] = X[d];
+        upper[d] = X[d];
+    }
+    for (int n = 1; n < N; ++n)
+    {
+        for (int d = 0; d < NDIM; ++d)
+        {
+            lower[d] = std::min(lower[d], X[n * NDIM + d]);
+            upper[d] = std::max(upper[d], X[n * NDIM + d]);
+        }
+    }
+    std::vector<RPYTreeNode> tree;
+    tree.reserve(2 * (N / RPY_TREE_LEAF_SIZE + 1));
+    std::vector<int> perm(N), perm_scratch(N);
+    for (int n = 0; n < N; ++n) perm[n] = n;
+    buildRPYTree(tree, perm, perm_scratch, X, F, 0, N, lower, upper, 0);
+
+    // Store the markers in tree order so that the direct sums over leaves
+    // access contiguous memory, and visit the target markers in the same order
+    // so that consecutive targets traverse similar parts of the tree.
+    std::vector<double> X_sorted(N * NDIM), F_sorted(N * NDIM);
+    std::vector<int> targets;
+    targets.reserve(num_targets);
+    for (int n = 0; n < N; ++n)
+    {
+        for (int d = 0; d < NDIM; ++d)
+        {
+            X_sorted[n * NDIM + d] = X[perm[n] * NDIM + d];
+            F_sorted[n * NDIM + d] = F[perm[n] * NDIM + d];
+        }
+        if (perm[n] >= TARGET_BEGIN && perm[n] < TARGET_END) targets.push_back(perm[n]);
+    }
+
+    // The net force is needed for the periodic correction.
+    const double* const net_force = tree[0].force;
+
+    // Traverse the tree for each target marker.  Well separated clusters are
+    // approximated by their force moments; all other interactions are summed
+    // directly.
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, RPY_TARGET_CHUNK_SIZE)
+#endif
+    for (int t = 0; t < num_targets; ++t)
+    {
+        const double* x = &X[targets[t] * NDIM];
+        double* u = &U[(targets[t] - TARGET_BEGIN) * NDIM];
+        int stack[RPY_TREE_MAX_DEPTH * RPY_TREE_NUM_CHILDREN + 1];
+        int stack_size = 0;
+        stack[stack_size++] = 0;
+        while (stack_size > 0)
+        {
+            const RPYTreeNode& node = tree[stack[--stack_size]];
+            double r_vec[NDIM];
+            for (int d = 0; d < NDIM; ++d) r_vec[d] = x[d] - node.center[d];
+            const double dist = sqrt(get_sqnorm(r_vec));
+            if (node.radius < OPENING_ANGLE * dist && dist - node.radius > 2.0 * hrad)
+            {
+                addRPYClusterVelocity(r_vec, node, mu_tt, hrad, u);
+            }
+            else if (node.is_leaf)
+            {
+                for (int n = node.begin; n < node.end; ++n)
+                {
+                    for (int d = 0; d < NDIM; ++d) r_vec[d] = x[d] - X_sorted[n * NDIM + d];
+                    addRPYPairVelocity(r_vec, &F_sorted[n * NDIM], mu_tt, hrad, u);
+                }
+            }
+            else
+            {
+                for (int c = 0; c < RPY_TREE_NUM_CHILDREN; ++c)
+                {
+                    if (node.child[c] >= 0) stack[stack_size++] = node.child[c];
+                }
+            }
+        }
+        for (int d = 0; d < NDIM; ++d) u[d] -= PERIODIC_CORRECTION * net_force[d];
+    }
+    return;
+} // applyRPYMobility
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // IBAMR
@@ -32,6 +32,9 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <vector>
+
 #include "ibamr/NonbondedForceEvaluator.h"
 #include "ibamr/namespaces.h"
 #include "ibtk/LNodeSetData.h"
@@ -42,10 +45,47 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Number of pairs passed to the force function at a time.
+static const int PAIR_BATCH_SIZE = 1024;
+
+inline int
+floor_div(const int a, const int b)
+{
+    return (a >= 0 ? a / b : -((-a + b - 1) / b));
+} // floor_div
+
+// Lexicographic comparison of cell indices.
+inline int
+compare_indices(const Index<NDIM>& i, const Index<NDIM>& j)
+{
+    for (int d = NDIM - 1; d >= 0; --d)
+    {
+        if (i(d) != j(d)) return (i(d) < j(d) ? -1 : 1);
+    }
+    return 0;
+} // compare_indices
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
                                                  Pointer<CartesianGridGeometry<NDIM> > grid_geometry)
+    : d_force_type(0),
+      d_interaction_radius(0.0),
+      d_regrid_alpha(0.0),
+      d_parameters(),
+      d_grid_geometry(),
+      d_force_fcn_ptr(NULL),
+      d_batch_force_fcn_ptr(NULL),
+      d_use_verlet_lists(false),
+      d_cutoff_distance(0.0),
+      d_verlet_skin(0.0),
+      d_cell_lists(),
+      d_pair_lists(),
+      d_D_batch(),
+      d_F_batch()
 {
     // get interaction radius
     if (input_db->keyExists("interaction_radius"))
@@ -75,6 +115,22 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
 
     // get parameters for force function
     d_parameters = input_db->getDoubleArray("parameters");
+
+    // get Verlet list settings.  Verlet lists require the distance beyond
+    // which the force function vanishes.
+    if (input_db->keyExists("use_verlet_lists")) d_use_verlet_lists = input_db->getBool("use_verlet_lists");
+    if (d_use_verlet_lists)
+    {
+        if (input_db->keyExists("cutoff_distance"))
+        {
+            d_cutoff_distance = input_db->getDouble("cutoff_distance");
+        }
+        else
+        {
+            TBOX_ERROR("Must specify cutoff_distance for NonbondedForceEvaluator when using Verlet lists.");
+        }
+        if (input_db->keyExists("verlet_skin")) d_verlet_skin = input_db->getDouble("verlet_skin");
+    }
 }
 
 void
@@ -147,94 +203,64 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
 
-    // These will only work if the domain is a single box.
-    assert(grid_geom->getDomainIsSingleBox());
-    const double* const x_lower = grid_geom->getXLower();
-    const double* const x_upper = grid_geom->getXUpper();
-    const double* const domain_dx = grid_geom->getDx();
-
-    // Maximum index in our domain.
-    std::vector<int> max_cell_idx(NDIM);
-    for (int k = 0; k < NDIM; ++k)
-    {
-        max_cell_idx[k] = int((x_upper[k] - x_lower[k]) / domain_dx[k]);
-    }
-
     // we will grow the search box by interaction_radius + 2.0*regrid_alpha
     IntVector<NDIM> grow_amount(int(ceil(d_interaction_radius + 2.0 * d_regrid_alpha)));
     const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
 
-    // iterate through levels.
+    // Get the node positions and forces, including ghost nodes.
+    const double* const X = X_data->getGhostedLocalFormVecArray()->data();
+    double* const F = F_data->getGhostedLocalFormVecArray()->data();
+
+    // Build the cell list for each patch, reuse or rebuild the pair list, and
+    // evaluate the forces.
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    const Box<NDIM>& domain_box = level->getPhysicalDomain()[0];
+    if (static_cast<int>(d_cell_lists.size()) <= level_number)
     {
+        d_cell_lists.resize(level_number + 1);
+        d_pair_lists.resize(level_number + 1);
+    }
+    std::vector<CellList>& cell_lists = d_cell_lists[level_number];
+    std::vector<PairList>& pair_lists = d_pair_lists[level_number];
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        if (static_cast<int>(cell_lists.size()) <= local_patch_num)
+        {
+            cell_lists.resize(local_patch_num + 1);
+            pair_lists.resize(local_patch_num + 1);
+        }
+        CellList& cell_list = cell_lists[local_patch_num];
+        PairList& pair_list = pair_lists[local_patch_num];
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
-        const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-        const double* const patch_dx = patch_geom->getDx();
-
-        std::vector<int> cell_offset(NDIM);
-        // Loop through cells in this processors patch. For each iteration, this
-        // is the "master" cell. Iterate through particles in the box, and add
-        // springs.
-        for (LNodeSetData::CellIterator cit(patch_box); cit; cit++)
+        buildCellList(cell_list, patch, domain_box, lag_node_idx_current_idx, grow_amount);
+        if (d_use_verlet_lists)
         {
-            // get list of particles in this cell
-            const Index<NDIM>& first_cell_idx = *cit;
-            LNodeSet* const mstr_node_set = current_idx_data->getItem(first_cell_idx);
-            if (mstr_node_set)
+            if (!verletListIsValid(pair_list, cell_list, X))
             {
-                Box<NDIM> search_box(first_cell_idx, first_cell_idx);
-                // loop over neighboring cells, up to interaction_radius +
-                // 2*regrid_alpha away.
-                for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
+                buildPairList(
+                    pair_list, cell_list, patch->getBox(), grow_amount, X, d_cutoff_distance + d_verlet_skin);
+                pair_list.cell_start = cell_list.cell_start;
+                pair_list.petsc_idxs = cell_list.petsc_idxs;
+                pair_list.X0.resize(NDIM * cell_list.petsc_idxs.size());
+                for (unsigned int k = 0; k < cell_list.petsc_idxs.size(); ++k)
                 {
-                    // loop over particles in the neighbor cell, adding up
-                    // forces onto the particle in the "master" cell At this
-                    // point we know both cells, need to figure out periodic
-                    // additions.
-                    const Index<NDIM>& search_cell_idx = *scit;
-
-                    // search across periodic boundaries.
-                    for (int k = 0; k < NDIM; ++k)
+                    for (int d = 0; d < NDIM; ++d)
                     {
-                        // Difference between lower boundary and this search cell.
-                        double absolute_diff = search_cell_idx[k] * patch_dx[k];
-                        // Periodic offset of this cell.
-                        cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
+                        pair_list.X0[NDIM * k + d] = X[NDIM * cell_list.petsc_idxs[k] + d];
                     }
-                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-                    if (search_node_set)
-                    {
-                        // we have a set of nodes in the first cell and the search cell,
-                        // add up forces
-                        // and accumulate for the first cell.
-                        for (LNodeSet::iterator it = mstr_node_set->begin(); it != mstr_node_set->end(); ++it)
-                        {
-                            // master nodes
-                            LNodeSet::value_type& mstr_node_idx = *it;
-                            const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
-                            const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
-
-                            for (LNodeSet::iterator sit = search_node_set->begin(); sit != search_node_set->end();
-                                 ++sit)
-                            {
-                                LNodeSet::value_type& search_node_idx = *sit;
-                                const int search_lag_idx = search_node_idx->getLagrangianIndex();
-                                const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
-                                if (mstr_lag_idx < search_lag_idx)
-                                {
-                                    // apply forces with the force evaluator
-                                    evaluateForces(mstr_petsc_idx, search_petsc_idx, X_data, cell_offset, F_data);
-                                }
-                            } // search node index
-                        }     // mstr node index
-                    }         // if(search node set)
-                }             // search cell loop
-            }                 // if mastr_node_idx
-        }                     // first cell
-    }                         // patches
+                }
+                pair_list.valid = true;
+            }
+        }
+        else
+        {
+            buildPairList(pair_list, cell_list, patch->getBox(), grow_amount, X, 0.0);
+        }
+        evaluatePairForces(pair_list, X, F);
+    }
+    X_data->restoreArrays();
+    F_data->restoreArrays();
     return;
 } // computeLagrangianForce
 
@@ -246,6 +272,210 @@ NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
     return;
 } // registerForceFcnPtr
 
+void
+NonbondedForceEvaluator::registerBatchForceFcnPtr(NonBddBatchForceFcnPtr batch_force_fcn_ptr)
+{
+    // set the batched nonbonded force function pointer to the given force function pointer
+    d_batch_force_fcn_ptr = batch_force_fcn_ptr;
+    return;
+} // registerBatchForceFcnPtr
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+NonbondedForceEvaluator::buildCellList(CellList& cell_list,
+                                       Pointer<Patch<NDIM> > patch,
+                                       const Box<NDIM>& domain_box,
+                                       const int lag_node_idx_current_idx,
+                                       const IntVector<NDIM>& grow_amount)
+{
+    // The cell list covers the patch box grown by the search width.
+    Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
+    cell_list.box = Box<NDIM>::grow(patch->getBox(), grow_amount) * current_idx_data->getGhostBox();
+    const int num_cells = cell_list.box.size();
+    cell_list.cell_start.resize(num_cells + 1);
+    cell_list.petsc_idxs.clear();
+    cell_list.lag_idxs.clear();
+    cell_list.periodic_shifts.resize(NDIM * num_cells);
+
+    // Periodic shifts are computed from the integer cell indices.
+    const double* const x_lower = d_grid_geometry->getXLower();
+    const double* const x_upper = d_grid_geometry->getXUpper();
+    const IntVector<NDIM> domain_extents = domain_box.numberCells();
+    int cell = 0;
+    for (Box<NDIM>::Iterator b(cell_list.box); b; b++, ++cell)
+    {
+        const Index<NDIM>& i = b();
+        cell_list.cell_start[cell] = static_cast<int>(cell_list.petsc_idxs.size());
+        const LNodeSet* const node_set = current_idx_data->getItem(i);
+        if (node_set)
+        {
+            for (LNodeSet::const_iterator it = node_set->begin(); it != node_set->end(); ++it)
+            {
+                cell_list.petsc_idxs.push_back((*it)->getLocalPETScIndex());
+                cell_list.lag_idxs.push_back((*it)->getLagrangianIndex());
+            }
+        }
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const int offset = floor_div(i(d) - domain_box.lower()(d), domain_extents(d));
+            cell_list.periodic_shifts[NDIM * cell + d] = offset * (x_upper[d] - x_lower[d]);
+        }
+    }
+    cell_list.cell_start[num_cells] = static_cast<int>(cell_list.petsc_idxs.size());
+    return;
+} // buildCellList
+
+void
+NonbondedForceEvaluator::buildPairList(PairList& pair_list,
+                                       const CellList& cell_list,
+                                       const Box<NDIM>& patch_box,
+                                       const IntVector<NDIM>& grow_amount,
+                                       const double* const X,
+                                       const double cutoff)
+{
+    pair_list.mstr_petsc_idxs.clear();
+    pair_list.search_petsc_idxs.clear();
+    pair_list.shifts.clear();
+
+    // Strides of the cell list.
+    const Box<NDIM>& box = cell_list.box;
+    const IntVector<NDIM> extents = box.numberCells();
+    int strides[NDIM];
+    strides[0] = 1;
+    for (int d = 1; d < NDIM; ++d) strides[d] = strides[d - 1] * extents(d - 1);
+
+    // Loop through cells in this processors patch. For each iteration, this is
+    // the "master" cell.  Pairs in which both cells lie in the patch interior
+    // are visited only from the lexicographically smaller cell (a half-shell
+    // traversal).  Pairs within a single cell or involving cells outside the
+    // patch interior are included only once by ordering the nodes by their
+    // Lagrangian indices.
+    const double cutoff_sq = cutoff * cutoff;
+    for (Box<NDIM>::Iterator b(patch_box); b; b++)
+    {
+        const Index<NDIM>& mstr_cell_idx = b();
+        int mstr_cell = 0;
+        for (int d = 0; d < NDIM; ++d) mstr_cell += strides[d] * (mstr_cell_idx(d) - box.lower()(d));
+        const int mstr_begin = cell_list.cell_start[mstr_cell], mstr_end = cell_list.cell_start[mstr_cell + 1];
+        if (mstr_begin == mstr_end) continue;
+
+        const Box<NDIM> search_box = Box<NDIM>::grow(Box<NDIM>(mstr_cell_idx, mstr_cell_idx), grow_amount) * box;
+        for (Box<NDIM>::Iterator sb(search_box); sb; sb++)
+        {
+            const Index<NDIM>& search_cell_idx = sb();
+            const int cmp = compare_indices(search_cell_idx, mstr_cell_idx);
+            const bool search_interior = patch_box.contains(search_cell_idx);
+            if (search_interior && cmp < 0) continue;
+            const bool use_lag_order = !search_interior || cmp == 0;
+
+            int search_cell = 0;
+            for (int d = 0; d < NDIM; ++d) search_cell += strides[d] * (search_cell_idx(d) - box.lower()(d));
+            const int search_begin = cell_list.cell_start[search_cell];
+            const int search_end = cell_list.cell_start[search_cell + 1];
+            const double* const shift = &cell_list.periodic_shifts[NDIM * search_cell];
+            for (int m = mstr_begin; m < mstr_end; ++m)
+            {
+                const int mstr_petsc_idx = cell_list.petsc_idxs[m];
+                for (int n = search_begin; n < search_end; ++n)
+                {
+                    if (use_lag_order && cell_list.lag_idxs[m] >= cell_list.lag_idxs[n]) continue;
+                    const int search_petsc_idx = cell_list.petsc_idxs[n];
+                    if (cutoff > 0.0)
+                    {
+                        double R_sq = 0.0;
+                        for (int d = 0; d < NDIM; ++d)
+                        {
+                            const double D = X[NDIM * mstr_petsc_idx + d] - X[NDIM * search_petsc_idx + d] - shift[d];
+                            R_sq += D * D;
+                        }
+                        if (R_sq >= cutoff_sq) continue;
+                    }
+                    pair_list.mstr_petsc_idxs.push_back(mstr_petsc_idx);
+                    pair_list.search_petsc_idxs.push_back(search_petsc_idx);
+                    pair_list.shifts.insert(pair_list.shifts.end(), shift, shift + NDIM);
+                }
+            }
+        }
+    }
+    return;
+} // buildPairList
+
+bool
+NonbondedForceEvaluator::verletListIsValid(const PairList& pair_list,
+                                           const CellList& cell_list,
+                                           const double* const X) const
+{
+    // The list must be rebuilt whenever the nodes have been redistributed
+    // among the cells or any node has moved more than half the skin distance.
+    if (!pair_list.valid) return false;
+    if (pair_list.cell_start != cell_list.cell_start || pair_list.petsc_idxs != cell_list.petsc_idxs) return false;
+    const double max_displacement_sq = 0.25 * d_verlet_skin * d_verlet_skin;
+    for (unsigned int k = 0; k < cell_list.petsc_idxs.size(); ++k)
+    {
+        double displacement_sq = 0.0;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const double dX = X[NDIM * cell_list.petsc_idxs[k] + d] - pair_list.X0[NDIM * k + d];
+            displacement_sq += dX * dX;
+        }
+        if (displacement_sq > max_displacement_sq) return false;
+    }
+    return true;
+} // verletListIsValid
+
+void
+NonbondedForceEvaluator::evaluatePairForces(const PairList& pair_list, const double* const X, double* const F)
+{
+    const int num_pairs = static_cast<int>(pair_list.mstr_petsc_idxs.size());
+    for (int batch_begin = 0; batch_begin < num_pairs; batch_begin += PAIR_BATCH_SIZE)
+    {
+        const int batch_size = std::min(PAIR_BATCH_SIZE, num_pairs - batch_begin);
+        d_D_batch.resize(NDIM * batch_size);
+        d_F_batch.resize(NDIM * batch_size);
+
+        // Compute the vectors connecting the pairs of nodes.
+        for (int k = 0; k < batch_size; ++k)
+        {
+            const int pair = batch_begin + k;
+            const int mstr_petsc_idx = pair_list.mstr_petsc_idxs[pair];
+            const int search_petsc_idx = pair_list.search_petsc_idxs[pair];
+            for (int d = 0; d < NDIM; ++d)
+            {
+                d_D_batch[NDIM * k + d] =
+                    X[NDIM * mstr_petsc_idx + d] - X[NDIM * search_petsc_idx + d] - pair_list.shifts[NDIM * pair + d];
+            }
+        }
+
+        // Evaluate the forces.
+        if (d_batch_force_fcn_ptr)
+        {
+            (d_batch_force_fcn_ptr)(&d_D_batch[0], batch_size, d_parameters, &d_F_batch[0]);
+        }
+        else
+        {
+            for (int k = 0; k < batch_size; ++k)
+            {
+                (d_force_fcn_ptr)(&d_D_batch[NDIM * k], d_parameters, &d_F_batch[NDIM * k]);
+            }
+        }
+
+        // Accumulate the forces.
+        for (int k = 0; k < batch_size; ++k)
+        {
+            const int pair = batch_begin + k;
+            const int mstr_petsc_idx = pair_list.mstr_petsc_idxs[pair];
+            const int search_petsc_idx = pair_list.search_petsc_idxs[pair];
+            for (int d = 0; d < NDIM; ++d)
+            {
+                F[NDIM * mstr_petsc_idx + d] += d_F_batch[NDIM * k + d];
+                F[NDIM * search_petsc_idx + d] -= d_F_batch[NDIM * k + d];
+            }
+        }
+    }
+    return;
+} // evaluatePairForces
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -83,22 +83,6 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
-namespace
-{
-void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
-{
-    for (int depth = 0; depth < data.getDepth(); ++depth)
-    {
-        for (Box<NDIM>::Iterator i(box); i; i++)
-        {
-            RNG::genrandn(&data(i(), depth));
-        }
-    }
-    return;
-} // genrandn
-}
-
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 AdvDiffStochasticForcing::AdvDiffStochasticForcing(const std::string& object_name,
@@ -110,6 +94,7 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(const std::string& object_nam
       d_f_parser(),
       d_adv_diff_solver(adv_diff_solver),
       d_std(std::numeric_limits<double>::quiet_NaN()),
+      d_seed(-1),
       d_num_rand_vals(0),
       d_weights(),
       d_dirichlet_bc_scaling(sqrt(2.0)),
@@ -127,6 +112,7 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(const std::string& object_nam
     if (input_db)
     {
         if (input_db->keyExists("std")) d_std = input_db->getDouble("std");
+        if (input_db->keyExists("seed")) d_seed = input_db->getInteger("seed");
         if (input_db->keyExists("num_rand_vals")) d_num_rand_vals = input_db->getInteger("num_rand_vals");
         int k = 0;
         std::string key_name = "weights_0";
@@ -271,9 +257,13 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                                      << "  valid choices are: FORWARD_EULER, MIDPOINT_RULE, TRAPEZOIDAL_RULE\n");
         }
 
-        // Generate random components.
+        // Generate random components.  The values are determined by the seed,
+        // the time step number, and the grid index, so that they do not depend
+        // on the parallel decomposition.
         if (cycle_num == 0)
         {
+            const unsigned int seed = d_seed >= 0 ? static_cast<unsigned int>(d_seed) : RNG::global_seed();
+            const unsigned int step = static_cast<unsigned int>(d_adv_diff_solver->getIntegratorStep());
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -285,7 +275,11 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                         Pointer<SideData<NDIM, double> > F_sc_data = patch->getPatchData(d_F_sc_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(F_sc_data->getArrayData(d), SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d));
+                            RNG::genrandn(F_sc_data->getArrayData(d),
+                                          SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d),
+                                          seed,
+                                          step,
+                                          RNG::stream_id(k, level_num, d));
                         }
                     }
                 }
@@ -163,19 +163,6 @@ compute_tangential_extension(const Box<NDIM>& box, const int data_axis)
     extended_box.upper()(data_axis) += 1;
     return extended_box;
 } // compute_tangential_extension
-
-void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
-{
-    for (int depth = 0; depth < data.getDepth(); ++depth)
-    {
-        for (Box<NDIM>::Iterator i(box); i; i++)
-        {
-            RNG::genrandn(&data(i(), depth));
-        }
-    }
-    return;
-} // genrandn
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -187,6 +174,7 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(const std::string&
       d_fluid_solver(fluid_solver),
       d_stress_tensor_type(UNCORRELATED),
       d_std(std::numeric_limits<double>::quiet_NaN()),
+      d_seed(-1),
       d_num_rand_vals(0),
       d_weights(),
       d_velocity_bc_scaling(NDIM == 2 ? 2.0 : 5.0 / 3.0),
@@ -212,6 +200,7 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(const std::string&
             d_stress_tensor_type =
                 string_to_enum<StochasticStressTensorType>(input_db->getString("stress_tensor_type"));
         if (input_db->keyExists("std")) d_std = input_db->getDouble("std");
+        if (input_db->keyExists("seed")) d_seed = input_db->getInteger("seed");
         if (input_db->keyExists("num_rand_vals")) d_num_rand_vals = input_db->getInteger("num_rand_vals");
         int k = 0;
         std::string key_name = "weights_0";
@@ -305,9 +294,13 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
 #endif
         }
 
-        // Generate random components.
+        // Generate random components.  The values are determined by the seed,
+        // the time step number, and the grid index, so that they do not depend
+        // on the parallel decomposition.
         if (cycle_num == 0)
         {
+            const unsigned int seed = d_seed >= 0 ? static_cast<unsigned int>(d_seed) : RNG::global_seed();
+            const unsigned int step = static_cast<unsigned int>(d_fluid_solver->getIntegratorStep());
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -317,16 +310,28 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data = patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        RNG::genrandn(W_cc_data->getArrayData(),
+                                      W_cc_data->getBox(),
+                                      seed,
+                                      step,
+                                      RNG::stream_id(k, level_num, 0));
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data = patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        RNG::genrandn(W_nc_data->getArrayData(),
+                                      NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()),
+                                      seed,
+                                      step,
+                                      RNG::stream_id(k, level_num, 1));
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data = patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d), EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            RNG::genrandn(W_ec_data->getArrayData(d),
+                                          EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d),
+                                          seed,
+                                          step,
+                                          RNG::stream_id(k, level_num, 1 + d));
                         }
 #endif
                     }
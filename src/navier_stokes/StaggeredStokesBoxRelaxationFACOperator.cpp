@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -61,6 +62,7 @@
 #include "boost/array.hpp"
 #include "ibamr/StaggeredStokesBoxRelaxationFACOperator.h"
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
+#include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/IBTK_CHKERRQ.h"
@@ -72,6 +74,8 @@
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -85,6 +89,21 @@ namespace
 // Number of ghosts cells used for each variable quantity.
 static const int GHOSTS = 1;
 
+// Timers.
+static Timer* t_smooth_error;
+
+// Number of unknowns in the local Stokes problem associated with a single
+// Cartesian grid cell.
+static const int BOX_SIZE = 2 * NDIM + 1;
+
+// Number of colors used by the multicolor ordering.  Cells whose indices agree
+// modulo 3 in each coordinate direction do not read or write each other's
+// unknowns.
+static const int NUM_COLORS = (NDIM == 2 ? 9 : 27);
+
+// Under-relaxation factor used by the box smoother.
+static const double OMEGA = 0.65;
+
 inline int
 compute_side_index(const Index<NDIM>& i, const Box<NDIM>& box, const unsigned int axis)
 {
@@ -414,8 +433,6 @@ copyFromVec(Vec& v,
 {
     int ierr;
 
-    const double omega = 0.65;
-
     double U;
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
@@ -427,7 +444,7 @@ copyFromVec(Vec& v,
             const int idx = compute_side_index(i, ghost_box, axis);
             ierr = VecGetValues(v, 1, &idx, &U);
             IBTK_CHKERRQ(ierr);
-            U_data(s_i) = (1.0 - omega) * U_data(s_i) + omega * U;
+            U_data(s_i) = (1.0 - OMEGA) * U_data(s_i) + OMEGA * U;
         }
     }
 
@@ -438,10 +455,206 @@ copyFromVec(Vec& v,
         const int idx = compute_cell_index(i, ghost_box);
         ierr = VecGetValues(v, 1, &idx, &P);
         IBTK_CHKERRQ(ierr);
-        P_data(i) = (1.0 - omega) * P_data(i) + omega * P;
+        P_data(i) = (1.0 - OMEGA) * P_data(i) + OMEGA * P;
     }
     return;
 } // copyFromVec
+
+void
+buildBoxOperatorInverse(std::vector<double>& A_inv,
+                        const PoissonSpecifications& U_problem_coefs,
+                        const boost::array<double, NDIM>& dx)
+{
+    const double C = U_problem_coefs.getCConstant();
+    const double D = U_problem_coefs.getDConstant();
+
+    // Set up the local operator using the same ordering of the unknowns as
+    // buildBoxOperator(): the velocities on the lower and upper faces of the
+    // cell in each coordinate direction followed by the cell pressure.
+    std::vector<double> A(BOX_SIZE * BOX_SIZE, 0.0);
+    double diag = C;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        diag -= 2.0 * D / (dx[d] * dx[d]);
+    }
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const int lower = 2 * axis, upper = 2 * axis + 1, p = 2 * NDIM;
+        A[lower * BOX_SIZE + lower] = diag;
+        A[upper * BOX_SIZE + upper] = diag;
+        A[lower * BOX_SIZE + upper] = D / (dx[axis] * dx[axis]);
+        A[upper * BOX_SIZE + lower] = D / (dx[axis] * dx[axis]);
+        A[lower * BOX_SIZE + p] = 1.0 / dx[axis];
+        A[upper * BOX_SIZE + p] = -1.0 / dx[axis];
+        A[p * BOX_SIZE + lower] = 1.0 / dx[axis];
+        A[p * BOX_SIZE + upper] = -1.0 / dx[axis];
+    }
+
+    // Invert the local operator by Gauss-Jordan elimination with partial
+    // pivoting.  Pivoting is required because the pressure block of the
+    // operator is zero.
+    A_inv.assign(BOX_SIZE * BOX_SIZE, 0.0);
+    for (int m = 0; m < BOX_SIZE; ++m) A_inv[m * BOX_SIZE + m] = 1.0;
+    for (int k = 0; k < BOX_SIZE; ++k)
+    {
+        int pivot = k;
+        for (int m = k + 1; m < BOX_SIZE; ++m)
+        {
+            if (std::abs(A[m * BOX_SIZE + k]) > std::abs(A[pivot * BOX_SIZE + k])) pivot = m;
+        }
+        if (A[pivot * BOX_SIZE + k] == 0.0)
+        {
+            TBOX_ERROR("StaggeredStokesBoxRelaxationFACOperator::buildBoxOperatorInverse():\n"
+                       << "  local Stokes operator is singular" << std::endl);
+        }
+        for (int n = 0; n < BOX_SIZE; ++n)
+        {
+            std::swap(A[k * BOX_SIZE + n], A[pivot * BOX_SIZE + n]);
+            std::swap(A_inv[k * BOX_SIZE + n], A_inv[pivot * BOX_SIZE + n]);
+        }
+        const double scale = 1.0 / A[k * BOX_SIZE + k];
+        for (int n = 0; n < BOX_SIZE; ++n)
+        {
+            A[k * BOX_SIZE + n] *= scale;
+            A_inv[k * BOX_SIZE + n] *= scale;
+        }
+        for (int m = 0; m < BOX_SIZE; ++m)
+        {
+            if (m == k) continue;
+            const double factor = A[m * BOX_SIZE + k];
+            if (factor == 0.0) continue;
+            for (int n = 0; n < BOX_SIZE; ++n)
+            {
+                A[m * BOX_SIZE + n] -= factor * A[k * BOX_SIZE + n];
+                A_inv[m * BOX_SIZE + n] -= factor * A_inv[k * BOX_SIZE + n];
+            }
+        }
+    }
+    return;
+} // buildBoxOperatorInverse
+
+// Raw data pointers and strides used to relax the cells of a single patch.
+struct PatchBoxData
+{
+    double* U_e[NDIM];
+    const double* U_r[NDIM];
+    Index<NDIM> U_lower[NDIM];
+    int U_stride[NDIM][NDIM];
+    double* P_e;
+    const double* P_r;
+    Index<NDIM> P_lower;
+    int P_stride[NDIM];
+    double D_over_dx_sq[NDIM], one_over_dx[NDIM];
+    const double* A_inv;
+};
+
+inline void
+relaxCell(const Index<NDIM>& i, const PatchBoxData& data)
+{
+    // Set up the right-hand side of the local problem, including the
+    // contributions from the unknowns outside of the cell.
+    double r[BOX_SIZE];
+    int U_idx[NDIM];
+    int P_idx = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        P_idx += (i(d) - data.P_lower(d)) * data.P_stride[d];
+    }
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const double* const U = data.U_e[axis];
+        const int* const stride = data.U_stride[axis];
+        int idx_lower = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            idx_lower += (i(d) - data.U_lower[axis](d)) * stride[d];
+        }
+        const int idx_upper = idx_lower + stride[axis];
+        U_idx[axis] = idx_lower;
+        double r_lower = data.U_r[axis][idx_lower] + data.D_over_dx_sq[axis] * U[idx_lower - stride[axis]] +
+                         data.one_over_dx[axis] * data.P_e[P_idx - data.P_stride[axis]];
+        double r_upper = data.U_r[axis][idx_upper] + data.D_over_dx_sq[axis] * U[idx_upper + stride[axis]] -
+                         data.one_over_dx[axis] * data.P_e[P_idx + data.P_stride[axis]];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (d == axis) continue;
+            r_lower += data.D_over_dx_sq[d] * (U[idx_lower - stride[d]] + U[idx_lower + stride[d]]);
+            r_upper += data.D_over_dx_sq[d] * (U[idx_upper - stride[d]] + U[idx_upper + stride[d]]);
+        }
+        r[2 * axis] = r_lower;
+        r[2 * axis + 1] = r_upper;
+    }
+    r[2 * NDIM] = data.P_r[P_idx];
+
+    // Solve the local problem and update the error.
+    double e[BOX_SIZE];
+    for (int m = 0; m < BOX_SIZE; ++m)
+    {
+        const double* const A_inv_m = data.A_inv + m * BOX_SIZE;
+        double e_m = 0.0;
+        for (int n = 0; n < BOX_SIZE; ++n)
+        {
+            e_m += A_inv_m[n] * r[n];
+        }
+        e[m] = e_m;
+    }
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        double* const U = data.U_e[axis];
+        const int idx_lower = U_idx[axis];
+        const int idx_upper = idx_lower + data.U_stride[axis][axis];
+        U[idx_lower] = (1.0 - OMEGA) * U[idx_lower] + OMEGA * e[2 * axis];
+        U[idx_upper] = (1.0 - OMEGA) * U[idx_upper] + OMEGA * e[2 * axis + 1];
+    }
+    data.P_e[P_idx] = (1.0 - OMEGA) * data.P_e[P_idx] + OMEGA * e[2 * NDIM];
+    return;
+} // relaxCell
+
+void
+relaxPatch(const Box<NDIM>& patch_box, const PatchBoxData& data, const bool use_multicolor_ordering)
+{
+    if (!use_multicolor_ordering)
+    {
+        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+        {
+            relaxCell(b(), data);
+        }
+        return;
+    }
+
+    // Relax the cells one color at a time.  Cells of the same color are
+    // independent, so that they may be relaxed concurrently.
+    const Index<NDIM>& lower = patch_box.lower();
+    const Index<NDIM>& upper = patch_box.upper();
+    for (int color = 0; color < NUM_COLORS; ++color)
+    {
+        Index<NDIM> offset;
+        for (unsigned int d = 0, c = color; d < NDIM; ++d, c /= 3)
+        {
+            offset(d) = c % 3;
+        }
+        const int first = lower(NDIM - 1) + offset(NDIM - 1);
+        const int num_lines = first > upper(NDIM - 1) ? 0 : (upper(NDIM - 1) - first) / 3 + 1;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int k = 0; k < num_lines; ++k)
+        {
+            Index<NDIM> i;
+            i(NDIM - 1) = first + 3 * k;
+#if (NDIM == 3)
+            for (i(1) = lower(1) + offset(1); i(1) <= upper(1); i(1) += 3)
+#endif
+            {
+                for (i(0) = lower(0) + offset(0); i(0) <= upper(0); i(0) += 3)
+                {
+                    relaxCell(i, data);
+                }
+            }
+        }
+    }
+    return;
+} // relaxPatch
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -451,6 +664,9 @@ StaggeredStokesBoxRelaxationFACOperator::StaggeredStokesBoxRelaxationFACOperator
     const Pointer<Database> input_db,
     const std::string& default_options_prefix)
     : StaggeredStokesFACPreconditionerStrategy(object_name, GHOSTS, input_db, default_options_prefix),
+      d_box_solver_type("NATIVE"),
+      d_box_ordering("LEXICOGRAPHIC"),
+      d_box_op_inv(),
       d_box_op(),
       d_box_e(),
       d_box_r(),
@@ -458,7 +674,34 @@ StaggeredStokesBoxRelaxationFACOperator::StaggeredStokesBoxRelaxationFACOperator
       d_patch_side_bc_box_overlap(),
       d_patch_cell_bc_box_overlap()
 {
-    // intentionally blank
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("box_solver_type")) d_box_solver_type = input_db->getString("box_solver_type");
+        if (input_db->keyExists("box_ordering")) d_box_ordering = input_db->getString("box_ordering");
+    }
+    if (d_box_solver_type != "NATIVE" && d_box_solver_type != "PETSC")
+    {
+        TBOX_ERROR(d_object_name << "::StaggeredStokesBoxRelaxationFACOperator():\n"
+                                 << "  unsupported box solver type: " << d_box_solver_type << "\n"
+                                 << "  valid choices are: NATIVE, PETSC" << std::endl);
+    }
+    if (d_box_ordering != "LEXICOGRAPHIC" && d_box_ordering != "MULTICOLOR")
+    {
+        TBOX_ERROR(d_object_name << "::StaggeredStokesBoxRelaxationFACOperator():\n"
+                                 << "  unsupported box ordering: " << d_box_ordering << "\n"
+                                 << "  valid choices are: LEXICOGRAPHIC, MULTICOLOR" << std::endl);
+    }
+    if (d_box_solver_type == "PETSC" && d_box_ordering != "LEXICOGRAPHIC")
+    {
+        TBOX_ERROR(d_object_name << "::StaggeredStokesBoxRelaxationFACOperator():\n"
+                                 << "  box ordering " << d_box_ordering
+                                 << " is only supported by the NATIVE box solver" << std::endl);
+    }
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(t_smooth_error = TimerManager::getManager()->getTimer(
+                      "IBAMR::StaggeredStokesBoxRelaxationFACOperator::smoothError()"););
     return;
 } // StaggeredStokesBoxRelaxationFACOperator
 
@@ -478,6 +721,8 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
 {
     if (num_sweeps == 0) return;
 
+    IBAMR_TIMER_START(t_smooth_error);
+
     int ierr;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int U_error_idx = error.getComponentDescriptorIndex(0);
@@ -591,9 +836,8 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
         }
 
         // Smooth the error on the patches.
-        Vec& e = d_box_e[level_num];
-        Vec& r = d_box_r[level_num];
-        KSP& ksp = d_box_ksp[level_num];
+        const bool use_petsc_box_solver = d_box_solver_type == "PETSC";
+        const bool use_multicolor_ordering = d_box_ordering == "MULTICOLOR";
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
         {
@@ -618,22 +862,60 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            if (use_petsc_box_solver)
             {
-                const Index<NDIM>& i = b();
-                const Box<NDIM> box(i, i);
-                copyToVec(e, *U_error_data, *P_error_data, box, box);
-                copyToVec(r, *U_residual_data, *P_residual_data, box, box);
-                modifyRhsForBcs(r, *U_error_data, *P_error_data, d_U_problem_coefs, box, box, dx);
-                ierr = KSPSolve(ksp, r, e);
-                IBTK_CHKERRQ(ierr);
-                copyFromVec(e, *U_error_data, *P_error_data, box, box);
+                Vec& e = d_box_e[level_num];
+                Vec& r = d_box_r[level_num];
+                KSP& ksp = d_box_ksp[level_num];
+                for (Box<NDIM>::Iterator b(patch_box); b; b++)
+                {
+                    const Index<NDIM>& i = b();
+                    const Box<NDIM> box(i, i);
+                    copyToVec(e, *U_error_data, *P_error_data, box, box);
+                    copyToVec(r, *U_residual_data, *P_residual_data, box, box);
+                    modifyRhsForBcs(r, *U_error_data, *P_error_data, d_U_problem_coefs, box, box, dx);
+                    ierr = KSPSolve(ksp, r, e);
+                    IBTK_CHKERRQ(ierr);
+                    copyFromVec(e, *U_error_data, *P_error_data, box, box);
+                }
+            }
+            else
+            {
+                const double D = d_U_problem_coefs.getDConstant();
+                PatchBoxData data;
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    data.U_e[axis] = U_error_data->getPointer(axis);
+                    data.U_r[axis] = U_residual_data->getPointer(axis);
+                    const Box<NDIM>& U_data_box = U_error_data->getArrayData(axis).getBox();
+                    data.U_lower[axis] = U_data_box.lower();
+                    data.U_stride[axis][0] = 1;
+                    for (unsigned int d = 1; d < NDIM; ++d)
+                    {
+                        data.U_stride[axis][d] = data.U_stride[axis][d - 1] * U_data_box.numberCells(d - 1);
+                    }
+                    data.D_over_dx_sq[axis] = D / (dx[axis] * dx[axis]);
+                    data.one_over_dx[axis] = 1.0 / dx[axis];
+                }
+                data.P_e = P_error_data->getPointer();
+                data.P_r = P_residual_data->getPointer();
+                const Box<NDIM>& P_data_box = P_error_data->getGhostBox();
+                data.P_lower = P_data_box.lower();
+                data.P_stride[0] = 1;
+                for (unsigned int d = 1; d < NDIM; ++d)
+                {
+                    data.P_stride[d] = data.P_stride[d - 1] * P_data_box.numberCells(d - 1);
+                }
+                data.A_inv = &d_box_op_inv[level_num][0];
+                relaxPatch(patch_box, data, use_multicolor_ordering);
             }
         }
     }
 
     // Synchronize data along patch boundaries.
     xeqScheduleDataSynch(U_error_idx, level_num);
+
+    IBAMR_TIMER_STOP(t_smooth_error);
     return;
 } // smoothError
 
@@ -648,6 +930,7 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
                                                                             const int finest_reset_ln)
 {
     // Initialize the box relaxation data on each level of the patch hierarchy.
+    d_box_op_inv.resize(d_finest_ln + 1);
     d_box_op.resize(d_finest_ln + 1);
     d_box_e.resize(d_finest_ln + 1);
     d_box_r.resize(d_finest_ln + 1);
@@ -663,6 +946,11 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
         {
             dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
         }
+        if (d_box_solver_type == "NATIVE")
+        {
+            buildBoxOperatorInverse(d_box_op_inv[ln], d_U_problem_coefs, dx);
+            continue;
+        }
         buildBoxOperator(d_box_op[ln], d_U_problem_coefs, box, box, dx);
         int ierr;
         ierr = MatCreateVecs(d_box_op[ln], &d_box_e[ln], &d_box_r[ln]);
@@ -737,15 +1025,19 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
     if (!d_is_initialized) return;
     for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
     {
-        int ierr;
-        ierr = MatDestroy(&d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_e[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPDestroy(&d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        d_box_op_inv[ln].clear();
+        if (d_box_solver_type == "PETSC")
+        {
+            int ierr;
+            ierr = MatDestroy(&d_box_op[ln]);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&d_box_e[ln]);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&d_box_r[ln]);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPDestroy(&d_box_ksp[ln]);
+            IBTK_CHKERRQ(ierr);
+        }
         d_patch_side_bc_box_overlap[ln].resize(0);
         d_patch_cell_bc_box_overlap[ln].resize(0);
     }
@@ -40,6 +40,7 @@
 
 #include "ibamr/PETScKrylovStaggeredStokesSolver.h"
 #include "ibamr/StaggeredStokesBlockFactorizationPreconditioner.h"
+#include "ibamr/StaggeredStokesBoxRelaxationFACOperator.h"
 #include "ibamr/StaggeredStokesFACPreconditioner.h"
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
 #include "ibamr/StaggeredStokesLevelRelaxationFACOperator.h"
@@ -198,6 +199,8 @@ StaggeredStokesSolverManager::StaggeredStokesSolverManager() : d_solver_maker_ma
                                   StaggeredStokesLevelRelaxationFACOperator::allocate_solver);
     registerSolverFactoryFunction(LEVEL_RELAXATION_FAC_PRECONDITIONER,
                                   StaggeredStokesLevelRelaxationFACOperator::allocate_solver);
+    registerSolverFactoryFunction(BOX_RELAXATION_FAC_PRECONDITIONER,
+                                  StaggeredStokesBoxRelaxationFACOperator::allocate_solver);
     registerSolverFactoryFunction(DEFAULT_LEVEL_SOLVER, StaggeredStokesPETScLevelSolver::allocate_solver);
     registerSolverFactoryFunction(PETSC_LEVEL_SOLVER, StaggeredStokesPETScLevelSolver::allocate_solver);
     return;
@@ -0,0 +1,166 @@
+#!/usr/bin/perl -w
+#
+# filename: convert_structure_files.pl
+# usage: convert_structure_files.pl <spatial dimension> <base filename>
+#
+# A simple Perl script to convert the ASCII vertex, spring, beam, and
+# target point input files of an IBAMR structure into a binary structure
+# file that may be memory-mapped by IBStandardInitializer.  The vertex
+# file <base filename>.vertex is required; the spring, beam, and target
+# point files are converted if they exist.  The binary structure file is
+# written to <base filename>.structure.
+#
+# See the documentation of class IBStandardInitializer for a description
+# of the binary structure file format.
+
+use strict;
+
+if ($#ARGV != 1) {
+    die "incorrect number of command line arguments.\nusage:\n  convert_structure_files.pl <spatial dimension> <base filename>\n";
+}
+
+# parse the command line arguments
+my $ndim = shift @ARGV;  chomp $ndim;
+my $base_filename = shift @ARGV;  chomp $base_filename;
+if ($ndim != 2 && $ndim != 3) {
+    die "error: spatial dimension must be 2 or 3\n";
+}
+my $output_filename = "$base_filename.structure";
+
+print "spatial dimension: $ndim\n";
+print "base filename: $base_filename\n";
+print "output file: $output_filename\n";
+
+# each section consists of a sequence of arrays, each of which is padded
+# to a multiple of 8 bytes.
+sub pad {
+    my $data = shift;
+    my $remainder = length($data) % 8;
+    return $remainder == 0 ? $data : $data . ("\0" x (8 - $remainder));
+}
+
+# read the next line of an input file with any comments removed.
+sub next_line {
+    my ($fh, $filename, $line_number) = @_;
+    my $line = <$fh>;
+    defined($line) || die "error: premature end to input file encountered before line $line_number of file $filename\n";
+    $line =~ s/[!#%].*//;
+    my @entries = split(' ', $line);
+    return @entries;
+}
+
+# read the number of entries from the first line of an input file.
+sub num_entries {
+    my ($fh, $filename) = @_;
+    my @line = next_line($fh, $filename, 1);
+    ($#line >= 0 && $line[0] =~ /^[+-]?\d+$/ && $line[0] > 0) || die "error: invalid entry on line 1 of file $filename\n";
+    return $line[0];
+}
+
+my @sections = ();
+
+# the vertex file has the format:
+#
+#   <number of vertices> (comments)
+#   <x> <y> (<z>) (comments)
+#
+# where items in ()'s are optional
+my $vertex_filename = "$base_filename.vertex";
+open(VERTEX_IN, "$vertex_filename") || die "error: cannot open $vertex_filename for reading: $!";
+my $num_vertex = num_entries(\*VERTEX_IN, $vertex_filename);
+my $X = "";
+for (my $k = 0; $k < $num_vertex; $k++) {
+    my @line = next_line(\*VERTEX_IN, $vertex_filename, $k+2);
+    ($#line >= $ndim-1) || die "error: invalid entry on line " . ($k+2) . " of file $vertex_filename\n";
+    $X .= pack("d<$ndim", @line[0 .. $ndim-1]);
+}
+close(VERTEX_IN) || die "error: cannot close $vertex_filename: $!";
+push @sections, [1, $num_vertex, pad($X)];
+print "read $num_vertex vertices from $vertex_filename\n";
+
+# the spring file has the format:
+#
+#   <number of springs> (comments)
+#   <first node> <second node> <stiffness> <rest length> (force fcn index) (parameters) (comments)
+#
+# where items in ()'s are optional
+my $spring_filename = "$base_filename.spring";
+if (open(SPRING_IN, "$spring_filename")) {
+    my $num_springs = num_entries(\*SPRING_IN, $spring_filename);
+    my ($idx, $fcn_idx, $params, $param_offsets, $extra_params) = ("", "", "", pack("Q<", 0), "");
+    my $num_extra_params = 0;
+    for (my $k = 0; $k < $num_springs; $k++) {
+        my @line = next_line(\*SPRING_IN, $spring_filename, $k+2);
+        ($#line >= 3) || die "error: invalid entry on line " . ($k+2) . " of file $spring_filename\n";
+        $idx .= pack("l<2", @line[0 .. 1]);
+        $params .= pack("d<2", @line[2 .. 3]);
+        $fcn_idx .= pack("l<", $#line >= 4 ? $line[4] : 0);
+        if ($#line >= 5) {
+            $extra_params .= pack("d<*", @line[5 .. $#line]);
+            $num_extra_params += $#line - 4;
+        }
+        $param_offsets .= pack("Q<", $num_extra_params);
+    }
+    close(SPRING_IN) || die "error: cannot close $spring_filename: $!";
+    push @sections, [2, $num_springs, pad($idx) . pad($fcn_idx) . pad($params) . pad($param_offsets) . pad($extra_params)];
+    print "read $num_springs springs from $spring_filename\n";
+}
+
+# the beam file has the format:
+#
+#   <number of beams> (comments)
+#   <previous node> <current node> <next node> <bending rigidity> (curvature) (comments)
+#
+# where items in ()'s are optional
+my $beam_filename = "$base_filename.beam";
+if (open(BEAM_IN, "$beam_filename")) {
+    my $num_beams = num_entries(\*BEAM_IN, $beam_filename);
+    my ($idx, $bend, $curv) = ("", "", "");
+    for (my $k = 0; $k < $num_beams; $k++) {
+        my @line = next_line(\*BEAM_IN, $beam_filename, $k+2);
+        ($#line == 3 || $#line >= 3+$ndim) || die "error: invalid entry on line " . ($k+2) . " of file $beam_filename\n";
+        $idx .= pack("l<3", @line[0 .. 2]);
+        $bend .= pack("d<", $line[3]);
+        $curv .= ($#line == 3 ? pack("d<$ndim", (0.0) x $ndim) : pack("d<$ndim", @line[4 .. 3+$ndim]));
+    }
+    close(BEAM_IN) || die "error: cannot close $beam_filename: $!";
+    push @sections, [3, $num_beams, pad($idx) . pad($bend) . pad($curv)];
+    print "read $num_beams beams from $beam_filename\n";
+}
+
+# the target point file has the format:
+#
+#   <number of target points> (comments)
+#   <node> <stiffness> (damping) (comments)
+#
+# where items in ()'s are optional
+my $target_filename = "$base_filename.target";
+if (open(TARGET_IN, "$target_filename")) {
+    my $num_targets = num_entries(\*TARGET_IN, $target_filename);
+    my ($idx, $params) = ("", "");
+    for (my $k = 0; $k < $num_targets; $k++) {
+        my @line = next_line(\*TARGET_IN, $target_filename, $k+2);
+        ($#line >= 1) || die "error: invalid entry on line " . ($k+2) . " of file $target_filename\n";
+        $idx .= pack("l<", $line[0]);
+        $params .= pack("d<2", $line[1], $#line >= 2 ? $line[2] : 0.0);
+    }
+    close(TARGET_IN) || die "error: cannot close $target_filename: $!";
+    push @sections, [4, $num_targets, pad($idx) . pad($params)];
+    print "read $num_targets target points from $target_filename\n";
+}
+
+# write the header, the section table, and the section data.
+open(OUT, ">$output_filename") || die "error: cannot open $output_filename for writing: $!";
+binmode(OUT);
+my $num_sections = scalar(@sections);
+print OUT "IBSTRUCT" . pack("V4", 1, $ndim, $num_sections, 0);
+my $offset = 24 + 32*$num_sections;
+foreach my $section (@sections) {
+    my ($type, $num_records, $data) = @$section;
+    print OUT pack("V2Q<3", $type, 0, $num_records, $offset, length($data));
+    $offset += length($data);
+}
+foreach my $section (@sections) {
+    print OUT $section->[2];
+}
+close(OUT) || die "error: cannot close $output_filename: $!";
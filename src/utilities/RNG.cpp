@@ -1,6 +1,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <time.h>
 #include <iosfwd>
@@ -10,6 +11,14 @@
 #include <set>
 #include <vector>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "Index.h"
+#include "IntVector.h"
 #include "ibamr/RNG.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
@@ -77,6 +86,8 @@ namespace IBAMR
 static unsigned long mt[N]; /* the array for the state vector  */
 static int mti = N + 1;     /* mti==N+1 means mt[N] is not initialized */
 
+static unsigned int s_global_seed = 0;
+
 void
 RNG::srandgen(unsigned long seed)
 {
@@ -262,6 +273,10 @@ RNG::parallel_seed(int global_seed)
         std::cout << "\nGlobal seed = " << seed << "\n\n";
     }
 
+    // Record the global seed for use by the counter-based generator.
+    MPI_Bcast(&seed, 1, MPI_INT, mpi_root, MPI_COMM_WORLD);
+    s_global_seed = static_cast<unsigned int>(seed);
+
     if (size > 1)
     {
         // This is based on Mike Lijewski's code in LLNS/main.cpp
@@ -310,6 +325,119 @@ RNG::parallel_seed(int global_seed)
     return;
 } // parallel_seed
 
+unsigned int
+RNG::global_seed()
+{
+    return s_global_seed;
+} // global_seed
+
+/*
+** Counter-based random number generation.
+**
+** Philox-4x32-10 maps a 128-bit counter and a 64-bit key to 128 random bits.
+** See J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw, "Parallel random
+** numbers: as easy as 1, 2, 3", Proceedings of SC11, 2011.
+*/
+namespace
+{
+inline void
+philox4x32_10(uint32_t ctr[4], const uint32_t key_in[2])
+{
+    static const uint32_t PHILOX_M0 = 0xD2511F53U, PHILOX_M1 = 0xCD9E8D57U;
+    static const uint32_t PHILOX_W0 = 0x9E3779B9U, PHILOX_W1 = 0xBB67AE85U;
+    uint32_t key[2] = { key_in[0], key_in[1] };
+    for (int round = 0; round < 10; ++round)
+    {
+        const uint64_t prod0 = static_cast<uint64_t>(PHILOX_M0) * ctr[0];
+        const uint64_t prod1 = static_cast<uint64_t>(PHILOX_M1) * ctr[2];
+        const uint32_t hi0 = static_cast<uint32_t>(prod0 >> 32), lo0 = static_cast<uint32_t>(prod0);
+        const uint32_t hi1 = static_cast<uint32_t>(prod1 >> 32), lo1 = static_cast<uint32_t>(prod1);
+        ctr[0] = hi1 ^ ctr[1] ^ key[0];
+        ctr[1] = lo1;
+        ctr[2] = hi0 ^ ctr[3] ^ key[1];
+        ctr[3] = lo0;
+        key[0] += PHILOX_W0;
+        key[1] += PHILOX_W1;
+    }
+    return;
+} // philox4x32_10
+
+// Convert 64 random bits to a double in the open interval (0,1).
+inline double
+to_open_unit_interval(const uint32_t hi, const uint32_t lo)
+{
+    const uint64_t bits = ((static_cast<uint64_t>(hi) << 32) | lo) >> 11;
+    return (static_cast<double>(bits) + 0.5) * 1.1102230246251565e-16; // 2^-53
+} // to_open_unit_interval
+} // namespace
+
+void
+RNG::genrandn(ArrayData<NDIM, double>& data,
+              const Box<NDIM>& box,
+              const unsigned int seed,
+              const unsigned int step,
+              const unsigned int stream)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(stream < (1U << 24));
+    TBOX_ASSERT(data.getBox().contains(box));
+#endif
+    const int num_pts = box.size();
+    if (num_pts == 0) return;
+    const IntVector<NDIM> extents = box.numberCells();
+    const int depth = data.getDepth();
+    const uint32_t key[2] = { seed, step };
+    static const double two_pi = 6.283185307179586476925286766559;
+
+    // Each evaluation of the generator yields two standard normal values via
+    // the Box-Muller transform, which are used for a pair of data depths.
+    for (int pair = 0; 2 * pair < depth; ++pair)
+    {
+        const uint32_t ctr_hi = (static_cast<uint32_t>(stream) << 8) | static_cast<uint32_t>(pair);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int k = 0; k < num_pts; ++k)
+        {
+            Index<NDIM> i;
+            int offset = k;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                i(d) = box.lower()(d) + offset % extents(d);
+                offset /= extents(d);
+            }
+#if (NDIM == 2)
+            uint32_t ctr[4] = { static_cast<uint32_t>(i(0)), static_cast<uint32_t>(i(1)), 0U, ctr_hi };
+#endif
+#if (NDIM == 3)
+            uint32_t ctr[4] = {
+                static_cast<uint32_t>(i(0)), static_cast<uint32_t>(i(1)), static_cast<uint32_t>(i(2)), ctr_hi
+            };
+#endif
+            philox4x32_10(ctr, key);
+            const double r = sqrt(-2.0 * log(to_open_unit_interval(ctr[0], ctr[1])));
+            const double theta = two_pi * to_open_unit_interval(ctr[2], ctr[3]);
+            data(i, 2 * pair) = r * cos(theta);
+            if (2 * pair + 1 < depth) data(i, 2 * pair + 1) = r * sin(theta);
+        }
+    }
+    return;
+} // genrandn
+
+unsigned int
+RNG::stream_id(const int k, const int level_num, const int field)
+{
+    if (k < 0 || k > 0xff || level_num < 0 || level_num > 0xff || field < 0 || field > 0xff)
+    {
+        TBOX_ERROR("RNG::stream_id():\n"
+                   << "  random value index, level number, or field out of range for the random number stream\n"
+                   << "  k = " << k << " (max 255), level number = " << level_num << " (max 255), field = " << field
+                   << " (max 255)" << std::endl);
+    }
+    return (static_cast<unsigned int>(k) << 16) | (static_cast<unsigned int>(level_num) << 8) |
+           static_cast<unsigned int>(field);
+} // stream_id
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
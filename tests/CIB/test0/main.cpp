@@ -0,0 +1,518 @@
+// Filename: main.cpp
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BoxArray.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <PatchHierarchy.h>
+#include <PatchLevel.h>
+#include <ProcessorMapping.h>
+#include <SAMRAIVectorReal.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/CIBStrategy.h>
+#include <ibamr/DirectMobilitySolver.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/PETScSAMRAIVectorReal.h>
+
+// A minimal implementation of CIBStrategy that provides the dense mobility
+// and geometric matrices used by DirectMobilitySolver.  Each structure is a
+// row of nodes, and the rows are stacked so that neighboring structures are
+// coupled.  The mobility matrix is formed from a Gaussian kernel plus the
+// identity, so that it is symmetric positive definite.  Lagrangian vectors
+// are sequential vectors that store the values of all of the nodes on every
+// processor.
+class TestCIBStrategy : public CIBStrategy
+{
+public:
+    TestCIBStrategy(const unsigned int num_structures, const int num_nodes_per_structure, const double node_spacing)
+        : CIBStrategy(num_structures),
+          d_num_nodes_per_structure(num_nodes_per_structure),
+          d_node_spacing(node_spacing),
+          d_X(num_structures * num_nodes_per_structure * NDIM, 0.0)
+    {
+        for (unsigned int part = 0; part < num_structures; ++part)
+        {
+            for (int i = 0; i < num_nodes_per_structure; ++i)
+            {
+                double* const X = &d_X[(part * num_nodes_per_structure + i) * NDIM];
+                X[0] = (i + 0.5 * (part % 2)) * node_spacing;
+                X[1] = 1.5 * part * node_spacing;
+            }
+        }
+        return;
+    } // TestCIBStrategy
+
+    // Translate all of the nodes of the specified structure.
+    void displaceStructure(const unsigned int part, const double* const displacement)
+    {
+        for (int i = 0; i < d_num_nodes_per_structure; ++i)
+        {
+            for (int d = 0; d < NDIM; ++d) d_X[(part * d_num_nodes_per_structure + i) * NDIM + d] += displacement[d];
+        }
+        return;
+    } // displaceStructure
+
+    // Compute the mobility matrix of the specified structures in column-major
+    // order.
+    void computeMobilityMatrix(double* const mat, const std::vector<unsigned>& struct_ids) const
+    {
+        std::vector<const double*> X;
+        for (unsigned k = 0; k < struct_ids.size(); ++k)
+        {
+            for (int i = 0; i < d_num_nodes_per_structure; ++i)
+            {
+                X.push_back(&d_X[(struct_ids[k] * d_num_nodes_per_structure + i) * NDIM]);
+            }
+        }
+        const int num_nodes = static_cast<int>(X.size());
+        const int n = num_nodes * NDIM;
+        std::fill(mat, mat + n * n, 0.0);
+        for (int j = 0; j < num_nodes; ++j)
+        {
+            for (int i = 0; i < num_nodes; ++i)
+            {
+                double r_sq = 0.0;
+                for (int d = 0; d < NDIM; ++d) r_sq += (X[i][d] - X[j][d]) * (X[i][d] - X[j][d]);
+                const double m = std::exp(-0.5 * r_sq / (d_node_spacing * d_node_spacing)) + (i == j ? 1.0 : 0.0);
+                for (int d = 0; d < NDIM; ++d) mat[(j * NDIM + d) * n + i * NDIM + d] = m;
+            }
+        }
+        return;
+    } // computeMobilityMatrix
+
+    unsigned int getNumberOfNodes(const unsigned int /*part*/) const
+    {
+        return d_num_nodes_per_structure;
+    } // getNumberOfNodes
+
+    void copyVecToArray(Vec b,
+                        double* array,
+                        const std::vector<unsigned>& struct_ids,
+                        const int data_depth,
+                        const int array_rank)
+    {
+        if (SAMRAI_MPI::getRank() != array_rank) return;
+        const int struct_size = d_num_nodes_per_structure * data_depth;
+        const double* b_array;
+        VecGetArrayRead(b, &b_array);
+        for (unsigned k = 0; k < struct_ids.size(); ++k)
+        {
+            std::copy(&b_array[struct_ids[k] * struct_size],
+                      &b_array[struct_ids[k] * struct_size] + struct_size,
+                      &array[k * struct_size]);
+        }
+        VecRestoreArrayRead(b, &b_array);
+        return;
+    } // copyVecToArray
+
+    void copyArrayToVec(Vec b,
+                        double* array,
+                        const std::vector<unsigned>& struct_ids,
+                        const int data_depth,
+                        const int array_rank)
+    {
+        const int struct_size = d_num_nodes_per_structure * data_depth;
+        int size = static_cast<int>(struct_ids.size()) * struct_size;
+        std::vector<double> values(size);
+        if (SAMRAI_MPI::getRank() == array_rank) std::copy(array, array + size, values.begin());
+        SAMRAI_MPI::bcast(&values[0], size, array_rank);
+        double* b_array;
+        VecGetArray(b, &b_array);
+        for (unsigned k = 0; k < struct_ids.size(); ++k)
+        {
+            std::copy(&values[k * struct_size],
+                      &values[k * struct_size] + struct_size,
+                      &b_array[struct_ids[k] * struct_size]);
+        }
+        VecRestoreArray(b, &b_array);
+        return;
+    } // copyArrayToVec
+
+    void constructMobilityMatrix(const std::string& /*mat_name*/,
+                                 MobilityMatrixType /*mat_type*/,
+                                 Mat& mobility_mat,
+                                 const std::vector<unsigned>& prototype_struct_ids,
+                                 const double* /*grid_dx*/,
+                                 const double* /*domain_extents*/,
+                                 const bool /*initial_time*/,
+                                 double /*rho*/,
+                                 double /*mu*/,
+                                 const std::pair<double, double>& /*scale*/,
+                                 double /*f_periodic_corr*/,
+                                 const int managing_rank)
+    {
+        if (SAMRAI_MPI::getRank() != managing_rank) return;
+        double* mat_data;
+        MatDenseGetArray(mobility_mat, &mat_data);
+        computeMobilityMatrix(mat_data, prototype_struct_ids);
+        MatDenseRestoreArray(mobility_mat, &mat_data);
+        return;
+    } // constructMobilityMatrix
+
+    void constructGeometricMatrix(const std::string& /*mat_name*/,
+                                  Mat& geometric_mat,
+                                  const std::vector<unsigned>& prototype_struct_ids,
+                                  const bool /*initial_time*/,
+                                  const int managing_rank)
+    {
+        if (SAMRAI_MPI::getRank() != managing_rank) return;
+
+        // Map the translational and rotational velocities of each structure
+        // to the velocities of its nodes.
+        const int num_structs = static_cast<int>(prototype_struct_ids.size());
+        const int n = num_structs * d_num_nodes_per_structure * NDIM;
+        double* mat_data;
+        MatDenseGetArray(geometric_mat, &mat_data);
+        std::fill(mat_data, mat_data + n * num_structs * s_max_free_dofs, 0.0);
+        for (int k = 0; k < num_structs; ++k)
+        {
+            const double* const X = &d_X[prototype_struct_ids[k] * d_num_nodes_per_structure * NDIM];
+            double X_com[NDIM] = { 0.0 };
+            for (int i = 0; i < d_num_nodes_per_structure; ++i)
+            {
+                for (int d = 0; d < NDIM; ++d) X_com[d] += X[i * NDIM + d] / d_num_nodes_per_structure;
+            }
+            for (int i = 0; i < d_num_nodes_per_structure; ++i)
+            {
+                const int row = (k * d_num_nodes_per_structure + i) * NDIM;
+                double* const col = &mat_data[k * s_max_free_dofs * n + row];
+                for (int d = 0; d < NDIM; ++d) col[d * n + d] = 1.0;
+                const double R[NDIM] = { X[i * NDIM] - X_com[0], X[i * NDIM + 1] - X_com[1] };
+                col[NDIM * n] = -R[1];
+                col[NDIM * n + 1] = R[0];
+            }
+        }
+        MatDenseRestoreArray(geometric_mat, &mat_data);
+        return;
+    } // constructGeometricMatrix
+
+    // The remaining methods are not used by DirectMobilitySolver.
+    void setConstraintForce(Vec /*L*/, const double /*data_time*/, const double /*scale*/ = 1.0)
+    {
+        return;
+    } // setConstraintForce
+
+    void getConstraintForce(Vec* /*L*/, const double /*data_time*/)
+    {
+        return;
+    } // getConstraintForce
+
+    void subtractMeanConstraintForce(Vec /*L*/, int /*f_data_idx*/, const double /*scale*/ = 1.0)
+    {
+        return;
+    } // subtractMeanConstraintForce
+
+    void getInterpolatedVelocity(Vec /*V*/, const double /*data_time*/, const double /*scale*/ = 1.0)
+    {
+        return;
+    } // getInterpolatedVelocity
+
+    void computeMobilityRegularization(Vec /*D*/, Vec /*L*/, const double /*scale*/ = 1.0)
+    {
+        return;
+    } // computeMobilityRegularization
+
+    void setRigidBodyVelocity(const unsigned int /*part*/, const RigidDOFVector& /*U*/, Vec /*V*/)
+    {
+        return;
+    } // setRigidBodyVelocity
+
+    void computeNetRigidGeneralizedForce(const unsigned int /*part*/, Vec /*L*/, RigidDOFVector& /*F*/)
+    {
+        return;
+    } // computeNetRigidGeneralizedForce
+
+private:
+    const int d_num_nodes_per_structure;
+    const double d_node_spacing;
+    std::vector<double> d_X;
+};
+
+// Register the same mobility matrices with both solvers.  Each matrix is
+// formed for the structures in one of the groups of structure indices.  (The
+// matrix type is ignored by TestCIBStrategy.)
+void
+register_mobility_matrices(const std::vector<Pointer<DirectMobilitySolver> >& solvers,
+                           const std::vector<std::vector<unsigned> >& groups)
+{
+    for (unsigned k = 0; k < groups.size(); ++k)
+    {
+        std::ostringstream mat_name;
+        mat_name << "MOB-MATRIX-" << k;
+        for (unsigned s = 0; s < solvers.size(); ++s)
+        {
+            solvers[s]->registerMobilityMat(
+                mat_name.str(), groups[k], RPY, std::make_pair(LAPACK_CHOLESKY, LAPACK_CHOLESKY));
+            solvers[s]->registerStructIDsWithMobilityMat(mat_name.str(),
+                                                         std::vector<std::vector<unsigned> >(1, groups[k]));
+        }
+    }
+    return;
+} // register_mobility_matrices
+
+// Compare the inverses of the mobility matrices computed by the two solvers
+// column by column.  Because the Cholesky factorization of a symmetric
+// positive definite matrix is unique, the inverses agree to roundoff if and
+// only if the factors do.  Also check the residual of the solution computed by
+// the distributed solver for one right-hand side.
+bool
+check_solvers(Pointer<DirectMobilitySolver> ref_solver,
+              Pointer<DirectMobilitySolver> solver,
+              Pointer<TestCIBStrategy> cib_strategy,
+              const std::vector<std::vector<unsigned> >& groups,
+              const int num_nodes_per_structure,
+              Vec x_nest,
+              const std::string& description)
+{
+    const int struct_size = num_nodes_per_structure * NDIM;
+    const int size = static_cast<int>(cib_strategy->getNumberOfRigidStructures()) * struct_size;
+    ref_solver->deallocateSolverState();
+    solver->deallocateSolverState();
+
+    Vec b, x, x_ref;
+    VecCreateSeq(PETSC_COMM_SELF, size, &b);
+    VecDuplicate(b, &x);
+    VecDuplicate(b, &x_ref);
+    ref_solver->initializeSolverState(x_nest, b);
+    solver->initializeSolverState(x_nest, b);
+
+    double max_err = 0.0, max_val = 0.0;
+    for (int k = 0; k < size; ++k)
+    {
+        VecSet(b, 0.0);
+        VecSetValue(b, k, 1.0, INSERT_VALUES);
+        VecAssemblyBegin(b);
+        VecAssemblyEnd(b);
+        VecSet(x, 0.0);
+        VecSet(x_ref, 0.0);
+        ref_solver->solveSystem(x_ref, b);
+        solver->solveSystem(x, b);
+        double val;
+        VecNorm(x_ref, NORM_INFINITY, &val);
+        max_val = std::max(max_val, val);
+        VecAXPY(x, -1.0, x_ref);
+        VecNorm(x, NORM_INFINITY, &val);
+        max_err = std::max(max_err, val);
+    }
+
+    double* b_array;
+    VecGetArray(b, &b_array);
+    for (int k = 0; k < size; ++k) b_array[k] = std::sin(1.0 + 3.0 * k);
+    VecRestoreArray(b, &b_array);
+    solver->solveSystem(x, b);
+    double max_residual = 0.0;
+    const double* x_array;
+    VecGetArrayRead(x, &x_array);
+    VecGetArray(b, &b_array);
+    for (unsigned k = 0; k < groups.size(); ++k)
+    {
+        const int n = static_cast<int>(groups[k].size()) * struct_size;
+        std::vector<double> mat(n * n), x_group(n), b_group(n);
+        cib_strategy->computeMobilityMatrix(&mat[0], groups[k]);
+        for (unsigned s = 0; s < groups[k].size(); ++s)
+        {
+            std::copy(&x_array[groups[k][s] * struct_size],
+                      &x_array[groups[k][s] * struct_size] + struct_size,
+                      &x_group[s * struct_size]);
+            std::copy(&b_array[groups[k][s] * struct_size],
+                      &b_array[groups[k][s] * struct_size] + struct_size,
+                      &b_group[s * struct_size]);
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            double r = -b_group[i];
+            for (int j = 0; j < n; ++j) r += mat[j * n + i] * x_group[j];
+            max_residual = std::max(max_residual, std::abs(r));
+        }
+    }
+    VecRestoreArray(b, &b_array);
+    VecRestoreArrayRead(x, &x_array);
+    VecDestroy(&b);
+    VecDestroy(&x);
+    VecDestroy(&x_ref);
+
+    // Every processor has the same solutions, but check on all of them.
+    max_err = SAMRAI_MPI::maxReduction(max_err);
+    max_residual = SAMRAI_MPI::maxReduction(max_residual);
+    const bool passed = max_err <= 1.0e-12 * max_val && max_residual <= 1.0e-12;
+    pout << description << ":\n"
+         << "  max inverse error: " << max_err << " (max inverse entry: " << max_val << ")\n"
+         << "  max residual:      " << max_residual << "\n"
+         << "  " << (passed ? "PASSED" : "FAILED") << "\n";
+    return passed;
+} // check_solvers
+
+/*******************************************************************************
+ * This test compares the factorizations of the mobility matrices computed by  *
+ * DirectMobilitySolver when the factorization is distributed and updated      *
+ * incrementally to those computed on a single processor.  The structures are  *
+ * moved between factorizations so that the updates reuse all, part, or none   *
+ * of the previous factors.  The command line is:                              *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "CIB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // DirectMobilitySolver obtains the grid spacing from the solution
+        // vector, so create a single-level patch hierarchy and a vector on it.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        const BoxArray<NDIM>& domain_boxes = grid_geometry->getPhysicalDomain();
+        ProcessorMapping mapping(domain_boxes.getNumberOfBoxes());
+        for (int k = 0; k < domain_boxes.getNumberOfBoxes(); ++k) mapping.setProcessorAssignment(k, 0);
+        patch_hierarchy->makeNewPatchLevel(0, IntVector<NDIM>(1), domain_boxes, mapping);
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > u_var = new CellVariable<NDIM, double>("u");
+        const int u_idx = var_db->registerVariableAndContext(u_var, var_db->getContext("CTX"), IntVector<NDIM>(0));
+        patch_hierarchy->getPatchLevel(0)->allocatePatchData(u_idx);
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_vec =
+            new SAMRAIVectorReal<NDIM, double>("u", patch_hierarchy, 0, 0);
+        u_vec->addComponent(u_var, u_idx);
+        Vec u_petsc_vec = PETScSAMRAIVectorReal::createPETScVector(u_vec, PETSC_COMM_WORLD);
+        Vec x_nest;
+        VecCreateNest(PETSC_COMM_WORLD, 1, NULL, &u_petsc_vec, &x_nest);
+
+        // Create the structures.
+        const int num_structures = input_db->getInteger("NUM_STRUCTURES");
+        const int num_nodes_per_structure = input_db->getInteger("NUM_NODES_PER_STRUCTURE");
+        const double node_spacing = input_db->getDouble("NODE_SPACING");
+        Pointer<TestCIBStrategy> cib_strategy =
+            new TestCIBStrategy(num_structures, num_nodes_per_structure, node_spacing);
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // The structures are either all in one mobility matrix, which is then
+        // factorized by all of the processors, or split among several
+        // matrices of different sizes, which are factorized by groups of
+        // processors of different sizes (or by single processors when there
+        // are at least as many matrices as processors).
+        std::vector<std::vector<std::vector<unsigned> > > configurations(2);
+        configurations[0].resize(1);
+        for (int s = 0; s < num_structures; ++s) configurations[0][0].push_back(s);
+        configurations[1].resize(3);
+        for (int s = 0; s < num_structures; ++s)
+        {
+            configurations[1][s < num_structures / 2 ? 0 : (s < num_structures - 1 ? 1 : 2)].push_back(s);
+        }
+
+        // The structures that are moved before each factorization.  The first
+        // factorization is computed from scratch, and the subsequent ones
+        // reuse all, a trailing part, a leading part, or none of the previous
+        // factor.
+        std::vector<std::vector<unsigned> > moved_structures(6);
+        moved_structures[2].push_back(num_structures - 2);
+        moved_structures[2].push_back(num_structures - 1);
+        moved_structures[3].push_back(0);
+        moved_structures[4].push_back(1);
+        moved_structures[4].push_back(3);
+        moved_structures[4].push_back(num_structures - 1);
+        for (int s = 0; s < num_structures; ++s) moved_structures[5].push_back(s);
+
+        for (unsigned c = 0; c < configurations.size(); ++c)
+        {
+            std::vector<Pointer<DirectMobilitySolver> > solvers(2);
+            solvers[0] = new DirectMobilitySolver("ReferenceMobilitySolver",
+                                                  app_initializer->getComponentDatabase("ReferenceMobilitySolver"),
+                                                  cib_strategy);
+            solvers[1] = new DirectMobilitySolver("DistributedMobilitySolver",
+                                                  app_initializer->getComponentDatabase("DistributedMobilitySolver"),
+                                                  cib_strategy);
+            register_mobility_matrices(solvers, configurations[c]);
+            for (unsigned step = 0; step < moved_structures.size(); ++step)
+            {
+                std::ostringstream description;
+                description << configurations[c].size() << " matrices, factorization " << step << ", moved structures:";
+                for (unsigned k = 0; k < moved_structures[step].size(); ++k)
+                {
+                    const double displacement[NDIM] = { 0.3 * node_spacing, (0.1 * step - 0.2) * node_spacing };
+                    cib_strategy->displaceStructure(moved_structures[step][k], displacement);
+                    description << " " << moved_structures[step][k];
+                }
+                passed = check_solvers(solvers[0],
+                                       solvers[1],
+                                       cib_strategy,
+                                       configurations[c],
+                                       num_nodes_per_structure,
+                                       x_nest,
+                                       description.str()) &&
+                         passed;
+            }
+        }
+        pout << "\n" << (passed ? "all tests PASSED" : "some tests FAILED") << "\n";
+
+        VecDestroy(&x_nest);
+        PETScSAMRAIVectorReal::destroyPETScVector(u_petsc_vec);
+        app_initializer.setNull();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
@@ -0,0 +1,359 @@
+// Filename: main.cpp
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/NonbondedForceEvaluator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+// Number of interacting pairs (pairs separated by less than the cutoff
+// distance) encountered by the force function on this processor.
+static int s_num_interacting_pairs = 0;
+
+// A force that is proportional to the vector connecting the pair of nodes and
+// that vanishes beyond the cutoff distance params[0].  Because the force jumps
+// at the cutoff distance and depends on the periodic shift applied to the
+// pair, a pair that is missed, counted twice, or shifted incorrectly changes
+// the total force on its nodes by O(params[1]).
+void
+cutoff_force(double* D, const Array<double> params, double* out_force)
+{
+    const double cutoff = params[0];
+    const double stiffness = params[1];
+    double R_sq = 0.0;
+    for (int d = 0; d < NDIM; ++d) R_sq += D[d] * D[d];
+    const bool interacting = R_sq < cutoff * cutoff;
+    if (interacting) ++s_num_interacting_pairs;
+    for (int d = 0; d < NDIM; ++d) out_force[d] = interacting ? stiffness * D[d] / cutoff : 0.0;
+    return;
+} // cutoff_force
+
+// Gather the values of a PETSc-ordered Lagrangian vector in Lagrangian index
+// order on every processor.
+void
+gather_lagrangian_values(std::vector<double>& values, Vec petsc_vec, LDataManager* l_data_manager, const int ln)
+{
+    Vec lag_vec, all_vec;
+    VecDuplicate(petsc_vec, &lag_vec);
+    l_data_manager->scatterPETScToLagrangian(petsc_vec, lag_vec, ln);
+    VecScatter ctx;
+    VecScatterCreateToAll(lag_vec, &ctx, &all_vec);
+    VecScatterBegin(ctx, lag_vec, all_vec, INSERT_VALUES, SCATTER_FORWARD);
+    VecScatterEnd(ctx, lag_vec, all_vec, INSERT_VALUES, SCATTER_FORWARD);
+    PetscInt size;
+    VecGetSize(all_vec, &size);
+    const double* all_array;
+    VecGetArrayRead(all_vec, &all_array);
+    values.assign(all_array, all_array + size);
+    VecRestoreArrayRead(all_vec, &all_array);
+    VecScatterDestroy(&ctx);
+    VecDestroy(&all_vec);
+    VecDestroy(&lag_vec);
+    return;
+} // gather_lagrangian_values
+
+// Compute the forces and the number of interacting pairs by looping over all
+// pairs of nodes and all periodic images.
+void
+compute_all_pairs_forces(std::vector<double>& F,
+                         int& num_interacting_pairs,
+                         const std::vector<double>& X,
+                         const Array<double>& params,
+                         const double* const domain_length)
+{
+    const int num_nodes = static_cast<int>(X.size()) / NDIM;
+    F.assign(X.size(), 0.0);
+    num_interacting_pairs = 0;
+    const int num_images = NDIM == 2 ? 9 : 27;
+    for (int i = 0; i < num_nodes; ++i)
+    {
+        for (int j = i + 1; j < num_nodes; ++j)
+        {
+            for (int image = 0; image < num_images; ++image)
+            {
+                double D[NDIM], F_ij[NDIM];
+                for (int d = 0, offset = image; d < NDIM; ++d, offset /= 3)
+                {
+                    D[d] = X[NDIM * i + d] - X[NDIM * j + d] - (offset % 3 - 1) * domain_length[d];
+                }
+                double R_sq = 0.0;
+                for (int d = 0; d < NDIM; ++d) R_sq += D[d] * D[d];
+                if (R_sq >= params[0] * params[0]) continue;
+                ++num_interacting_pairs;
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    F_ij[d] = params[1] * D[d] / params[0];
+                    F[NDIM * i + d] += F_ij[d];
+                    F[NDIM * j + d] -= F_ij[d];
+                }
+            }
+        }
+    }
+    return;
+} // compute_all_pairs_forces
+
+// Evaluate the forces with the specified evaluator and compare the number of
+// interacting pairs and the force on each node to the all-pairs values.
+bool
+check_forces(const std::string& name,
+             Pointer<NonbondedForceEvaluator> evaluator,
+             Pointer<LData> F_data,
+             Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+             LDataManager* l_data_manager,
+             const Array<double>& params,
+             const double* const domain_length)
+{
+    const int ln = patch_hierarchy->getFinestLevelNumber();
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+
+    // Evaluate the forces, including the contributions accumulated on ghost
+    // nodes.
+    X_data->beginGhostUpdate();
+    X_data->endGhostUpdate();
+    Vec F_local_form_vec;
+    VecGhostGetLocalForm(F_data->getVec(), &F_local_form_vec);
+    VecSet(F_local_form_vec, 0.0);
+    VecGhostRestoreLocalForm(F_data->getVec(), &F_local_form_vec);
+    s_num_interacting_pairs = 0;
+    evaluator->computeLagrangianForce(F_data, X_data, Pointer<LData>(NULL), patch_hierarchy, ln, 0.0, l_data_manager);
+    VecGhostUpdateBegin(F_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+    VecGhostUpdateEnd(F_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+    const int num_interacting_pairs = SAMRAI_MPI::sumReduction(s_num_interacting_pairs);
+
+    // Compute the all-pairs values.
+    std::vector<double> X, F, F_all_pairs;
+    gather_lagrangian_values(X, X_data->getVec(), l_data_manager, ln);
+    gather_lagrangian_values(F, F_data->getVec(), l_data_manager, ln);
+    int num_interacting_pairs_all_pairs;
+    compute_all_pairs_forces(F_all_pairs, num_interacting_pairs_all_pairs, X, params, domain_length);
+    double max_F_err = 0.0;
+    for (unsigned int k = 0; k < F.size(); ++k) max_F_err = std::max(max_F_err, std::abs(F[k] - F_all_pairs[k]));
+
+    const bool passed = num_interacting_pairs == num_interacting_pairs_all_pairs && max_F_err <= 1.0e-12 * params[1];
+    pout << name << ":\n"
+         << "  interacting pairs: " << num_interacting_pairs << " (all pairs: " << num_interacting_pairs_all_pairs
+         << ")\n"
+         << "  max force error:   " << max_F_err << "\n"
+         << "  " << (passed ? "PASSED" : "FAILED") << "\n";
+    return passed;
+} // check_forces
+
+// Displace the nodes by deterministic amounts of magnitude at most
+// max_displacement that depend only on the Lagrangian index.
+void
+displace_nodes(Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+               LDataManager* l_data_manager,
+               const double max_displacement)
+{
+    const int ln = patch_hierarchy->getFinestLevelNumber();
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+    Vec X_vec = X_data->getVec();
+    Vec X_lag_vec;
+    VecDuplicate(X_vec, &X_lag_vec);
+    l_data_manager->scatterPETScToLagrangian(X_vec, X_lag_vec, ln);
+    PetscInt lo, hi;
+    VecGetOwnershipRange(X_lag_vec, &lo, &hi);
+    double* X_lag_array;
+    VecGetArray(X_lag_vec, &X_lag_array);
+    for (PetscInt k = lo; k < hi; ++k)
+    {
+        const int lag_idx = static_cast<int>(k) / NDIM;
+        const int d = static_cast<int>(k) % NDIM;
+        X_lag_array[k - lo] += max_displacement / std::sqrt(double(NDIM)) * std::sin(1.0 + 7.0 * lag_idx + 3.0 * d);
+    }
+    VecRestoreArray(X_lag_vec, &X_lag_array);
+    l_data_manager->scatterLagrangianToPETSc(X_lag_vec, X_vec, ln);
+    VecDestroy(&X_lag_vec);
+    return;
+} // displace_nodes
+
+/*******************************************************************************
+ * This test compares the pairs enumerated and the forces computed by          *
+ * NonbondedForceEvaluator, using cell lists and using Verlet lists, to the    *
+ * values obtained by looping over all pairs of nodes and all periodic images. *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Create the force evaluators.  All of them use the same force function
+        // and parameters; they differ only in how the interacting pairs are
+        // determined.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        Pointer<Database> cell_list_db = app_initializer->getComponentDatabase("NonbondedForceEvaluator");
+        Pointer<Database> verlet_list_db = app_initializer->getComponentDatabase("VerletListForceEvaluator");
+        Pointer<Database> verlet_list_no_skin_db =
+            app_initializer->getComponentDatabase("VerletListNoSkinForceEvaluator");
+        Pointer<NonbondedForceEvaluator> cell_list_evaluator =
+            new NonbondedForceEvaluator(cell_list_db, grid_geometry);
+        Pointer<NonbondedForceEvaluator> verlet_list_evaluator =
+            new NonbondedForceEvaluator(verlet_list_db, grid_geometry);
+        Pointer<NonbondedForceEvaluator> verlet_list_no_skin_evaluator =
+            new NonbondedForceEvaluator(verlet_list_no_skin_db, grid_geometry);
+        cell_list_evaluator->registerForceFcnPtr(cutoff_force);
+        verlet_list_evaluator->registerForceFcnPtr(cutoff_force);
+        verlet_list_no_skin_evaluator->registerForceFcnPtr(cutoff_force);
+        const Array<double> params = cell_list_db->getDoubleArray("parameters");
+        Pointer<LData> F_data =
+            l_data_manager->createLData("F_nonbonded", patch_hierarchy->getFinestLevelNumber(), NDIM);
+        double domain_length[NDIM];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            domain_length[d] = grid_geometry->getXUpper()[d] - grid_geometry->getXLower()[d];
+        }
+
+        // Check the forces at the initial node positions, and then again after
+        // the nodes are displaced by less than half the Verlet skin distance,
+        // so that the Verlet lists built at the initial positions are reused.
+        const double max_displacement = 0.4 * verlet_list_db->getDouble("verlet_skin");
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            if (pass == 1)
+            {
+                pout << "\ndisplacing nodes by at most " << max_displacement << "\n\n";
+                displace_nodes(patch_hierarchy, l_data_manager, max_displacement);
+            }
+            passed = check_forces("cell lists",
+                                  cell_list_evaluator,
+                                  F_data,
+                                  patch_hierarchy,
+                                  l_data_manager,
+                                  params,
+                                  domain_length) &&
+                     passed;
+            passed = check_forces("Verlet lists",
+                                  verlet_list_evaluator,
+                                  F_data,
+                                  patch_hierarchy,
+                                  l_data_manager,
+                                  params,
+                                  domain_length) &&
+                     passed;
+            passed = check_forces("Verlet lists without skin",
+                                  verlet_list_no_skin_evaluator,
+                                  F_data,
+                                  patch_hierarchy,
+                                  l_data_manager,
+                                  params,
+                                  domain_length) &&
+                     passed;
+        }
+        pout << "\n" << (passed ? "all tests PASSED" : "some tests FAILED") << "\n";
+        app_initializer.setNull();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
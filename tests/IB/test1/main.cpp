@@ -0,0 +1,251 @@
+// Filename: main.cpp
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+
+// Gather the values of a PETSc-ordered Lagrangian vector in Lagrangian index
+// order on every processor.
+void
+gather_lagrangian_values(std::vector<double>& values, Vec petsc_vec, LDataManager* l_data_manager, const int ln)
+{
+    Vec lag_vec, all_vec;
+    VecDuplicate(petsc_vec, &lag_vec);
+    l_data_manager->scatterPETScToLagrangian(petsc_vec, lag_vec, ln);
+    VecScatter ctx;
+    VecScatterCreateToAll(lag_vec, &ctx, &all_vec);
+    VecScatterBegin(ctx, lag_vec, all_vec, INSERT_VALUES, SCATTER_FORWARD);
+    VecScatterEnd(ctx, lag_vec, all_vec, INSERT_VALUES, SCATTER_FORWARD);
+    PetscInt size;
+    VecGetSize(all_vec, &size);
+    const double* all_array;
+    VecGetArrayRead(all_vec, &all_array);
+    values.assign(all_array, all_array + size);
+    VecRestoreArrayRead(all_vec, &all_array);
+    VecScatterDestroy(&ctx);
+    VecDestroy(&all_vec);
+    VecDestroy(&lag_vec);
+    return;
+} // gather_lagrangian_values
+
+// Check that the nodes are distributed consistently with the patches of the
+// level and that their positions are the initial positions shifted by the
+// specified displacement.
+bool
+check_nodes(Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+            LDataManager* l_data_manager,
+            const std::vector<double>& X0,
+            const Vector& displacement)
+{
+    const int ln = patch_hierarchy->getFinestLevelNumber();
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_hierarchy->getGridGeometry();
+    std::vector<Box<NDIM> > local_boxes;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++) local_boxes.push_back(level->getPatch(p())->getBox());
+
+    // Each local node must lie in a local patch.
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+    const std::vector<LNode*>& local_nodes = l_data_manager->getLMesh(ln)->getLocalNodes();
+    const boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+    int num_misplaced_nodes = 0;
+    for (unsigned int k = 0; k < local_nodes.size(); ++k)
+    {
+        const double* const X_node = &X[local_nodes[k]->getLocalPETScIndex()][0];
+        const CellIndex<NDIM> cell_idx = IndexUtilities::getCellIndex(X_node, grid_geom, level->getRatio());
+        bool found = false;
+        for (unsigned int b = 0; b < local_boxes.size() && !found; ++b) found = local_boxes[b].contains(cell_idx);
+        if (!found) ++num_misplaced_nodes;
+    }
+    X_data->restoreArrays();
+    num_misplaced_nodes = SAMRAI_MPI::sumReduction(num_misplaced_nodes);
+    const int num_local_nodes = SAMRAI_MPI::sumReduction(static_cast<int>(local_nodes.size()));
+
+    // The node positions must be the initial positions shifted by the
+    // displacement.
+    std::vector<double> X_all;
+    gather_lagrangian_values(X_all, X_data->getVec(), l_data_manager, ln);
+    double max_X_err = 0.0;
+    for (unsigned int k = 0; k < X_all.size(); ++k)
+    {
+        max_X_err = std::max(max_X_err, std::abs(X_all[k] - X0[k] - displacement[k % NDIM]));
+    }
+
+    const int num_nodes = static_cast<int>(l_data_manager->getNumberOfNodes(ln));
+    const bool passed = num_misplaced_nodes == 0 && num_local_nodes == num_nodes && max_X_err <= 1.0e-12;
+    if (!passed)
+    {
+        pout << "  misplaced nodes: " << num_misplaced_nodes << ", local nodes: " << num_local_nodes
+             << " (total nodes: " << num_nodes << "), max position error: " << max_X_err << "\n";
+    }
+    return passed;
+} // check_nodes
+
+/*******************************************************************************
+ * This test times the redistribution of the Lagrangian nodes of a structure   *
+ * that is repeatedly displaced across the domain, so that most of its nodes   *
+ * move to patches owned by other processors, and it checks that the nodes are *
+ * redistributed correctly.  It should be run on increasing numbers of         *
+ * processors.  The command line is:                                           *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Repeatedly displace the structure back and forth across the domain
+        // and time the resulting redistribution of its nodes.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const int ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        std::vector<double> X0;
+        gather_lagrangian_values(X0, X_data->getVec(), l_data_manager, ln);
+        const int num_redistributions = input_db->getInteger("NUM_REDISTRIBUTIONS");
+        const Vector zero = Vector::Zero();
+        Vector shift = Vector::Zero();
+        input_db->getDoubleArray("SHIFT", shift.data(), NDIM);
+        double total_time = 0.0, max_time = 0.0;
+        for (int k = 0; k < num_redistributions; ++k)
+        {
+            const bool shifted = k % 2 == 0;
+            const Vector dX = shifted ? shift : Vector(-shift);
+            l_data_manager->displaceLagrangianStructure(dX, 0, ln);
+            SAMRAI_MPI::barrier();
+            const double start_time = MPI_Wtime();
+            l_data_manager->beginDataRedistribution();
+            l_data_manager->endDataRedistribution();
+            const double elapsed_time = SAMRAI_MPI::maxReduction(MPI_Wtime() - start_time);
+            total_time += elapsed_time;
+            max_time = std::max(max_time, elapsed_time);
+            passed = check_nodes(patch_hierarchy, l_data_manager, X0, shifted ? shift : zero) && passed;
+        }
+
+        pout << "number of processors:          " << SAMRAI_MPI::getNodes() << "\n"
+             << "number of nodes:               " << l_data_manager->getNumberOfNodes(ln) << "\n"
+             << "number of redistributions:     " << num_redistributions << "\n"
+             << "average redistribution time:   " << total_time / num_redistributions << " s\n"
+             << "maximum redistribution time:   " << max_time << " s\n"
+             << "\n" << (passed ? "PASSED" : "FAILED") << "\n";
+        app_initializer.setNull();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
@@ -0,0 +1,215 @@
+// Filename: main.cpp
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <sys/resource.h>
+
+#include <string>
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/TimerManager.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+
+// Return the peak resident set size of this process in kilobytes.
+double
+peak_rss_kb()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_maxrss);
+} // peak_rss_kb
+
+// Return the total wallclock time accumulated by the specified timer.
+double
+timer_total(const std::string& name)
+{
+    return TimerManager::getManager()->getTimer(name)->getTotalWallclockTime();
+} // timer_total
+
+// Translate all of the nodes on the specified level.  Nodes that leave the
+// periodic domain are mapped back into it when the nodes are redistributed.
+void
+translate_nodes(LDataManager* l_data_manager, const int ln, const double* const dX)
+{
+    Vec X_vec = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln)->getVec();
+    PetscInt local_size;
+    VecGetLocalSize(X_vec, &local_size);
+    double* X_array;
+    VecGetArray(X_vec, &X_array);
+    for (PetscInt k = 0; k < local_size; ++k) X_array[k] += dX[k % NDIM];
+    VecRestoreArray(X_vec, &X_array);
+    return;
+} // translate_nodes
+
+/*******************************************************************************
+ * This benchmark measures the time and the peak memory used to regrid a       *
+ * patch hierarchy that contains a block of Lagrangian nodes that is           *
+ * translated across the periodic boundaries of the domain between regrids.    *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Translate the nodes and regrid the patch hierarchy repeatedly.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const int num_regrids = input_db->getInteger("NUM_REGRIDS");
+        double dX[NDIM];
+        input_db->getDoubleArray("TRANSLATION", dX, NDIM);
+        const double initial_peak_rss = peak_rss_kb();
+        const double initial_redistribution_time =
+            timer_total("IBTK::LDataManager::beginDataRedistribution()") +
+            timer_total("IBTK::LDataManager::endDataRedistribution()");
+        const double initial_node_distribution_time = timer_total("IBTK::LDataManager::computeNodeDistribution()");
+        double regrid_time = 0.0;
+        for (int k = 0; k < num_regrids; ++k)
+        {
+            translate_nodes(l_data_manager, patch_hierarchy->getFinestLevelNumber(), dX);
+            SAMRAI_MPI::barrier();
+            const double start_time = MPI_Wtime();
+            time_integrator->regridHierarchy();
+            regrid_time += SAMRAI_MPI::maxReduction(MPI_Wtime() - start_time);
+
+            // Check that no nodes are lost.
+            const int ln = patch_hierarchy->getFinestLevelNumber();
+            const int num_local_nodes =
+                SAMRAI_MPI::sumReduction(static_cast<int>(l_data_manager->getLMesh(ln)->getLocalNodes().size()));
+            passed = num_local_nodes == static_cast<int>(l_data_manager->getNumberOfNodes(ln)) && passed;
+        }
+        const double redistribution_time = SAMRAI_MPI::maxReduction(
+            timer_total("IBTK::LDataManager::beginDataRedistribution()") +
+            timer_total("IBTK::LDataManager::endDataRedistribution()") - initial_redistribution_time);
+        const double node_distribution_time = SAMRAI_MPI::maxReduction(
+            timer_total("IBTK::LDataManager::computeNodeDistribution()") - initial_node_distribution_time);
+        const double max_initial_peak_rss = SAMRAI_MPI::maxReduction(initial_peak_rss);
+        const double max_peak_rss = SAMRAI_MPI::maxReduction(peak_rss_kb());
+        const double total_peak_rss = SAMRAI_MPI::sumReduction(peak_rss_kb());
+
+        pout << "number of processors:                         " << SAMRAI_MPI::getNodes() << "\n"
+             << "number of regrids:                            " << num_regrids << "\n"
+             << "average regrid time:                          " << regrid_time / num_regrids << " s\n"
+             << "average LDataManager redistribution time:     " << redistribution_time / num_regrids << " s\n"
+             << "average LDataManager node distribution time:  " << node_distribution_time / num_regrids << " s\n"
+             << "max peak RSS after initialization:            " << max_initial_peak_rss << " kB\n"
+             << "max peak RSS after regridding:                " << max_peak_rss << " kB\n"
+             << "total peak RSS after regridding:              " << total_peak_rss << " kB\n"
+             << "\n" << (passed ? "PASSED" : "FAILED") << "\n";
+        TimerManager::getManager()->print(plog);
+        app_initializer.setNull();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
@@ -0,0 +1,132 @@
+// Filename: main.cpp
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <set>
+#include <string>
+#include <vector>
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <tbox/PIO.h>
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/LNode.h>
+#include <ibtk/LNodeSet.h>
+#include <ibtk/LObjectPool.h>
+#include <ibtk/app_namespaces.h>
+
+// Check that the storage for objects of type T is recycled by the pool and
+// that chunks are returned to the heap once they hold no live objects.
+template <class T>
+bool
+check_pool(const std::string& name)
+{
+    typedef LObjectPool<T> Pool;
+    Pool::releaseUnusedChunks();
+    const size_t initial_num_chunks = Pool::getNumberOfChunks();
+    const size_t num_objects = 4 * Pool::getNumberOfBlocksPerChunk() + 1;
+
+    // Allocate a batch of objects, free them, and allocate a second batch of
+    // the same size.  The second batch must reuse the storage of the first
+    // batch without allocating new chunks.
+    std::vector<T*> objects(num_objects);
+    for (size_t k = 0; k < num_objects; ++k) objects[k] = new T();
+    const size_t peak_num_chunks = Pool::getNumberOfChunks();
+    const std::set<T*> first_addresses(objects.begin(), objects.end());
+    for (size_t k = 0; k < num_objects; ++k) delete objects[k];
+    size_t num_reused_blocks = 0;
+    for (size_t k = 0; k < num_objects; ++k)
+    {
+        objects[k] = new T();
+        if (first_addresses.count(objects[k])) ++num_reused_blocks;
+    }
+    const bool reused = num_reused_blocks == num_objects && Pool::getNumberOfChunks() == peak_num_chunks;
+
+    // Keep one object alive and release the remaining chunks, which hold no
+    // live objects.  Freed blocks in the retained chunk must be reused.
+    for (size_t k = 1; k < num_objects; ++k) delete objects[k];
+    const size_t num_released_chunks = Pool::releaseUnusedChunks();
+    const bool released_partial = Pool::getNumberOfChunks() == initial_num_chunks + 1 &&
+                                  num_released_chunks == peak_num_chunks - initial_num_chunks - 1;
+    T* const reused_object = new T();
+    const bool reused_retained_chunk = Pool::getNumberOfChunks() == initial_num_chunks + 1;
+    delete reused_object;
+
+    // Free the last object and release its chunk.
+    delete objects[0];
+    Pool::releaseUnusedChunks();
+    const bool released_all = Pool::getNumberOfChunks() == initial_num_chunks;
+
+    const bool passed = reused && released_partial && reused_retained_chunk && released_all;
+    pout << name << ":\n"
+         << "  chunks at peak:                " << peak_num_chunks - initial_num_chunks << "\n"
+         << "  blocks reused after free:      " << num_reused_blocks << " of " << num_objects << "\n"
+         << "  chunks released with one live: " << num_released_chunks << "\n"
+         << "  chunks held after release:     " << Pool::getNumberOfChunks() - initial_num_chunks << "\n"
+         << "  " << (passed ? "PASSED" : "FAILED") << "\n";
+    return passed;
+} // check_pool
+
+/*******************************************************************************
+ * This test checks that the pooled storage used for Lagrangian nodes and node *
+ * sets is reused after the objects are freed and that unused chunks are       *
+ * returned to the heap.  The command line is:                                 *
+ *                                                                             *
+ *    executable                                                               *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    passed = check_pool<LNode>("LNode") && passed;
+    passed = check_pool<LNodeSet>("LNodeSet") && passed;
+    pout << "\n" << (passed ? "all tests PASSED" : "some tests FAILED") << "\n";
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main